@@ -6,6 +6,19 @@
 *   coloring." Workshop on Algorithms and Data Structures. Springer, Berlin,
 *   Heidelberg, 2001.
 *
+* get_all_mis runs it in place, as the class TrailEppstein below: one graph
+* is kept throughout, each vertex deletion is recorded on a trail, and a
+* branch undoes its deletions on return rather than working on a copy. The
+* vertices of degree 0, 1, 2 and 3+ in what remains are kept in array bucket
+* queues. A set can only fail to be maximal through a vertex removed without
+* being dominated (the branch leaving out a vertex of degree 3+, and u in
+* the last degree-2 branch); the number of such vertices that have no
+* neighbor left to dominate them is kept up to date, and a branch returns as
+* soon as it is nonzero, so every leaf reached is a maximal independent set.
+*
+* recursive_eppstein, on an EditableGraph copied at each branch, finds the
+* same sets.
+*
 * @authors Eric Horton, Kyle Kloster, Drew van der Poel
 *
 * This file is part of MI-bicliques, https://github.com/TheoryInPractice/MI-bicliques,
@@ -13,11 +26,253 @@
 * It is licensed under the three-clause BSD license; see LICENSE.
 */
 
+#include <algorithm> // for std::sort
 #include "../graph/Graph.h"
 #include "../graph/OrderedVertexSet.h"
 #include "AllMaximalIndependentSets.h"
 
 
+namespace {
+
+/**
+ * Eppstein's branching on one mutable graph with a trail; see above.
+ */
+class TrailEppstein {
+
+public:
+    TrailEppstein(const Graph & g) {
+
+        size_t num_vertices = g.get_num_vertices();
+        neighbors.resize(num_vertices);
+        for (size_t vertex = 0; vertex < num_vertices; vertex++) {
+            for (size_t neighbor : g.get_neighbors(vertex)) neighbors[vertex].push_back(neighbor);
+        }
+
+        in_graph.assign(num_vertices, true);
+        degree.resize(num_vertices);
+        bucket_pos.resize(num_vertices);
+        excluded.assign(num_vertices, false);
+        num_dominators.assign(num_vertices, 0);
+        num_blocked = 0;
+        for (size_t vertex = 0; vertex < num_vertices; vertex++) {
+            degree[vertex] = neighbors[vertex].size();
+            bucket_insert(vertex);
+        }
+
+    }
+
+    /**
+     * Add every maximal independent set to list_of_MIS, in ascending order.
+     */
+    void enumerate(std::vector<std::vector<size_t>> & list_of_MIS) {
+        branch(list_of_MIS);
+    }
+
+private:
+    enum Op { DELETE, ADD, EXCLUDE };
+    struct TrailEntry {
+        Op op;
+        size_t vertex;
+    };
+
+    std::vector<std::vector<size_t>> neighbors;
+
+    // Whether each vertex remains, and how many of its neighbors remain
+    std::vector<bool> in_graph;
+    std::vector<size_t> degree;
+
+    // Remaining vertices by degree, 3 standing for 3+, and the position of
+    // each in its bucket
+    std::vector<size_t> buckets[4];
+    std::vector<size_t> bucket_pos;
+
+    // Vertices removed without being dominated, the number of neighbors of
+    // each vertex in the set, and how many excluded vertices have neither a
+    // neighbor in the set nor one remaining
+    std::vector<bool> excluded;
+    std::vector<size_t> num_dominators;
+    size_t num_blocked;
+
+    std::vector<size_t> independent_set;
+    std::vector<TrailEntry> trail;
+
+    inline size_t bucket_of(size_t vertex) const {
+        return std::min<size_t>(degree[vertex], 3);
+    }
+
+    inline bool is_blocked(size_t vertex) const {
+        return excluded[vertex] && num_dominators[vertex] == 0 && degree[vertex] == 0;
+    }
+
+    void bucket_insert(size_t vertex) {
+        auto & bucket = buckets[bucket_of(vertex)];
+        bucket_pos[vertex] = bucket.size();
+        bucket.push_back(vertex);
+    }
+
+    void bucket_erase(size_t vertex) {
+        auto & bucket = buckets[bucket_of(vertex)];
+        size_t last = bucket.back();
+        bucket[bucket_pos[vertex]] = last;
+        bucket_pos[last] = bucket_pos[vertex];
+        bucket.pop_back();
+    }
+
+    // Remove vertex, which remains, updating the degrees of its neighbors
+    void delete_vertex(size_t vertex) {
+
+        bucket_erase(vertex);
+        in_graph[vertex] = false;
+        for (size_t neighbor : neighbors[vertex]) {
+            if (in_graph[neighbor]) bucket_erase(neighbor);
+            degree[neighbor]--;
+            if (in_graph[neighbor]) bucket_insert(neighbor);
+            else if (is_blocked(neighbor)) num_blocked++;
+        }
+        trail.push_back({DELETE, vertex});
+
+    }
+
+    // Put vertex, which remains, in the set and remove its closed neighborhood
+    void add_vertex(size_t vertex) {
+
+        for (size_t neighbor : neighbors[vertex]) num_dominators[neighbor]++;
+        independent_set.push_back(vertex);
+        trail.push_back({ADD, vertex});
+
+        for (size_t neighbor : neighbors[vertex]) {
+            if (in_graph[neighbor]) delete_vertex(neighbor);
+        }
+        delete_vertex(vertex);
+
+    }
+
+    // Remove vertex, which remains, leaving it out of the set
+    void exclude_vertex(size_t vertex) {
+
+        excluded[vertex] = true;
+        trail.push_back({EXCLUDE, vertex});
+        delete_vertex(vertex);
+        if (is_blocked(vertex)) num_blocked++;
+
+    }
+
+    // Undo every operation since the trail had size mark, latest first
+    void undo(size_t mark) {
+
+        while (trail.size() > mark) {
+            TrailEntry entry = trail.back();
+            trail.pop_back();
+            size_t vertex = entry.vertex;
+
+            if (entry.op == DELETE) {
+                for (size_t neighbor : neighbors[vertex]) {
+                    if (in_graph[neighbor]) bucket_erase(neighbor);
+                    else if (is_blocked(neighbor)) num_blocked--;
+                    degree[neighbor]++;
+                    if (in_graph[neighbor]) bucket_insert(neighbor);
+                }
+                in_graph[vertex] = true;
+                bucket_insert(vertex);
+            }
+            else if (entry.op == ADD) {
+                for (size_t neighbor : neighbors[vertex]) num_dominators[neighbor]--;
+                independent_set.pop_back();
+            }
+            else {
+                // Its degree is back to what it was when it was excluded
+                if (is_blocked(vertex)) num_blocked--;
+                excluded[vertex] = false;
+            }
+        }
+
+    }
+
+    // The remaining neighbors of vertex
+    std::vector<size_t> remaining_neighbors(size_t vertex) const {
+        std::vector<size_t> remaining;
+        for (size_t neighbor : neighbors[vertex]) {
+            if (in_graph[neighbor]) remaining.push_back(neighbor);
+        }
+        return remaining;
+    }
+
+    void branch(std::vector<std::vector<size_t>> & list_of_MIS) {
+
+        // Some excluded vertex can no longer be dominated
+        if (num_blocked > 0) return;
+
+        size_t mark = trail.size();
+
+        // S = 0: no excluded vertex is blocked, so the set is maximal
+        if (buckets[0].empty() && buckets[1].empty() && buckets[2].empty() && buckets[3].empty()) {
+            std::vector<size_t> mis = independent_set;
+            std::sort(mis.begin(), mis.end());
+            list_of_MIS.push_back(std::move(mis));
+            return;
+        }
+
+        // DEGREE 0: put all degree zero vertices into the set
+        else if (!buckets[0].empty()) {
+            while (!buckets[0].empty()) add_vertex(buckets[0].back());
+            branch(list_of_MIS);
+        }
+
+        // DEGREE 1: (S-N(v), I+v) and (S-N(u), I+u), for v's neighbor u
+        else if (!buckets[1].empty()) {
+            size_t vertex = buckets[1].back();
+            size_t neighbor = remaining_neighbors(vertex).front();
+
+            add_vertex(vertex);
+            branch(list_of_MIS);
+            undo(mark);
+
+            add_vertex(neighbor);
+            branch(list_of_MIS);
+        }
+
+        // DEGREE 3+: (S-v, I) and (S-N(v), I+v)
+        else if (!buckets[3].empty()) {
+            size_t vertex = buckets[3].back();
+
+            exclude_vertex(vertex);
+            branch(list_of_MIS);
+            undo(mark);
+
+            add_vertex(vertex);
+            branch(list_of_MIS);
+        }
+
+        // ALL VERTICES DEGREE 2: (S-N(v), I+v), (S-N(u), I+u) and
+        // (S-N(w)-u, I+w), for v's neighbors u and w
+        else {
+            size_t vertex = buckets[2].back();
+            std::vector<size_t> neighbors_v = remaining_neighbors(vertex);
+            size_t neighb_u = neighbors_v[0];
+            size_t neighb_w = neighbors_v[1];
+
+            add_vertex(vertex);
+            branch(list_of_MIS);
+            undo(mark);
+
+            add_vertex(neighb_u);
+            branch(list_of_MIS);
+            undo(mark);
+
+            add_vertex(neighb_w);
+            if (in_graph[neighb_u]) exclude_vertex(neighb_u);
+            branch(list_of_MIS);
+        }
+
+        undo(mark);
+
+    }
+
+};
+
+}
+
+
 /**
  * Check whether input node set "independent_set" can have any vertex in input
  * graph_ptr added to it (i.e. whether it is maximal as an independent set).
@@ -248,29 +503,39 @@ void recursive_eppstein(std::shared_ptr<Graph> graph_ptr,
  */
 std::vector<std::vector<size_t>> get_all_mis(Graph & g) {
 
-    // Initializations
-    // Get shared_ptr for graph
-    auto graph_ptr = std::make_shared<Graph>(g);
-
-    // Get editable graph
-    EditableGraph ed_graph(g);
-
     // Output will be vector of MISs
     std::vector<std::vector<size_t>> list_of_MIS;
 
-    // initialize full list of graph's vertices
-    size_t num_vertices = g.get_num_vertices();
+    TrailEppstein enumerator(g);
+    enumerator.enumerate(list_of_MIS);
+
+    return list_of_MIS;
+}
+
 
-    // initialize empty set
-    std::unordered_map<size_t,bool> potential_MIS;
+/**
+ * Output all maximal independent sets in the subgraph of g induced by
+ * vertices, each as a vector of labels of g in ascending order.
+ *
+ * If mis_cache is given, the sets are taken from it when the same vertex set
+ * has been seen before, and recorded in it otherwise. g must then be the
+ * cache's root graph or a subgraph of it.
+ */
+std::vector<std::vector<size_t>> get_all_mis(const Graph & g,
+                                             const std::vector<size_t> & vertices,
+                                             MISCache * mis_cache) {
+
+    std::vector<std::vector<size_t>> list_of_MIS;
 
-    recursive_eppstein(graph_ptr,
-                       list_of_MIS,
-                       ed_graph,
-                       potential_MIS,
-                       num_vertices
-                      );
+    MISCache::Key key;
+    bool cacheable = mis_cache != nullptr && mis_cache->make_key(g, vertices, key);
+    if (cacheable && mis_cache->lookup(key, vertices, list_of_MIS)) return list_of_MIS;
 
+    Graph subgraph = g.subgraph(vertices);
+    list_of_MIS = get_all_mis(subgraph);
+    if (cacheable) mis_cache->insert(key, list_of_MIS);
 
+    // Convert each MIS to use labelling of g instead of subgraph
+    convert_node_labels_vector_inplace(list_of_MIS, vertices);
     return list_of_MIS;
 }
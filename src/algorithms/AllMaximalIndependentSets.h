@@ -14,6 +14,7 @@
 #include "../graph/Graph.h"
 #include "../graph/OrderedVertexSet.h"
 #include "../graph/EditableGraph.h"
+#include "MISCache.h"
 
 
 bool check_is_maximal(std::shared_ptr<Graph> graph_ptr,
@@ -28,4 +29,8 @@ void recursive_eppstein(std::shared_ptr<Graph> graph_ptr,
 
 std::vector<std::vector<size_t>> get_all_mis(Graph & g);
 
+std::vector<std::vector<size_t>> get_all_mis(const Graph & g,
+                                             const std::vector<size_t> & vertices,
+                                             MISCache * mis_cache = nullptr);
+
 #endif //BICLIQUES_MAXIMUMINDEPENDENTSET_H
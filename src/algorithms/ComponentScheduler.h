@@ -0,0 +1,129 @@
+/**
+* @authors Eric Horton, Kyle Kloster, Drew van der Poel
+*
+* This file is part of MI-bicliques, https://github.com/TheoryInPractice/MI-bicliques,
+* and is Copyright (C) North Carolina State University, 2018.
+* It is licensed under the three-clause BSD license; see LICENSE.
+*/
+
+#ifndef BICLIQUES_COMPONENTSCHEDULER_H
+#define BICLIQUES_COMPONENTSCHEDULER_H
+
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "WorkStealingPool.h"
+#include "stddef.h"  // apparently required for size_t
+
+
+/**
+ * Call run_cc(cc_results, which_cc, log) for every connected component of
+ * vector_of_ccs. run_cc records the MIBs of component which_cc into
+ * cc_results and writes its progress lines to log.
+ *
+ * With results.num_threads <= 1 the components run in order, directly into
+ * results and std::cout.
+ *
+ * Otherwise they run concurrently on a pool of results.num_threads workers,
+ * largest component first. Each component records into its own shard, set
+ * up by results.configure_shard, and logs into a buffer. A finished shard is
+ * merged into results with results.merge and its log is written out. With
+ * results.deterministic_mode the shards are merged in component order, so
+ * output and log are those of a serial run; otherwise they are merged as
+ * they finish.
+ *
+ * after_merge(results) is called after each component is merged, always
+ * with the merge lock held. Once it returns true no further component is
+ * started; those already running finish and are merged, except that with
+ * results.deterministic_mode no shard after the stopping one is merged, just
+ * as in a serial run. It must not stop the run itself, since other workers
+ * may still be using results; the caller should do that once run_components
+ * returns.
+ */
+template <typename Results, typename RunCC, typename AfterMerge>
+void run_components(Results & results,
+                    const std::vector<std::vector<size_t>> & vector_of_ccs,
+                    RunCC run_cc,
+                    AfterMerge after_merge) {
+
+    size_t num_ccs = vector_of_ccs.size();
+
+    if (results.num_threads <= 1 || num_ccs <= 1) {
+        for (size_t which_cc = 0; which_cc < num_ccs; which_cc++) {
+            run_cc(results, which_cc, std::cout);
+            if (after_merge(results)) break;
+        }
+        return;
+    }
+
+    // Start the largest components first, so that none is left to run alone
+    std::vector<size_t> order(num_ccs);
+    for (size_t idx = 0; idx < num_ccs; idx++) order[idx] = idx;
+    std::stable_sort(order.begin(), order.end(), [&](size_t cc1, size_t cc2) {
+        return vector_of_ccs[cc1].size() > vector_of_ccs[cc2].size();
+    });
+
+    // Finished shards waiting for earlier components (deterministic mode)
+    std::vector<std::unique_ptr<Results>> shards(num_ccs);
+    std::vector<std::string> logs(num_ccs);
+    size_t next_to_merge = 0;
+    std::mutex merge_mutex;
+
+    std::atomic<size_t> next_position(0);
+    std::atomic<bool> stop(false);
+    WorkStealingPool pool(results.num_threads);
+
+    for (size_t worker = 0; worker < pool.size(); worker++) {
+        pool.submit([&] {
+            for (size_t position = next_position++; position < num_ccs && !stop;
+                 position = next_position++) {
+
+                size_t which_cc = order[position];
+                std::unique_ptr<Results> shard(new Results());
+                results.configure_shard(*shard);
+
+                std::ostringstream log;
+                run_cc(*shard, which_cc, log);
+
+                std::lock_guard<std::mutex> lock(merge_mutex);
+                if (!results.deterministic_mode) {
+                    std::cout << log.str() << std::flush;
+                    results.merge(*shard);
+                    if (after_merge(results)) stop = true;
+                    continue;
+                }
+
+                shards[which_cc] = std::move(shard);
+                logs[which_cc] = log.str();
+                while (next_to_merge < num_ccs && shards[next_to_merge] && !stop) {
+                    std::cout << logs[next_to_merge] << std::flush;
+                    results.merge(*shards[next_to_merge]);
+                    shards[next_to_merge].reset();
+                    logs[next_to_merge].clear();
+                    if (after_merge(results)) stop = true;
+                    next_to_merge++;
+                }
+            }
+        });
+    }
+    pool.wait();
+
+}
+
+
+template <typename Results, typename RunCC>
+void run_components(Results & results,
+                    const std::vector<std::vector<size_t>> & vector_of_ccs,
+                    RunCC run_cc) {
+
+    run_components(results, vector_of_ccs, run_cc, [](Results &) { return false; });
+
+}
+
+
+#endif //BICLIQUES_COMPONENTSCHEDULER_H
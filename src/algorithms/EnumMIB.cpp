@@ -19,6 +19,7 @@
 */
 
 #include "EnumMIB.h"
+#include "ComponentScheduler.h"
 #include "SimpleCCs.h"
 
 
@@ -189,7 +190,7 @@ void enummib_cc(NonLexMIBResults & nonlexmibresults,
     while (mib_archive.heap_size() > 0) {
 
         // Find least biclique in Q, call it B, add to output
-        auto current_least_bic = mib_archive.top();
+        BicliqueLite current_least_bic = std::move(mib_archive.top());
         mib_archive.pop();
 
         nonlexmibresults.push_back(current_least_bic);
@@ -247,34 +248,37 @@ void enummib_cc(NonLexMIBResults & nonlexmibresults,
  */
 void enummib(NonLexMIBResults & nonlexmibresults, const Graph & g) {
 
-    // Determine connected components
-    auto vector_of_ccs = simpleccs(g);
+    // Determine connected components (of the core left after size-constraint
+    // peeling, if any size constraints are in place)
+    auto vector_of_ccs = simpleccs(g, nonlexmibresults.size_constraints.min_degree());
 
-    if (vector_of_ccs.size() > 1) {
-        // run algorithm on each CC
-        for (size_t which_cc = 0; which_cc < vector_of_ccs.size(); which_cc++) {
+    // Peeled vertices also force the per-CC path, as the core is a proper subgraph
+    if (vector_of_ccs.size() != 1 || vector_of_ccs.front().size() < g.get_num_vertices()) {
+        // run algorithm on each CC, possibly several at once
+        run_components(nonlexmibresults, vector_of_ccs,
+                       [&](NonLexMIBResults & cc_results, size_t which_cc, std::ostream &) {
 
-            const std::vector<size_t> vertex_subset = vector_of_ccs[which_cc];
+            const std::vector<size_t> & vertex_subset = vector_of_ccs[which_cc];
 
             // Skip isolated vertices and empty sets
-            if (vertex_subset.size() <= 1) continue;
+            if (vertex_subset.size() <= 1) return;
 
             // Isolated edges are MIBs
             if (vertex_subset.size() == 2) {
-                nonlexmibresults.relabeling_mode = false;
+                cc_results.relabeling_mode = false;
                 BicliqueLite temp((std::vector<size_t>){vertex_subset.front()},
                              (std::vector<size_t>){vertex_subset.back()});
-                nonlexmibresults.push_back(temp);
-                continue;
+                cc_results.push_back(temp);
+                return;
             }
 
             Graph g_cc = g.subgraph(vertex_subset);
 
-            // Call main LexMIB function
-            nonlexmibresults.turn_on_relabeling_mode(vertex_subset);
-            enummib_cc(nonlexmibresults, g_cc);
+            // Call main EnumMIB function
+            cc_results.turn_on_relabeling_mode(vertex_subset);
+            enummib_cc(cc_results, g_cc);
 
-        }
+        });
     }
     else {
     	enummib_cc(nonlexmibresults, g);
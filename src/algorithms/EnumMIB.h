@@ -16,6 +16,7 @@
 #include "../graph/BicliqueLite.h"
 #include "../graph/Graph.h"
 #include "../graph/OrderedVector.h"
+#include "../graph/SizeConstraints.h"
 
 
 
@@ -31,8 +32,16 @@ struct NonLexMIBResults {
     bool count_only_mode = false;
     bool relabeling_mode = false;
 
+    // Number of worker threads, and whether parallel runs must output MIBs
+    // in the same order as serial ones
+    size_t num_threads = 1;
+    bool deterministic_mode = false;
+
     double time_ccs = 0.0;
 
+    // Only bicliques satisfying these bounds are counted and recorded
+    SizeConstraints size_constraints;
+
     size_t total_num_mibs = 0;
 
     size_t n = 0;
@@ -57,12 +66,35 @@ struct NonLexMIBResults {
         if (print_mode) output_file.close();
     }
 
-    void push_back(BicliqueLite this_mib) {
+    /**
+     * Set up `shard` to record one connected component on a worker thread.
+     */
+    void configure_shard(NonLexMIBResults & shard) const {
+        shard.size_constraints = size_constraints;
+        shard.count_only_mode = count_only_mode;
+    }
+
+    /**
+     * Move the MIBs of `shard`, already relabeled to this graph, into this
+     * object, printing them if print mode is on.
+     */
+    void merge(NonLexMIBResults & shard) {
+        total_num_mibs += shard.total_num_mibs;
+        for (auto & this_mib : shard.mibs_computed) {
+            if (print_mode) output_file << this_mib.to_string_persistent() << std::endl;
+            else mibs_computed.push_back(std::move(this_mib));
+        }
+        shard.mibs_computed.clear();
+    }
+
+    void push_back(const BicliqueLite & mib) {
+        if (!size_constraints.is_satisfied_by(mib)) return;
         // increment number of mibs regardless of mode
         total_num_mibs++;
 
-        // check for recording modes
+        // check for recording modes; count-only mode never copies the biclique
         if (!count_only_mode) {
+            BicliqueLite this_mib = mib;
             if (relabeling_mode) {
                 convert_node_labels_biclique(this_mib, relabeling_vector);
             }
@@ -70,7 +102,7 @@ struct NonLexMIBResults {
                 output_file << this_mib.to_string_persistent() << std::endl;
             }
             else {
-                mibs_computed.push_back(this_mib);
+                mibs_computed.push_back(std::move(this_mib));
             }
         }
     }
@@ -115,7 +147,7 @@ class BicliqueArchiveNonLex {
             mib_heap.push(mib);
         }
 
-        inline BicliqueLite top() { return mib_heap.front(); }
+        inline BicliqueLite & top() { return mib_heap.front(); }
         inline void pop() { mib_heap.pop(); }
 
 };
@@ -0,0 +1,475 @@
+/**
+ * exactoct finds a minimum odd cycle transversal by iterative compression,
+ * after Reed, Smith and Vetta (Finding odd cycle transversals, 2004), in
+ * O(3^k k m) time for an OCT set of size k.
+ *
+ * Vertices are added one at a time, keeping a minimum OCT set S of the graph
+ * induced by those added so far. A vertex whose addition leaves the graph
+ * minus S bipartite keeps S; otherwise S plus the vertex is an OCT set of
+ * size k + 1, and the compression step looks for one of size k. Vertices
+ * outside a known OCT set go first, as they induce a bipartite graph and so
+ * never need compressing.
+ *
+ * Compression of an OCT set C of size k + 1: the graph H = G - C is
+ * bipartite, with some 2-coloring col. Every solution X deletes part of C and
+ * 2-colors the rest, so we enumerate those 3^(k+1) choices, pruning those
+ * with adjacent kept vertices colored alike, and fixing the color of the
+ * first kept vertex, since swapping all colors gives the same problem. A kept
+ * vertex c colored a needs each neighbor u in H colored 1 - a, that is
+ * flipped from col(u) or not. Within a connected component of H - X either
+ * every vertex is flipped or none is, so X must separate the vertices needing
+ * a flip from those needing none; a vertex needing both must be in X. The
+ * rest of X is thus a minimum vertex cut between the two, which may include
+ * either, found as a maximum flow through H with unit vertex capacities.
+ * Only as many augmenting paths as the remaining budget allows are found.
+ *
+ * The search is abandoned, and exactoct returns false, once time_cap seconds
+ * have passed.
+ *
+ * @authors Eric Horton, Kyle Kloster, Drew van der Poel
+ *
+ * This file is part of MI-bicliques, https://github.com/TheoryInPractice/MI-bicliques,
+ * and is Copyright (C) North Carolina State University, 2018.
+ * It is licensed under the three-clause BSD license; see LICENSE.
+ */
+
+#include <array>
+#include <chrono>
+#include <queue>
+#include <vector>
+
+#include "ExactOCT.h"
+#include "SimpleOCT.h"
+
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+const size_t NONE = size_t(-1);
+const int INFINITE_CAPACITY = 1 << 30;
+
+
+/**
+ * Union-find over vertices that are to be 2-colored, recording for each
+ * vertex whether its color differs from that of its parent.
+ */
+class ParityForest {
+
+public:
+
+    ParityForest(size_t num_vertices) : parent(num_vertices), parity(num_vertices) {
+        reset();
+    }
+
+    void reset() {
+        for (size_t v = 0; v < parent.size(); v++) {
+            parent[v] = v;
+            parity[v] = 0;
+        }
+    }
+
+    // The root of v's tree, with v_parity set to whether v's color differs from it
+    size_t find(size_t v, unsigned char & v_parity) {
+        size_t root = v;
+        v_parity = 0;
+        while (parent[root] != root) {
+            v_parity ^= parity[root];
+            root = parent[root];
+        }
+        unsigned char x_parity = v_parity;
+        for (size_t x = v; parent[x] != root; ) {
+            size_t next = parent[x];
+            unsigned char old_parity = parity[x];
+            parent[x] = root;
+            parity[x] = x_parity;
+            x_parity ^= old_parity;
+            x = next;
+        }
+        return root;
+    }
+
+    // Require u and v to be colored differently; false if they must be alike
+    bool join(size_t u, size_t v) {
+        unsigned char u_parity, v_parity;
+        size_t u_root = find(u, u_parity);
+        size_t v_root = find(v, v_parity);
+        if (u_root == v_root) return u_parity != v_parity;
+        parent[u_root] = v_root;
+        parity[u_root] = u_parity ^ v_parity ^ 1;
+        return true;
+    }
+
+private:
+    std::vector<size_t> parent;
+    std::vector<unsigned char> parity;
+
+};
+
+
+/**
+ * The compression step (see above), over the subgraph of the vertices
+ * marked present.
+ */
+class OCTCompression {
+
+public:
+
+    OCTCompression(const Graph & g,
+                   const std::vector<bool> & present,
+                   Clock::time_point deadline) :
+                   g(g), present(present), deadline(deadline) {}
+
+    bool timed_out = false;
+
+    /**
+     * Look for an OCT set of size at most k, given the OCT set C of size
+     * k + 1; if found, put it in solution and return true.
+     */
+    bool compress(const std::vector<size_t> & C, size_t k, std::vector<size_t> & solution) {
+        build(C, k);
+        bool found = assign(0);
+        if (found) solution = found_solution;
+        return found;
+    }
+
+private:
+
+    enum { DELETED = 2, UNSET = 3 };
+
+    struct Arc {
+        size_t to;
+        int capacity;
+    };
+
+    const Graph & g;
+    const std::vector<bool> & present;
+    Clock::time_point deadline;
+    size_t leaves = 0;
+
+    std::vector<size_t> C;
+    size_t k = 0;
+    std::vector<size_t> c_index;
+    std::vector<unsigned char> state;
+    size_t num_deleted = 0;
+    size_t num_kept = 0;
+
+    // H = G - C, its vertices' positions and their 2-coloring col
+    std::vector<size_t> h_vertices;
+    std::vector<size_t> h_index;
+    std::vector<unsigned char> col;
+
+    // How many kept vertices need each vertex of H unflipped (0) and flipped (1)
+    std::vector<std::array<size_t, 2>> need;
+    size_t num_forced = 0;
+
+    // Flow network: vertex i of H is nodes 2i (in) and 2i + 1 (out); arcs
+    // come in pairs, arc e ^ 1 being the reverse of arc e
+    std::vector<Arc> arcs;
+    std::vector<int> base_capacity;
+    std::vector<std::vector<size_t>> node_arcs;
+    std::vector<size_t> vertex_arc, source_arc, sink_arc;
+    size_t source = 0, sink = 0;
+
+    std::vector<size_t> found_solution;
+
+    void add_arc(size_t from, size_t to, int capacity) {
+        node_arcs[from].push_back(arcs.size());
+        arcs.push_back(Arc{to, capacity});
+        node_arcs[to].push_back(arcs.size());
+        arcs.push_back(Arc{from, 0});
+    }
+
+    void build(const std::vector<size_t> & new_C, size_t new_k) {
+        C = new_C;
+        k = new_k;
+        size_t num_vertices = g.get_num_vertices();
+
+        c_index.assign(num_vertices, NONE);
+        for (size_t idx = 0; idx < C.size(); idx++) c_index[C[idx]] = idx;
+        state.assign(C.size(), UNSET);
+        num_deleted = 0;
+        num_kept = 0;
+
+        h_vertices.clear();
+        h_index.assign(num_vertices, NONE);
+        for (size_t v = 0; v < num_vertices; v++) {
+            if (!present[v] || c_index[v] != NONE) continue;
+            h_index[v] = h_vertices.size();
+            h_vertices.push_back(v);
+        }
+
+        // 2-color H by BFS
+        col.assign(h_vertices.size(), 2);
+        std::queue<size_t> vertex_queue;
+        for (size_t start = 0; start < h_vertices.size(); start++) {
+            if (col[start] != 2) continue;
+            col[start] = 0;
+            vertex_queue.push(start);
+            while (!vertex_queue.empty()) {
+                size_t i = vertex_queue.front();
+                vertex_queue.pop();
+                for (size_t u : g.get_neighbors_vector(h_vertices[i])) {
+                    size_t j = h_index[u];
+                    if (j == NONE || col[j] != 2) continue;
+                    col[j] = col[i] ^ 1;
+                    vertex_queue.push(j);
+                }
+            }
+        }
+
+        need.assign(h_vertices.size(), {{0, 0}});
+        num_forced = 0;
+
+        size_t num_nodes = 2 * h_vertices.size() + 2;
+        source = num_nodes - 2;
+        sink = num_nodes - 1;
+        arcs.clear();
+        node_arcs.assign(num_nodes, std::vector<size_t>());
+        vertex_arc.resize(h_vertices.size());
+        source_arc.resize(h_vertices.size());
+        sink_arc.resize(h_vertices.size());
+        for (size_t i = 0; i < h_vertices.size(); i++) {
+            vertex_arc[i] = arcs.size();
+            add_arc(2 * i, 2 * i + 1, 1);
+            source_arc[i] = arcs.size();
+            add_arc(source, 2 * i, 0);
+            sink_arc[i] = arcs.size();
+            add_arc(2 * i + 1, sink, 0);
+            for (size_t u : g.get_neighbors_vector(h_vertices[i])) {
+                size_t j = h_index[u];
+                if (j != NONE) add_arc(2 * i + 1, 2 * j, INFINITE_CAPACITY);
+            }
+        }
+        base_capacity.resize(arcs.size());
+        for (size_t e = 0; e < arcs.size(); e++) base_capacity[e] = arcs[e].capacity;
+    }
+
+    // Keep C[idx] colored color, updating what its neighbors in H need
+    void keep(size_t idx, unsigned char color) {
+        state[idx] = color;
+        num_kept++;
+        for (size_t u : g.get_neighbors_vector(C[idx])) {
+            size_t j = h_index[u];
+            if (j == NONE) continue;
+            size_t flip = (1 - color) ^ col[j];
+            if (need[j][flip]++ == 0 && need[j][flip ^ 1] > 0) num_forced++;
+        }
+    }
+
+    void unkeep(size_t idx) {
+        unsigned char color = state[idx];
+        for (size_t u : g.get_neighbors_vector(C[idx])) {
+            size_t j = h_index[u];
+            if (j == NONE) continue;
+            size_t flip = (1 - color) ^ col[j];
+            if (--need[j][flip] == 0 && need[j][flip ^ 1] > 0) num_forced--;
+        }
+        num_kept--;
+        state[idx] = UNSET;
+    }
+
+    // Whether C[idx] has a kept neighbor in C colored color
+    bool conflicts(size_t idx, unsigned char color) const {
+        for (size_t u : g.get_neighbors_vector(C[idx])) {
+            size_t other = c_index[u];
+            if (other != NONE && state[other] == color) return true;
+        }
+        return false;
+    }
+
+    // Enumerate the choices for C[idx], C[idx + 1], ...
+    bool assign(size_t idx) {
+        if (timed_out) return false;
+        if (idx == C.size()) return cut();
+
+        for (unsigned char color = 0; color < 2; color++) {
+            // Swapping every color gives the same problem
+            if (color == 1 && num_kept == 0) continue;
+            if (conflicts(idx, color)) continue;
+            keep(idx, color);
+            if (num_deleted + num_forced <= k && assign(idx + 1)) return true;
+            unkeep(idx);
+        }
+
+        if (num_deleted + num_forced < k) {
+            state[idx] = DELETED;
+            num_deleted++;
+            if (assign(idx + 1)) return true;
+            num_deleted--;
+            state[idx] = UNSET;
+        }
+        return false;
+    }
+
+    /**
+     * With every vertex of C deleted or colored, look for a small enough
+     * vertex cut between the vertices of H needing a flip and those needing
+     * none, and if found, record the solution.
+     */
+    bool cut() {
+        if ((++leaves & 255) == 0 && Clock::now() >= deadline) {
+            timed_out = true;
+            return false;
+        }
+
+        size_t budget = k - num_deleted - num_forced;
+        for (size_t e = 0; e < arcs.size(); e++) arcs[e].capacity = base_capacity[e];
+        for (size_t i = 0; i < h_vertices.size(); i++) {
+            if (need[i][0] > 0 && need[i][1] > 0) arcs[vertex_arc[i]].capacity = 0;
+            else if (need[i][0] > 0) arcs[source_arc[i]].capacity = INFINITE_CAPACITY;
+            else if (need[i][1] > 0) arcs[sink_arc[i]].capacity = INFINITE_CAPACITY;
+        }
+
+        std::vector<size_t> parent_arc(arcs.size());
+        std::vector<bool> reached;
+        for (size_t flow = 0; ; flow++) {
+            reached = reach_from_source(parent_arc);
+            if (!reached[sink]) break;
+            if (flow == budget) return false;
+            for (size_t node = sink; node != source; node = arcs[parent_arc[node] ^ 1].to) {
+                arcs[parent_arc[node]].capacity--;
+                arcs[parent_arc[node] ^ 1].capacity++;
+            }
+        }
+
+        found_solution.clear();
+        for (size_t idx = 0; idx < C.size(); idx++) {
+            if (state[idx] == DELETED) found_solution.push_back(C[idx]);
+        }
+        for (size_t i = 0; i < h_vertices.size(); i++) {
+            bool forced = need[i][0] > 0 && need[i][1] > 0;
+            bool in_cut = reached[2 * i] && !reached[2 * i + 1];
+            if (forced || in_cut) found_solution.push_back(h_vertices[i]);
+        }
+        return true;
+    }
+
+    // Nodes reachable from the source in the residual network, by BFS
+    std::vector<bool> reach_from_source(std::vector<size_t> & parent_arc) const {
+        std::vector<bool> reached(node_arcs.size(), false);
+        std::queue<size_t> node_queue;
+        reached[source] = true;
+        node_queue.push(source);
+        while (!node_queue.empty() && !reached[sink]) {
+            size_t node = node_queue.front();
+            node_queue.pop();
+            for (size_t e : node_arcs[node]) {
+                const Arc & arc = arcs[e];
+                if (arc.capacity <= 0 || reached[arc.to]) continue;
+                reached[arc.to] = true;
+                parent_arc[arc.to] = e;
+                node_queue.push(arc.to);
+            }
+        }
+        return reached;
+    }
+
+};
+
+}
+
+
+/**
+ * Compute a minimum OCT decomposition of g by iterative compression (see
+ * above), in at most time_cap seconds.
+ *
+ * @param g               Graph to decompose.
+ * @param oct_set         If not empty, an OCT set of g, used to order the
+ *                        vertices; replaced by a minimum OCT set.
+ * @param left_partition  Left partition found, with every isolated vertex.
+ * @param right_partition Right partition found.
+ * @param time_cap        Seconds to search for.
+ * @return                False, leaving the sets unchanged, if time ran out.
+ */
+bool exactoct(const Graph & g,
+              OrderedVertexSet & oct_set,
+              OrderedVertexSet & left_partition,
+              OrderedVertexSet & right_partition,
+              double time_cap) {
+
+    Clock::time_point deadline = Clock::now() +
+        std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(time_cap));
+    size_t num_vertices = g.get_num_vertices();
+
+    // Vertices outside a known OCT set go first
+    OrderedVertexSet known_oct = oct_set;
+    if (known_oct.size() == 0) {
+        OrderedVertexSet temp_left, temp_right;
+        simpleoct(g, known_oct, temp_left, temp_right);
+    }
+    std::vector<size_t> order;
+    for (size_t v = 0; v < num_vertices; v++) {
+        if (!known_oct.has_vertex(v)) order.push_back(v);
+    }
+    order.insert(order.end(), known_oct.begin(), known_oct.end());
+
+    std::vector<bool> present(num_vertices, false);
+    std::vector<bool> in_solution(num_vertices, false);
+    std::vector<size_t> solution;
+    ParityForest forest(num_vertices);
+    OCTCompression compression(g, present, deadline);
+
+    for (size_t v : order) {
+        present[v] = true;
+
+        bool bipartite = true;
+        for (size_t u : g.get_neighbors_vector(v)) {
+            if (present[u] && !in_solution[u] && !forest.join(v, u)) {
+                bipartite = false;
+                break;
+            }
+        }
+        if (bipartite) continue;
+
+        if (Clock::now() >= deadline) return false;
+
+        std::vector<size_t> C(solution);
+        C.push_back(v);
+        std::vector<size_t> smaller;
+        if (compression.compress(C, solution.size(), smaller)) C = smaller;
+        else if (compression.timed_out) return false;
+
+        for (size_t u : solution) in_solution[u] = false;
+        solution = C;
+        for (size_t u : solution) in_solution[u] = true;
+
+        // The forest may hold part of v's edges; rebuild it
+        forest.reset();
+        for (size_t w = 0; w < num_vertices; w++) {
+            if (!present[w] || in_solution[w]) continue;
+            for (size_t u : g.get_neighbors_vector(w)) {
+                if (u < w && present[u] && !in_solution[u]) forest.join(w, u);
+            }
+        }
+    }
+
+    // 2-color the rest by BFS
+    std::vector<unsigned char> color(num_vertices, 2);
+    std::queue<size_t> vertex_queue;
+    for (size_t start = 0; start < num_vertices; start++) {
+        if (in_solution[start] || color[start] != 2) continue;
+        color[start] = 0;
+        vertex_queue.push(start);
+        while (!vertex_queue.empty()) {
+            size_t v = vertex_queue.front();
+            vertex_queue.pop();
+            for (size_t u : g.get_neighbors_vector(v)) {
+                if (in_solution[u] || color[u] != 2) continue;
+                color[u] = color[v] ^ 1;
+                vertex_queue.push(u);
+            }
+        }
+    }
+
+    oct_set = OrderedVertexSet();
+    left_partition = OrderedVertexSet();
+    right_partition = OrderedVertexSet();
+    for (size_t v = 0; v < num_vertices; v++) {
+        if (in_solution[v]) oct_set.add_vertex_unsafe(v);
+        else if (color[v] == 0) left_partition.add_vertex_unsafe(v);
+        else right_partition.add_vertex_unsafe(v);
+    }
+    return true;
+
+}
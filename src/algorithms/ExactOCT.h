@@ -0,0 +1,26 @@
+/**
+ * exactoct finds a minimum OCT decomposition by iterative compression. See
+ * ExactOCT.cpp for full documentation.
+ *
+ * @authors Eric Horton, Kyle Kloster, Drew van der Poel
+ *
+ * This file is part of MI-bicliques, https://github.com/TheoryInPractice/MI-bicliques,
+ * and is Copyright (C) North Carolina State University, 2018.
+ * It is licensed under the three-clause BSD license; see LICENSE.
+ */
+
+#ifndef BICLIQUES_EXACTOCT_H
+#define BICLIQUES_EXACTOCT_H
+
+#include "../graph/OrderedVertexSet.h"
+#include "../graph/Graph.h"
+
+
+bool exactoct(const Graph & g,
+              OrderedVertexSet & oct_set,
+              OrderedVertexSet & left_partition,
+              OrderedVertexSet & right_partition,
+              double time_cap);
+
+
+#endif //BICLIQUES_EXACTOCT_H
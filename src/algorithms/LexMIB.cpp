@@ -19,6 +19,7 @@
 */
 
 #include "LexMIB.h"
+#include "ComponentScheduler.h"
 #include "SimpleCCs.h"
 
 
@@ -301,34 +302,37 @@ void lexmib_cc(LexMIBResults & lexmibresults,
  */
 void lexmib(LexMIBResults & lexmibresults, const Graph & g) {
 
-    // Determine connected components
-    auto vector_of_ccs = simpleccs(g);
+    // Determine connected components (of the core left after size-constraint
+    // peeling, if any size constraints are in place)
+    auto vector_of_ccs = simpleccs(g, lexmibresults.size_constraints.min_degree());
 
-    if (vector_of_ccs.size() > 1) {
-        // run algorithm on each CC
-        for (size_t which_cc = 0; which_cc < vector_of_ccs.size(); which_cc++) {
+    // Peeled vertices also force the per-CC path, as the core is a proper subgraph
+    if (vector_of_ccs.size() != 1 || vector_of_ccs.front().size() < g.get_num_vertices()) {
+        // run algorithm on each CC, possibly several at once
+        run_components(lexmibresults, vector_of_ccs,
+                       [&](LexMIBResults & cc_results, size_t which_cc, std::ostream &) {
 
-            const std::vector<size_t> vertex_subset = vector_of_ccs[which_cc];
+            const std::vector<size_t> & vertex_subset = vector_of_ccs[which_cc];
 
             // Skip isolated vertices and empty sets
-            if (vertex_subset.size() <= 1) continue;
+            if (vertex_subset.size() <= 1) return;
 
             // Isolated edges are MIBs
             if (vertex_subset.size() == 2) {
-                lexmibresults.relabeling_mode = false;
+                cc_results.relabeling_mode = false;
                 BicliqueLite temp((std::vector<size_t>){vertex_subset.front()},
                              (std::vector<size_t>){vertex_subset.back()});
-                lexmibresults.push_back(temp);
-                continue;
+                cc_results.push_back(temp);
+                return;
             }
 
             Graph g_cc = g.subgraph(vertex_subset);
 
             // Call main LexMIB function
-            lexmibresults.turn_on_relabeling_mode(vertex_subset);
-            lexmib_cc(lexmibresults, g_cc);
+            cc_results.turn_on_relabeling_mode(vertex_subset);
+            lexmib_cc(cc_results, g_cc);
 
-        }
+        });
     }
     else {
         lexmib_cc(lexmibresults, g);
@@ -15,6 +15,7 @@
 #include "../graph/BicliqueLite.h"
 #include "../graph/Graph.h"
 #include "../graph/OrderedVector.h"
+#include "../graph/SizeConstraints.h"
 
 
 
@@ -30,8 +31,16 @@ struct LexMIBResults {
     bool count_only_mode = false;
     bool relabeling_mode = false;
 
+    // Number of worker threads, and whether parallel runs must output MIBs
+    // in the same order as serial ones
+    size_t num_threads = 1;
+    bool deterministic_mode = false;
+
     double time_ccs = 0.0;
 
+    // Only bicliques satisfying these bounds are counted and recorded
+    SizeConstraints size_constraints;
+
     size_t total_num_mibs = 0;
 
     size_t n = 0;
@@ -56,7 +65,29 @@ struct LexMIBResults {
         if (print_mode) output_file.close();
     }
 
+    /**
+     * Set up `shard` to record one connected component on a worker thread.
+     */
+    void configure_shard(LexMIBResults & shard) const {
+        shard.size_constraints = size_constraints;
+        shard.count_only_mode = count_only_mode;
+    }
+
+    /**
+     * Move the MIBs of `shard`, already relabeled to this graph, into this
+     * object, printing them if print mode is on.
+     */
+    void merge(LexMIBResults & shard) {
+        total_num_mibs += shard.total_num_mibs;
+        for (auto & this_mib : shard.mibs_computed) {
+            if (print_mode) output_file << this_mib.to_string_persistent() << std::endl;
+            else mibs_computed.push_back(std::move(this_mib));
+        }
+        shard.mibs_computed.clear();
+    }
+
     void push_back(BicliqueLite this_mib) {
+        if (!size_constraints.is_satisfied_by(this_mib)) return;
         // increment number of mibs regardless of mode
         total_num_mibs++;
 
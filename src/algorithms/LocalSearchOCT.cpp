@@ -0,0 +1,358 @@
+/**
+ * localsearchoct computes an OCT decomposition by local search over
+ * 3-colorings of the graph into left, right and OCT vertices.
+ *
+ * The first run starts from the coloring simpleoct finds, and later runs
+ * (restarts) from a BFS coloring grown from randomly ordered roots. Each run
+ * repeatedly
+ *
+ * - returns to the left or right any OCT vertex with no neighbors there
+ *   (redundancy removal), which is the only step that shrinks the OCT set;
+ * - takes an OCT vertex v with a single neighbor u on one side, and puts v
+ *   there instead of u: u moves to the other side if it has no neighbors
+ *   there (a vertex move, which shrinks the OCT set) and to the OCT set if it
+ *   does (a swap, which keeps its size); and
+ * - now and then puts an OCT vertex with two neighbors on a side there, and
+ *   those neighbors in the OCT set, to leave a local minimum.
+ *
+ * A vertex just moved is not swapped out again for a few steps. A run ends
+ * once it has gone many steps without finding a smaller OCT set than its
+ * best, or the time budget (shared by all runs) is spent. The smallest OCT
+ * set found is returned, so the result is never larger than simpleoct's.
+ *
+ * simpleoct can stop before coloring every component of a graph with more
+ * than one, leaving edges within its left partition; the first run repairs
+ * such a coloring before searching from it.
+ *
+ * @authors Eric Horton, Kyle Kloster, Drew van der Poel
+ *
+ * This file is part of MI-bicliques, https://github.com/TheoryInPractice/MI-bicliques,
+ * and is Copyright (C) North Carolina State University, 2018.
+ * It is licensed under the three-clause BSD license; see LICENSE.
+ */
+
+#include <algorithm> // for std::max, std::shuffle
+#include <array>
+#include <chrono>
+#include <queue>
+#include <random>
+#include <vector>
+
+#include "LocalSearchOCT.h"
+#include "SimpleOCT.h"
+
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+enum Side : unsigned char { LEFT = 0, RIGHT = 1, OCT = 2 };
+
+// Steps a vertex is left alone after moving
+const size_t TABU_TENURE = 7;
+
+// One in this many steps from an OCT vertex with two neighbors on a side
+// takes it anyway
+const size_t KICK_ODDS = 16;
+
+
+/**
+ * A coloring of the vertices into left, right and OCT, with the number of
+ * neighbors each vertex has on the left and on the right.
+ */
+class OCTColoring {
+
+public:
+
+    OCTColoring(const Graph & g) : g(g),
+                                   side(g.get_num_vertices(), OCT),
+                                   neighbors_on(g.get_num_vertices(), {{0, 0}}),
+                                   oct_position(g.get_num_vertices()) {
+        for (size_t v = 0; v < side.size(); v++) {
+            oct_position[v] = v;
+            oct_vertices.push_back(v);
+        }
+    }
+
+    inline size_t oct_size() const { return oct_vertices.size(); }
+
+    void set_side(size_t v, Side s) {
+        Side old = side[v];
+        if (old == s) return;
+        for (size_t u : g.get_neighbors_vector(v)) {
+            if (old != OCT) neighbors_on[u][old]--;
+            if (s != OCT) neighbors_on[u][s]++;
+        }
+        if (old == OCT) {
+            size_t last = oct_vertices.back();
+            oct_vertices[oct_position[v]] = last;
+            oct_position[last] = oct_position[v];
+            oct_vertices.pop_back();
+        }
+        if (s == OCT) {
+            oct_position[v] = oct_vertices.size();
+            oct_vertices.push_back(v);
+        }
+        side[v] = s;
+    }
+
+    /**
+     * Color the vertices as given, then move to the OCT set any vertex with
+     * a neighbor on its own side, so that the coloring is valid.
+     */
+    void assign(const std::vector<Side> & sides) {
+        for (size_t v = 0; v < sides.size(); v++) set_side(v, sides[v]);
+        for (size_t v = 0; v < sides.size(); v++) {
+            if (side[v] != OCT && neighbors_on[v][side[v]] > 0) set_side(v, OCT);
+        }
+    }
+
+    /**
+     * Color the vertices by BFS from roots in random order, as simpleoct
+     * does: each vertex goes to a side none of its neighbors are on yet,
+     * or to the OCT set if there is none.
+     */
+    void assign_bfs(std::mt19937_64 & generator) {
+        for (size_t v = 0; v < side.size(); v++) set_side(v, OCT);
+
+        std::vector<size_t> roots(side.size());
+        for (size_t v = 0; v < roots.size(); v++) roots[v] = v;
+        std::shuffle(roots.begin(), roots.end(), generator);
+
+        std::vector<bool> visited(side.size(), false);
+        std::queue<size_t> vertex_queue;
+        for (size_t root : roots) {
+            if (visited[root]) continue;
+            visited[root] = true;
+            vertex_queue.push(root);
+            while (!vertex_queue.empty()) {
+                size_t v = vertex_queue.front();
+                vertex_queue.pop();
+                if (neighbors_on[v][LEFT] == 0) set_side(v, LEFT);
+                else if (neighbors_on[v][RIGHT] == 0) set_side(v, RIGHT);
+                for (size_t u : g.get_neighbors_vector(v)) {
+                    if (visited[u]) continue;
+                    visited[u] = true;
+                    vertex_queue.push(u);
+                }
+            }
+        }
+    }
+
+    /**
+     * Return each of the given vertices that is in the OCT set to a side it
+     * has no neighbors on, if any.
+     */
+    void release(std::vector<size_t> & candidates) {
+        while (!candidates.empty()) {
+            size_t v = candidates.back();
+            candidates.pop_back();
+            if (side[v] != OCT) continue;
+            if (neighbors_on[v][LEFT] == 0) set_side(v, LEFT);
+            else if (neighbors_on[v][RIGHT] == 0) set_side(v, RIGHT);
+        }
+    }
+
+    // Take u off its side, and release the OCT vertices it was blocking
+    void vacate(size_t u, Side s, std::vector<size_t> & candidates) {
+        set_side(u, s);
+        for (size_t w : g.get_neighbors_vector(u)) {
+            if (side[w] == OCT) candidates.push_back(w);
+        }
+    }
+
+    /**
+     * Local search from the current coloring, until max_stale steps pass
+     * without improving on the best coloring seen, or the deadline. Leaves
+     * the best coloring in best_sides and returns its OCT size.
+     */
+    size_t search(std::mt19937_64 & generator,
+                  size_t max_stale,
+                  Clock::time_point deadline,
+                  std::vector<Side> & best_sides) {
+
+        std::vector<size_t> candidates(oct_vertices);
+        release(candidates);
+
+        best_sides = side;
+        size_t best_size = oct_size();
+
+        std::vector<size_t> last_moved(side.size(), 0);
+        size_t step = 0;
+        size_t stale = 0;
+
+        while (stale < max_stale && oct_size() > 0) {
+
+            // Checking the clock on every step would cost more than the step
+            if ((step & 255) == 0 && Clock::now() >= deadline) break;
+            step++;
+            stale++;
+
+            size_t v = oct_vertices[generator() % oct_vertices.size()];
+
+            // Try the side v has fewer neighbors on
+            Side s = (neighbors_on[v][LEFT] < neighbors_on[v][RIGHT]) ? LEFT : RIGHT;
+            if (neighbors_on[v][LEFT] == neighbors_on[v][RIGHT]) s = (generator() % 2) ? LEFT : RIGHT;
+            Side other = (s == LEFT) ? RIGHT : LEFT;
+            size_t conflicts = neighbors_on[v][s];
+
+            if (conflicts > 2 || (conflicts == 2 && generator() % KICK_ODDS != 0)) continue;
+
+            std::vector<size_t> blocking;
+            for (size_t u : g.get_neighbors_vector(v)) {
+                if (side[u] == s) blocking.push_back(u);
+            }
+            if (conflicts == 1 && last_moved[blocking.front()] + TABU_TENURE > step) continue;
+
+            for (size_t u : blocking) {
+                vacate(u, neighbors_on[u][other] == 0 ? other : OCT, candidates);
+                last_moved[u] = step;
+            }
+            set_side(v, s);
+            last_moved[v] = step;
+            release(candidates);
+
+            if (oct_size() < best_size) {
+                best_size = oct_size();
+                best_sides = side;
+                stale = 0;
+            }
+        }
+
+        return best_size;
+
+    }
+
+private:
+
+    const Graph & g;
+    std::vector<Side> side;
+    std::vector<std::array<size_t, 2>> neighbors_on;
+    std::vector<size_t> oct_vertices;
+    std::vector<size_t> oct_position;
+
+};
+
+
+// Split the vertices into oct_set, left_partition and right_partition by side
+void set_decomposition(const std::vector<Side> & sides,
+                       OrderedVertexSet & oct_set,
+                       OrderedVertexSet & left_partition,
+                       OrderedVertexSet & right_partition) {
+    oct_set = OrderedVertexSet();
+    left_partition = OrderedVertexSet();
+    right_partition = OrderedVertexSet();
+    for (size_t v = 0; v < sides.size(); v++) {
+        if (sides[v] == LEFT) left_partition.add_vertex_unsafe(v);
+        else if (sides[v] == RIGHT) right_partition.add_vertex_unsafe(v);
+        else oct_set.add_vertex_unsafe(v);
+    }
+}
+
+}
+
+
+/**
+ * Compute an OCT decomposition of g by local search (see above), spending at
+ * most options.time_budget seconds over options.num_restarts runs seeded
+ * from options.seed. If oct_set is prescribed, or the options are not
+ * active, this is simpleoct.
+ *
+ * @param g               Graph to decompose.
+ * @param oct_set         OCT set found; if not empty, kept as it is.
+ * @param left_partition  Left partition found, with every isolated vertex.
+ * @param right_partition Right partition found.
+ * @param options         Time budget, number of runs and random seed.
+ */
+void localsearchoct(const Graph & g,
+                    OrderedVertexSet & oct_set,
+                    OrderedVertexSet & left_partition,
+                    OrderedVertexSet & right_partition,
+                    const OCTSearchOptions & options) {
+
+    if (oct_set.size() > 0 || !options.is_active()) {
+        simpleoct(g, oct_set, left_partition, right_partition);
+        return;
+    }
+
+    Clock::time_point deadline = Clock::now() +
+        std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(options.time_budget));
+
+    simpleoct(g, oct_set, left_partition, right_partition);
+
+    size_t num_vertices = g.get_num_vertices();
+    std::vector<Side> start_sides(num_vertices, LEFT);
+    for (size_t v : right_partition) start_sides[v] = RIGHT;
+    for (size_t v : oct_set) start_sides[v] = OCT;
+
+    std::mt19937_64 generator(options.seed);
+    size_t max_stale = std::max<size_t>(1000, 20 * num_vertices);
+    OCTColoring coloring(g);
+    std::vector<Side> best_sides, run_sides;
+    size_t best_size = num_vertices + 1;
+
+    for (size_t run = 0; run < std::max<size_t>(options.num_restarts, 1); run++) {
+        if (run > 0 && Clock::now() >= deadline) break;
+
+        if (run == 0) coloring.assign(start_sides);
+        else coloring.assign_bfs(generator);
+
+        size_t run_size = coloring.search(generator, max_stale, deadline, run_sides);
+        if (run_size < best_size) {
+            best_size = run_size;
+            best_sides = run_sides;
+        }
+        if (best_size == 0) break;
+    }
+
+    set_decomposition(best_sides, oct_set, left_partition, right_partition);
+
+}
+
+
+/**
+ * Compute an OCT decomposition of g by a single run of local search (see
+ * above), from simpleoct's coloring or from a BFS coloring grown from roots
+ * in random order, searching for at most time_budget seconds; with no time
+ * budget, only OCT vertices with no neighbors on a side are returned to it.
+ *
+ * @param g               Graph to decompose.
+ * @param oct_set         OCT set found.
+ * @param left_partition  Left partition found.
+ * @param right_partition Right partition found.
+ * @param random_start    Whether to start from a random coloring.
+ * @param seed            Seed of the random root order and search.
+ * @param time_budget     Seconds to search for.
+ */
+void localsearchoct_run(const Graph & g,
+                        OrderedVertexSet & oct_set,
+                        OrderedVertexSet & left_partition,
+                        OrderedVertexSet & right_partition,
+                        bool random_start,
+                        unsigned long seed,
+                        double time_budget) {
+
+    Clock::time_point deadline = Clock::now() +
+        std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(time_budget));
+
+    std::mt19937_64 generator(seed);
+    size_t max_stale = (time_budget > 0) ? std::max<size_t>(1000, 20 * g.get_num_vertices()) : 0;
+    OCTColoring coloring(g);
+    std::vector<Side> best_sides;
+
+    if (random_start) {
+        coloring.assign_bfs(generator);
+    }
+    else {
+        OrderedVertexSet simple_oct, simple_left, simple_right;
+        simpleoct(g, simple_oct, simple_left, simple_right);
+        std::vector<Side> start_sides(g.get_num_vertices(), LEFT);
+        for (size_t v : simple_right) start_sides[v] = RIGHT;
+        for (size_t v : simple_oct) start_sides[v] = OCT;
+        coloring.assign(start_sides);
+    }
+    coloring.search(generator, max_stale, deadline, best_sides);
+
+    set_decomposition(best_sides, oct_set, left_partition, right_partition);
+
+}
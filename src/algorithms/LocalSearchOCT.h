@@ -0,0 +1,35 @@
+/**
+ * localsearchoct finds an OCT decomposition like simpleoct, then shrinks the
+ * OCT set by local search; localsearchoct_run is a single run of it. See LocalSearchOCT.cpp for full documentation.
+ *
+ * @authors Eric Horton, Kyle Kloster, Drew van der Poel
+ *
+ * This file is part of MI-bicliques, https://github.com/TheoryInPractice/MI-bicliques,
+ * and is Copyright (C) North Carolina State University, 2018.
+ * It is licensed under the three-clause BSD license; see LICENSE.
+ */
+
+#ifndef BICLIQUES_LOCALSEARCHOCT_H
+#define BICLIQUES_LOCALSEARCHOCT_H
+
+#include "../graph/OrderedVertexSet.h"
+#include "../graph/Graph.h"
+#include "OCTDecomposition.h"
+
+
+void localsearchoct(const Graph & g,
+                    OrderedVertexSet & oct_set,
+                    OrderedVertexSet & left_partition,
+                    OrderedVertexSet & right_partition,
+                    const OCTSearchOptions & options);
+
+void localsearchoct_run(const Graph & g,
+                        OrderedVertexSet & oct_set,
+                        OrderedVertexSet & left_partition,
+                        OrderedVertexSet & right_partition,
+                        bool random_start,
+                        unsigned long seed,
+                        double time_budget);
+
+
+#endif //BICLIQUES_LOCALSEARCHOCT_H
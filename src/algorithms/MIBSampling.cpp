@@ -0,0 +1,524 @@
+/**
+* @authors Eric Horton, Kyle Kloster, Drew van der Poel
+*
+* This file is part of MI-bicliques, https://github.com/TheoryInPractice/MI-bicliques,
+* and is Copyright (C) North Carolina State University, 2018.
+* It is licensed under the three-clause BSD license; see LICENSE.
+*/
+
+#include <algorithm> // for std::includes
+#include <ctime> // for timing
+#include <iostream>
+#include <map>
+#include <memory>
+#include <random>
+
+#include "MIBSampling.h"
+#include "OCTMIB.h"
+#include "MaximalCrossingBicliquesBipartite.h"
+#include "SimpleCCs.h"
+#include "GraphOrdering.h"
+
+#include "../graph/OctGraph.h"
+#include "../graph/SearchTreeBag.h"
+#include "../graph/SearchTreeBagPlus.h"
+
+
+/**
+ * The search forest explored by OCT-MIB on one connected component: the MCBB
+ * trees on the bipartite graph g - OCT, and one tree for each vertex v of
+ * each maximal independent set of the OCT set.
+ */
+struct SamplingComponent {
+
+    // Labels of this component's vertices in the input graph
+    std::vector<size_t> vertex_subset;
+
+    std::shared_ptr<OctGraph> og;
+    std::shared_ptr<Graph> graph_ptr;
+
+    // MCBB trees run on g - OCT, reordered by degree; bipartite_labels maps
+    // labels of that graph back to labels of og
+    std::shared_ptr<Graph> bipartite_graph_ptr;
+    std::vector<size_t> bipartite_labels;
+    std::vector<size_t> bipartite_independent_set;
+
+    std::vector<std::vector<size_t>> all_mis_in_oct;
+
+    // Index in the forest of the root for (MIS index, vertex), and the
+    // canonical root of each MIB of this component seen so far
+    std::map<std::pair<size_t,size_t>, size_t> oct_roots;
+    std::unordered_map<std::string, size_t> canonical_roots;
+};
+
+
+/**
+ * A root of the search forest. For an OCT root, bag caches its initial bag
+ * and root_mibs the MIBs output while building it.
+ */
+struct SamplingRoot {
+
+    enum class ROOT_TYPE {EDGE, MCBB, OCT};
+
+    ROOT_TYPE root_type;
+    size_t component;
+    size_t mis_index = 0;
+    size_t vertex = 0;
+
+    bool built = false;
+    SearchTreeBag bag;
+    std::vector<BicliqueLite> root_mibs;
+};
+
+
+/**
+ * Build the search forest of one connected component.
+ */
+void add_sampling_component(std::vector<SamplingComponent> & components,
+                            std::vector<SamplingRoot> & roots,
+                            const Graph & g_cc,
+                            std::vector<size_t> vertex_subset,
+                            OrderedVertexSet oct_set,
+                            OrderedVertexSet left_set,
+                            OrderedVertexSet right_set) {
+
+    SamplingComponent component;
+    component.vertex_subset = std::move(vertex_subset);
+
+    // Determine the OCT decomposition as in octmib_cc
+    if (oct_set.size() == 0 || left_set.size() == 0) {
+        simpleoct(g_cc, oct_set, left_set, right_set);
+    }
+    else if (right_set.size() == 0) {
+        for (size_t idx = 0; idx < g_cc.get_num_vertices(); idx++) {
+            if (oct_set.has_vertex(idx) || left_set.has_vertex(idx)) continue;
+            right_set.add_vertex_unsafe(idx);
+        }
+    }
+
+    component.og = std::make_shared<OctGraph>(g_cc, oct_set, left_set, right_set);
+    component.graph_ptr = std::make_shared<Graph>(*component.og);
+
+    // Bipartite part, relabeled as maximal_crossing_bicliques_bipartite does
+    OrderedVector non_oct_vertices(OrderedVector(left_set.get_vertices()).set_union(right_set.get_vertices()));
+    Graph g_minus_oct = component.og->subgraph(non_oct_vertices);
+
+    const auto vertex_ordering = degree_reordering(g_minus_oct);
+    component.bipartite_graph_ptr = std::make_shared<Graph>(g_minus_oct.subgraph(vertex_ordering));
+
+    std::vector<size_t> reverse_ordering(vertex_ordering.size());
+    std::vector<size_t> bipartite_left, bipartite_right;
+    for (size_t idx = 0; idx < vertex_ordering.size(); idx++) {
+        reverse_ordering[vertex_ordering[idx]] = idx;
+        component.bipartite_labels.push_back(non_oct_vertices[vertex_ordering[idx]]);
+    }
+    for (size_t idx = 0; idx < non_oct_vertices.size(); idx++) {
+        if (left_set.has_vertex(non_oct_vertices[idx])) {
+            bipartite_left.push_back(reverse_ordering[idx]);
+        }
+        else bipartite_right.push_back(reverse_ordering[idx]);
+    }
+    std::sort(bipartite_left.begin(), bipartite_left.end());
+    std::sort(bipartite_right.begin(), bipartite_right.end());
+
+    component.bipartite_independent_set =
+        (bipartite_left.size() > bipartite_right.size()) ? bipartite_right : bipartite_left;
+
+    // OCT part
+    if (oct_set.size() > 0) {
+        auto oct_subgraph = component.og->subgraph(oct_set);
+        component.all_mis_in_oct = get_all_mis(oct_subgraph);
+        convert_node_labels_vector_inplace(component.all_mis_in_oct, oct_set);
+        for (auto & mis : component.all_mis_in_oct) std::sort(mis.begin(), mis.end());
+        std::sort(component.all_mis_in_oct.begin(), component.all_mis_in_oct.end());
+    }
+
+    size_t which_component = components.size();
+    for (auto vertex : component.bipartite_independent_set) {
+        SamplingRoot root;
+        root.root_type = SamplingRoot::ROOT_TYPE::MCBB;
+        root.component = which_component;
+        root.vertex = vertex;
+        roots.push_back(std::move(root));
+    }
+    for (size_t mis_index = 0; mis_index < component.all_mis_in_oct.size(); mis_index++) {
+        for (auto vertex : component.all_mis_in_oct[mis_index]) {
+            SamplingRoot root;
+            root.root_type = SamplingRoot::ROOT_TYPE::OCT;
+            root.component = which_component;
+            root.mis_index = mis_index;
+            root.vertex = vertex;
+            component.oct_roots[std::make_pair(mis_index, vertex)] = roots.size();
+            roots.push_back(std::move(root));
+        }
+    }
+
+    components.push_back(std::move(component));
+}
+
+
+/**
+ * Build an OCT root's initial bag, and the MIBs output while building it,
+ * the first time a sample reaches it.
+ */
+void build_oct_root(MIBSampleResults & sample_results,
+                    SamplingComponent & component,
+                    SamplingRoot & root) {
+
+    clock_t begin = std::clock();
+
+    OutputOptions step_results;
+    step_results.size_constraints = sample_results.size_constraints;
+    step_results.mis_cache = sample_results.mis_cache;
+
+    OrderedVector mis_in_oct(component.all_mis_in_oct[root.mis_index]);
+    root.bag = octmib_initial_bag(step_results, *component.og, component.graph_ptr,
+                                  mis_in_oct, root.vertex);
+
+    DuplicatesTable duplicates_table;
+    octmib_record_initial_bag(step_results, root.bag, duplicates_table);
+
+    root.root_mibs = std::move(step_results.mibs_computed);
+
+    root.built = true;
+    sample_results.num_roots_built++;
+
+    clock_t end = std::clock();
+    sample_results.time_roots += double(end - begin) / CLOCKS_PER_SEC;
+}
+
+
+/**
+ * Check whether root, an OCT root, outputs mib: descend from the root along
+ * the vertices of side_oct, the OCT vertices on the root's side of mib, to
+ * the one bag that can output it.
+ */
+bool is_found_at_root(MIBSampleResults & sample_results,
+                      SamplingComponent & component,
+                      SamplingRoot & root,
+                      const std::string & mib_string,
+                      const std::vector<size_t> & side_oct) {
+
+    if (!root.built) build_oct_root(sample_results, component, root);
+
+    if (side_oct.size() == 1) {
+        for (auto & mib : root.root_mibs) {
+            if (mib.to_string() == mib_string) return true;
+        }
+        return false;
+    }
+
+    OutputOptions step_results;
+    step_results.size_constraints = sample_results.size_constraints;
+
+    SearchTreeBag current_bag = root.bag;
+
+    for (size_t idx = 1; idx < side_oct.size(); idx++) {
+
+        SearchTreeStack<SearchTreeBag> children;
+        DuplicatesTable duplicates_table;
+        octmib_expand_bag(step_results, current_bag, duplicates_table, children);
+
+        if (idx + 1 == side_oct.size()) {
+            for (auto & mib : step_results.mibs_computed) {
+                if (mib.to_string() == mib_string) return true;
+            }
+            return false;
+        }
+        step_results.mibs_computed.clear();
+
+        size_t position = 0;
+        while (position < children.size() &&
+               children[position].get_expanded_vertex() != side_oct[idx]) position++;
+        if (position == children.size()) return false;
+        current_bag = std::move(children[position]);
+    }
+    return false;
+}
+
+
+/**
+ * OCT-MIB can find a MIB under several roots, and relies on a global
+ * duplicates table to output it once. A sample cannot consult such a table,
+ * so each MIB is instead assigned to a single canonical root.
+ *
+ * A MIB is found with one of its sides S on the growing side of the search
+ * tree, from the least OCT vertex of S, and then under every MIS of OCT that
+ * contains the OCT vertices of S. For each side with OCT vertices the
+ * candidate root is the first such MIS; the canonical root is the earlier
+ * candidate under which the MIB is actually found, which is checked with
+ * is_found_at_root only when the other side's candidate comes first.
+ */
+bool is_canonical_root(MIBSampleResults & sample_results,
+                       SamplingComponent & component,
+                       std::vector<SamplingRoot> & roots,
+                       const BicliqueLite & mib,
+                       size_t root_index) {
+
+    const SamplingRoot & root = roots[root_index];
+    std::string mib_string = mib.to_string();
+
+    auto memo = component.canonical_roots.find(mib_string);
+    if (memo != component.canonical_roots.end()) return memo->second == root_index;
+
+    const OrderedVertexSet & oct_set = component.og->get_oct();
+
+    std::vector<size_t> left_oct, right_oct;
+    for (auto u : mib.get_left()) {
+        if (oct_set.has_vertex(u)) left_oct.push_back(u);
+    }
+    for (auto u : mib.get_right()) {
+        if (oct_set.has_vertex(u)) right_oct.push_back(u);
+    }
+    std::sort(left_oct.begin(), left_oct.end());
+    std::sort(right_oct.begin(), right_oct.end());
+
+    bool root_on_left = std::binary_search(left_oct.begin(), left_oct.end(), root.vertex);
+    const std::vector<size_t> & this_side_oct = root_on_left ? left_oct : right_oct;
+    const std::vector<size_t> & other_side_oct = root_on_left ? right_oct : left_oct;
+
+    // Index of the candidate root for a side with OCT vertices
+    auto candidate_root = [&](const std::vector<size_t> & side_oct) {
+        for (size_t idx = 0; idx < component.all_mis_in_oct.size(); idx++) {
+            const auto & mis = component.all_mis_in_oct[idx];
+            if (std::includes(mis.begin(), mis.end(), side_oct.begin(), side_oct.end())) {
+                return component.oct_roots[std::make_pair(idx, side_oct.front())];
+            }
+        }
+        return roots.size();
+    };
+
+    size_t canonical_root = candidate_root(this_side_oct);
+    if (other_side_oct.size() > 0) {
+        size_t other_root = candidate_root(other_side_oct);
+        if (other_root < canonical_root &&
+            is_found_at_root(sample_results, component, roots[other_root],
+                             mib_string, other_side_oct)) {
+            canonical_root = other_root;
+        }
+    }
+
+    component.canonical_roots[mib_string] = canonical_root;
+    return canonical_root == root_index;
+}
+
+
+/**
+ * Output the MIBs gathered in step_results.mibs_computed, relabeled to the
+ * input graph, and clear them. For OCT roots, only MIBs assigned to this root
+ * by is_canonical_root are output.
+ */
+void output_step(MIBSampleResults & sample_results,
+                 OutputOptions & step_results,
+                 SamplingComponent & component,
+                 std::vector<SamplingRoot> & roots,
+                 size_t root_index,
+                 double weight) {
+
+    std::unordered_map<std::string,bool> seen;
+
+    for (auto & mib : step_results.mibs_computed) {
+
+        if (roots[root_index].root_type == SamplingRoot::ROOT_TYPE::OCT &&
+            !is_canonical_root(sample_results, component, roots, mib, root_index)) continue;
+
+        std::string mib_string = mib.to_string();
+        if (seen.find(mib_string) != seen.end()) continue;
+        seen[mib_string] = true;
+
+        convert_node_labels_biclique(mib, component.vertex_subset);
+        sample_results.push_back(mib, weight);
+    }
+    step_results.mibs_computed.clear();
+}
+
+
+/**
+ * One random descent from an MCBB root: the importance weight of a bag is the
+ * product of the number of choices made to reach it, and every MIB output
+ * while expanding a bag carries that bag's weight.
+ */
+void sample_mcbb_root(MIBSampleResults & sample_results,
+                      SamplingComponent & component,
+                      std::vector<SamplingRoot> & roots,
+                      size_t root_index,
+                      double weight,
+                      std::mt19937_64 & generator) {
+
+    OutputOptions step_results;
+    step_results.size_constraints = sample_results.size_constraints;
+    if (component.og->get_oct().size() > 0) {
+        step_results.set_base_graph(*component.og);
+        step_results.turn_on_max_check_mode(component.og->get_oct());
+    }
+    step_results.turn_on_relabeling_mode(component.bipartite_labels);
+
+    SearchTreeBagPlus current_bag;
+    if (!mcbb_initial_bag(component.bipartite_graph_ptr,
+                          component.bipartite_independent_set,
+                          roots[root_index].vertex,
+                          step_results.size_constraints,
+                          current_bag)) return;
+
+    step_results.push_back_with_maximality_check(current_bag.get_biclique());
+    output_step(sample_results, step_results, component, roots, root_index, weight);
+
+    while (true) {
+        SearchTreeStack<SearchTreeBagPlus> children;
+        mcbb_expand_bag(step_results, current_bag, children);
+        output_step(sample_results, step_results, component, roots, root_index, weight);
+
+        if (children.empty()) break;
+
+        // Children come off the stack in order, so the first is on top
+        std::uniform_int_distribution<size_t> pick(0, children.size() - 1);
+        size_t position = children.size() - 1 - pick(generator);
+        weight *= children.size();
+        current_bag = std::move(children[position]);
+    }
+}
+
+
+/**
+ * One random descent from an OCT root; see sample_mcbb_root.
+ */
+void sample_oct_root(MIBSampleResults & sample_results,
+                     SamplingComponent & component,
+                     std::vector<SamplingRoot> & roots,
+                     size_t root_index,
+                     double weight,
+                     std::mt19937_64 & generator) {
+
+    SamplingRoot & root = roots[root_index];
+    if (!root.built) build_oct_root(sample_results, component, root);
+
+    OutputOptions step_results;
+    step_results.size_constraints = sample_results.size_constraints;
+
+    step_results.mibs_computed = root.root_mibs;
+    output_step(sample_results, step_results, component, roots, root_index, weight);
+
+    SearchTreeBag current_bag = root.bag;
+
+    while (current_bag.size() > 0) {
+        SearchTreeStack<SearchTreeBag> children;
+        DuplicatesTable duplicates_table;
+        octmib_expand_bag(step_results, current_bag, duplicates_table, children);
+        output_step(sample_results, step_results, component, roots, root_index, weight);
+
+        if (children.empty()) break;
+
+        // Children come off the stack in order, so the first is on top
+        std::uniform_int_distribution<size_t> pick(0, children.size() - 1);
+        size_t position = children.size() - 1 - pick(generator);
+        weight *= children.size();
+        current_bag = std::move(children[position]);
+    }
+}
+
+
+/**
+ * Sample MIBs of g with Knuth's estimator over the OCT-MIB search forest.
+ *
+ * Each of the num_samples samples picks a root of the forest uniformly at
+ * random, then repeatedly expands the current bag and descends into one of
+ * its children chosen uniformly at random, until it reaches a leaf. A bag
+ * reached with probability p has weight 1/p, and every MIB output while
+ * expanding it is reported with that weight divided by num_samples. Since
+ * each MIB is output at exactly one bag of the forest, the weights give
+ * unbiased estimates of sums over all MIBs; MIBs in large subtrees are drawn
+ * less often but carry larger weights.
+ *
+ * OCT roots are built the first time a sample reaches them, which is the bulk
+ * of the work of a sample; the rest is a single path of expansions.
+ */
+void sample_mibs(MIBSampleResults & sample_results,
+                 const Graph & g,
+                 OrderedVertexSet input_oct_set,
+                 OrderedVertexSet input_left_set,
+                 OrderedVertexSet input_right_set) {
+
+    sample_results.n = g.get_num_vertices();
+    sample_results.m = g.get_num_edges();
+
+    clock_t begint = std::clock();
+    std::vector<std::vector<size_t>> vector_of_ccs = simpleccs(g, sample_results.size_constraints.min_degree());
+    clock_t endt = std::clock();
+    sample_results.time_ccs += double(endt - begint) / CLOCKS_PER_SEC;
+
+    std::vector<SamplingComponent> components;
+    std::vector<SamplingRoot> roots;
+
+    for (auto & vertex_subset : vector_of_ccs) {
+
+        // Skip isolated vertices and empty sets
+        if (vertex_subset.size() <= 1) continue;
+
+        // Isolated edges are MIBs, and roots on their own
+        if (vertex_subset.size() == 2) {
+            SamplingComponent component;
+            component.vertex_subset = vertex_subset;
+            SamplingRoot root;
+            root.root_type = SamplingRoot::ROOT_TYPE::EDGE;
+            root.component = components.size();
+            roots.push_back(std::move(root));
+            components.push_back(std::move(component));
+            continue;
+        }
+
+        std::vector<size_t> reverse_ordering(g.get_num_vertices());
+        for (size_t idx1=0; idx1<vertex_subset.size(); idx1++) {
+            reverse_ordering[vertex_subset[idx1]] = idx1;
+        }
+
+        // Restrict OCT decomposition to this subgraph, if one was given
+        OrderedVertexSet oct_set_cc, left_set_cc, right_set_cc;
+        if (input_oct_set.size() > 0) {
+            oct_set_cc = convert_node_labels_OVS(input_oct_set.set_intersection(vertex_subset), reverse_ordering);
+            left_set_cc = convert_node_labels_OVS(input_left_set.set_intersection(vertex_subset), reverse_ordering);
+            right_set_cc = convert_node_labels_OVS(input_right_set.set_intersection(vertex_subset), reverse_ordering);
+        }
+
+        add_sampling_component(components, roots, g.subgraph(vertex_subset), vertex_subset,
+                               oct_set_cc, left_set_cc, right_set_cc);
+    }
+
+    sample_results.num_roots = roots.size();
+    std::cout << "# Search forest has " << roots.size() << " roots" << std::endl;
+
+    if (roots.size() == 0 || sample_results.num_samples == 0) {
+        sample_results.close_results();
+        return;
+    }
+
+    std::mt19937_64 generator(sample_results.seed);
+    std::uniform_int_distribution<size_t> pick_root(0, roots.size() - 1);
+
+    for (size_t sample = 0; sample < sample_results.num_samples; sample++) {
+
+        size_t root_index = pick_root(generator);
+        SamplingRoot & root = roots[root_index];
+        SamplingComponent & component = components[root.component];
+        double weight = double(roots.size()) / sample_results.num_samples;
+
+        switch (root.root_type) {
+            case SamplingRoot::ROOT_TYPE::EDGE:
+                {
+                    BicliqueLite temp((std::vector<size_t>){component.vertex_subset.front()},
+                                      (std::vector<size_t>){component.vertex_subset.back()});
+                    if (sample_results.size_constraints.is_satisfied_by(temp)) {
+                        sample_results.push_back(temp, weight);
+                    }
+                }
+                break;
+            case SamplingRoot::ROOT_TYPE::MCBB:
+                sample_mcbb_root(sample_results, component, roots, root_index, weight, generator);
+                break;
+            case SamplingRoot::ROOT_TYPE::OCT:
+                sample_oct_root(sample_results, component, roots, root_index, weight, generator);
+                break;
+        }
+    }
+
+    sample_results.close_results();
+}
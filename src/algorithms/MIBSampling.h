@@ -0,0 +1,99 @@
+/**
+* @authors Eric Horton, Kyle Kloster, Drew van der Poel
+*
+* This file is part of MI-bicliques, https://github.com/TheoryInPractice/MI-bicliques,
+* and is Copyright (C) North Carolina State University, 2018.
+* It is licensed under the three-clause BSD license; see LICENSE.
+*/
+
+#ifndef BICLIQUES_MIBSAMPLING_H
+#define BICLIQUES_MIBSAMPLING_H
+
+#include <fstream>
+#include <memory>
+#include <vector>
+#include "../graph/BicliqueLite.h"
+#include "../graph/Graph.h"
+#include "../graph/OrderedVertexSet.h"
+#include "../graph/SizeConstraints.h"
+#include "MISCache.h"
+
+
+/**
+* This struct holds the settings for sample_mibs and the weighted MIBs it
+* draws, along with a few statistics about the run.
+*
+* Every MIB output comes with a weight, and the weights are scaled so that
+* summing weight * f(B) over the output gives an unbiased estimate of the sum
+* of f(B) over all MIBs B. In particular the weights sum to an estimate of the
+* number of MIBs.
+*/
+struct MIBSampleResults {
+
+    std::string print_mibs_dest = std::string("");
+    bool print_mode = false;
+
+    // Number of random descents through the search forest
+    size_t num_samples = 1000;
+    unsigned long seed = 0;
+
+    // Only bicliques satisfying these bounds are sampled
+    SizeConstraints size_constraints;
+
+    // Shared by the roots built during sampling; no caching if null
+    std::shared_ptr<MISCache> mis_cache;
+
+    double time_ccs = 0.0;
+    double time_roots = 0.0;
+
+    size_t num_roots = 0;
+    size_t num_roots_built = 0;
+    size_t total_num_output = 0;
+    double estimated_num_mibs = 0.0;
+
+    size_t n = 0;
+    size_t m = 0;
+
+    std::vector<BicliqueLite> mibs_sampled = {};
+    std::vector<double> weights = {};
+    std::ofstream output_file;
+
+    void turn_on_print_mode(std::string ofile) {
+        print_mibs_dest = ofile;
+        print_mode = true;
+        output_file.open(print_mibs_dest, std::ios::app);
+    }
+
+    void close_results() {
+        if (print_mode) output_file.close();
+    }
+
+    void push_back(const BicliqueLite & this_mib, double weight) {
+        total_num_output++;
+        estimated_num_mibs += weight;
+
+        if (print_mode) {
+            output_file << weight << " " << this_mib.to_string() << std::endl;
+        }
+        else {
+            mibs_sampled.push_back(this_mib);
+            weights.push_back(weight);
+        }
+    }
+
+};
+
+
+/**
+* Draw weighted random MIBs of g by random descents through the OCT-MIB search
+* forest; see MIBSampling.cpp. If an OCT decomposition is not given, one is
+* computed for each connected component as in octmib.
+*/
+void sample_mibs(MIBSampleResults & sample_results,
+                 const Graph & g,
+                 OrderedVertexSet input_oct_set = OrderedVertexSet(),
+                 OrderedVertexSet input_left_set = OrderedVertexSet(),
+                 OrderedVertexSet input_right_set = OrderedVertexSet());
+
+
+#endif //BICLIQUES_MIBSAMPLING_H
@@ -10,17 +10,21 @@
 #include <csignal> // for triggering early termination
 #include <list>
 #include <algorithm>
+#include <memory>
 
 #include "MICA.h"
 #include "MaximalCrossingBicliques.h"
 #include "MaximalCrossingBicliquesBipartite.h"
+#include "ComponentScheduler.h"
+#include "WorkStealingPool.h"
 #include "SimpleCCs.h"
 
+#include "../graph/BicliqueStore.h"
 #include "../graph/OrderedVector.h"
 
 
-std::vector<BicliqueLite*> consensus(BicliqueLite b1, BicliqueLite b2) {
-	std::vector<BicliqueLite*> bicliques;
+std::vector<BicliqueLite> consensus(const BicliqueLite & b1, const BicliqueLite & b2) {
+	std::vector<BicliqueLite> bicliques;
 	std::vector<size_t> left1, right1,
 	                    left2, right2,
 						left3, right3,
@@ -55,17 +59,16 @@ std::vector<BicliqueLite*> consensus(BicliqueLite b1, BicliqueLite b2) {
 						 std::back_inserter(right4));
 
 	if (left1.size() > 0 && right1.size() > 0) {
-		bicliques.push_back(new BicliqueLite(left1, right1));
+		bicliques.emplace_back(left1, right1);
 	}
 	if (left2.size() > 0 && right2.size() > 0) {
-
-		bicliques.push_back(new BicliqueLite(left2, right2));
+		bicliques.emplace_back(left2, right2);
 	}
 	if (left3.size() > 0 && right3.size() > 0) {
-		bicliques.push_back(new BicliqueLite(left3, right3));
+		bicliques.emplace_back(left3, right3);
 	}
 	if (left4.size() > 0 && right4.size() > 0) {
-		bicliques.push_back(new BicliqueLite(left4, right4));
+		bicliques.emplace_back(left4, right4);
 	}
 	return bicliques;
 }
@@ -80,56 +83,198 @@ std::vector<BicliqueLite> mica(const Graph & g) {
 
 }
 
-void mica_cc(OutputOptions & mica_results, const Graph & g) {
-	// initialize the set of Bicliques that come from the stars of G. This covers G.
-	std::set<BicliqueLite> C0;
-	size_t num_vertices = g.get_num_vertices();
-	for (size_t v = 0; v < num_vertices; v++) {
-		if (g.get_neighbors(v).size() == 0) {
-			continue;
+namespace {
+
+/**
+ * Number of chunks to split num_items into: several per worker of pool, so
+ * that workers finishing early steal from the others, or one with no pool.
+ */
+size_t num_chunks(const WorkStealingPool * pool, size_t num_items) {
+	size_t max_chunks = (pool == nullptr) ? 1 : 4 * pool->size();
+	return std::min(num_items, max_chunks);
+}
+
+/**
+ * Run body(chunk, begin, end) on each of the num_chunks(pool, num_items)
+ * consecutive chunks of [0, num_items), on pool if there is one, and wait for
+ * them to finish.
+ */
+template <typename Body>
+void for_each_chunk(WorkStealingPool * pool, size_t num_items, const Body & body) {
+	size_t chunks = num_chunks(pool, num_items);
+	for (size_t chunk = 0; chunk < chunks; chunk++) {
+		size_t begin = chunk * num_items / chunks;
+		size_t end = (chunk + 1) * num_items / chunks;
+		if (pool == nullptr) body(chunk, begin, end);
+		else pool->submit([&body, chunk, begin, end] { body(chunk, begin, end); });
+	}
+	if (pool != nullptr) pool->wait();
+}
+
+/**
+ * A pool of num_threads workers, or none for a single thread.
+ */
+std::unique_ptr<WorkStealingPool> make_pool(size_t num_threads) {
+	if (num_threads <= 1) return nullptr;
+	return std::unique_ptr<WorkStealingPool>(new WorkStealingPool(num_threads));
+}
+
+/**
+ * One round of consensus on pool: the closures of the consensus of each seed
+ * with each biclique of frontier that are not in C.
+ * Each chunk of seeds collects its own candidates, as C is only read during
+ * the round; they are returned in the order a single thread would find them,
+ * and may still repeat each other across chunks.
+ */
+std::vector<BicliqueLite> consensus_round(WorkStealingPool & pool,
+                                          const Graph & g,
+                                          const std::vector<BicliqueLite> & seeds,
+                                          const std::vector<BicliqueLite> & frontier,
+                                          const BicliqueStore & C) {
+
+	std::vector<std::vector<BicliqueLite>> chunk_candidates(num_chunks(&pool, seeds.size()));
+	for_each_chunk(&pool, seeds.size(), [&](size_t chunk, size_t begin, size_t end) {
+		BicliqueStore seen;
+		for (size_t idx = begin; idx < end; idx++) {
+			for (auto & b : frontier) {
+				for (auto & cons : consensus(seeds[idx], b)) {
+					std::vector<size_t> right = g.get_neighborhood_intersection(cons.get_left(), false);
+					std::vector<size_t> left = g.get_neighborhood_intersection(right, false);
+					BicliqueLite ext(left, right);
+					if (!C.contains(ext) && seen.insert(ext)) chunk_candidates[chunk].push_back(ext);
+				}
+			}
 		}
-		std::vector<size_t> left, right, temp;
-		left = g.get_neighbors_vector(v);
-		right = g.get_neighborhood_intersection(left, false);
-		//if right does not have the original vertex, add it in (should not be necessary)	
-		if (find(right.begin(), right.end(), v) == left.end()) {
-			right.push_back(v);
+	});
+
+	std::vector<BicliqueLite> candidates;
+	for (auto & chunk : chunk_candidates) {
+		std::move(chunk.begin(), chunk.end(), std::back_inserter(candidates));
+	}
+	return candidates;
+
+}
+
+}
+
+/**
+ * The star of each vertex of vertices with neighbors -- its neighborhood on
+ * the left, and every vertex adjacent to all of it on the right -- in order,
+ * computed on num_threads threads.
+ */
+std::vector<BicliqueLite> mica_stars(const Graph & g, const std::vector<size_t> & vertices,
+                                     size_t num_threads) {
+	std::vector<BicliqueLite> stars(vertices.size());
+	// Not vector<bool>, whose bits chunks on other threads would share
+	std::vector<char> has_star(vertices.size(), false);
+	std::unique_ptr<WorkStealingPool> pool = make_pool(num_threads);
+
+	for_each_chunk(pool.get(), vertices.size(), [&](size_t /*chunk*/, size_t begin, size_t end) {
+		for (size_t idx = begin; idx < end; idx++) {
+			size_t v = vertices[idx];
+			if (g.get_neighbors(v).size() == 0) continue;
+			std::vector<size_t> left, right;
+			left = g.get_neighbors_vector(v);
+			right = g.get_neighborhood_intersection(left, false);
+			//if right does not have the original vertex, add it in (should not be necessary)
+			if (find(right.begin(), right.end(), v) == right.end()) {
+				right.push_back(v);
+			}
+			stars[idx] = BicliqueLite(left, right);
+			has_star[idx] = true;
+		}
+	});
+
+	std::vector<BicliqueLite> result;
+	for (size_t idx = 0; idx < vertices.size(); idx++) {
+		if (has_star[idx]) result.push_back(std::move(stars[idx]));
+	}
+	return result;
+}
+
+/**
+ * The closure of each of bicliques, in order, computed on num_threads threads:
+ * every vertex adjacent to all of its left side on the right, and every vertex
+ * adjacent to all of that on the left.
+ */
+std::vector<BicliqueLite> mica_closures(const Graph & g, const std::vector<BicliqueLite> & bicliques,
+                                        size_t num_threads) {
+	std::vector<BicliqueLite> closures(bicliques.size());
+	std::unique_ptr<WorkStealingPool> pool = make_pool(num_threads);
+
+	for_each_chunk(pool.get(), bicliques.size(), [&](size_t /*chunk*/, size_t begin, size_t end) {
+		for (size_t idx = begin; idx < end; idx++) {
+			std::vector<size_t> left, right;
+			right = g.get_neighborhood_intersection(bicliques[idx].get_left(), false);
+			left = g.get_neighborhood_intersection(right, false);
+			closures[idx] = BicliqueLite(left, right);
 		}
-		auto it = C0.insert(BicliqueLite(left, right));
+	});
+	return closures;
+}
+
+void mica_cc(OutputOptions & mica_results, const Graph & g) {
+	// initialize the set of Bicliques that come from the stars of G. This covers G.
+	std::vector<size_t> vertices(g.get_num_vertices());
+	for (size_t v = 0; v < vertices.size(); v++) vertices[v] = v;
+	BicliqueStore found;
+	std::vector<BicliqueLite> C0;
+	for (auto & b : mica_stars(g, vertices, mica_results.num_threads)) {
+		if (found.insert(b)) C0.push_back(b);
 	}
-	mica_initialized(mica_results, g, C0, std::set<BicliqueLite>());
+	mica_initialized(mica_results, g, C0, std::vector<BicliqueLite>());
 }
 
-void mica_initialized(OutputOptions & mica_results, const Graph & g, std::set<BicliqueLite> C0, std::set<BicliqueLite> C) {
+void mica_initialized(OutputOptions & mica_results, const Graph & g,
+                      const std::vector<BicliqueLite> & C0, const std::vector<BicliqueLite> & working_set) {
 	//if the working set is empty, initialize to be the seed set.
-	if (C.empty()) {
-		std::copy(C0.begin(), C0.end(), std::inserter(C, C.begin()));
+	const std::vector<BicliqueLite> & initial = working_set.empty() ? C0 : working_set;
+	if (working_set.empty()) {
 		for (auto b: C0) {
 			mica_results.push_back(b);
 		}
 	}
-	bool found = true;
-	while (found) {
-		found = false;
-		for (std::set<BicliqueLite>::iterator itc0 = C0.begin(); itc0 != C0.end(); itc0++) {
-			for (std::set<BicliqueLite>::iterator itc = C.begin(); itc != C.end(); itc++) {
-				std::vector<BicliqueLite*> cons = consensus(*itc0, *itc);
-				for (std::vector<BicliqueLite*>::iterator itb = cons.begin(); itb != cons.end(); itb++) {
-					//extend the bicliques that we found by taking the set intersections of the sides
-					std::vector<size_t> left, right;
-					right = g.get_neighborhood_intersection((*itb)->get_left(), false);
-					left = g.get_neighborhood_intersection(right, false);
-					BicliqueLite ext(left, right);
-					BicliqueLite ext_rev(right, left);
-					// need to check both sides
-					if (C.find(ext) == C.end() && C.find(ext_rev) == C.end()) {
-						found = true; //we have found a vector we do not have already
-						C.insert(ext);
-						mica_results.push_back(ext);
+	BicliqueStore C;
+	for (auto & b : initial) C.insert(b);
+	// Semi-naive evaluation: each seed is only taken in consensus with the
+	// bicliques found in the previous round (the frontier), as those with
+	// the bicliques found earlier were already taken. With several threads,
+	// each round runs on a pool, and its candidates are added at its end.
+	std::unique_ptr<WorkStealingPool> pool = make_pool(mica_results.num_threads);
+	const std::vector<BicliqueLite> & seeds = C0;
+	std::vector<BicliqueLite> frontier(initial);
+	while (!frontier.empty()) {
+		std::vector<BicliqueLite> next_frontier;
+		if (pool != nullptr) {
+			for (auto & ext : consensus_round(*pool, g, seeds, frontier, C)) {
+				// candidates of different chunks may repeat each other
+				if (C.insert(ext)) {
+					mica_results.push_back(ext);
+					next_frontier.push_back(ext);
+				}
+			}
+		}
+		else {
+			for (std::vector<BicliqueLite>::const_iterator itc0 = seeds.begin(); itc0 != seeds.end(); itc0++) {
+				for (std::vector<BicliqueLite>::iterator itc = frontier.begin(); itc != frontier.end(); itc++) {
+					std::vector<BicliqueLite> cons = consensus(*itc0, *itc);
+					for (std::vector<BicliqueLite>::iterator itb = cons.begin(); itb != cons.end(); itb++) {
+						//extend the bicliques that we found by taking the set intersections of the sides
+						std::vector<size_t> left, right;
+						right = g.get_neighborhood_intersection(itb->get_left(), false);
+						left = g.get_neighborhood_intersection(right, false);
+						BicliqueLite ext(left, right);
+						// the store finds ext either way round
+						if (C.insert(ext)) {
+							//we have found a vector we do not have already
+							mica_results.push_back(ext);
+							next_frontier.push_back(ext);
+						}
 					}
 				}
 			}
 		}
+		frontier.swap(next_frontier);
 	}
 }
 
@@ -146,9 +291,10 @@ void mica(OutputOptions & mica_results,
     mica_results.n = g.get_num_vertices();
     mica_results.m = g.get_num_edges();
 
-    // Determine connected components
+    // Determine connected components (of the core left after size-constraint
+    // peeling, if any size constraints are in place)
     clock_t begint = std::clock();
-    std::vector<std::vector<size_t>> vector_of_ccs = simpleccs(g);
+    std::vector<std::vector<size_t>> vector_of_ccs = simpleccs(g, mica_results.size_constraints.min_degree());
     clock_t endt = std::clock();
     mica_results.time_ccs += double(endt - begint) / CLOCKS_PER_SEC;
     mica_results.num_connected_components = vector_of_ccs.size();
@@ -158,55 +304,51 @@ void mica(OutputOptions & mica_results,
     std::cout << std::endl;
 
 
-    if (vector_of_ccs.size() > 1) {
+    // Peeled vertices also force the per-CC path, as the core is a proper subgraph
+    if (vector_of_ccs.size() != 1 || vector_of_ccs.front().size() < g.get_num_vertices()) {
 
-        // run octmib on each CC
-        for (size_t which_cc = 0; which_cc < vector_of_ccs.size(); which_cc++) {
+        // run mica on each CC, possibly several at once
+        run_components(mica_results, vector_of_ccs,
+                       [&](OutputOptions & cc_results, size_t which_cc, std::ostream & log) {
 
             // Time this CC
-            begint = std::clock();
-
-            std::vector<size_t> vertex_subset = vector_of_ccs[which_cc];
-            mica_results.relabeling_mode = false;
+            clock_t begin_cc = std::clock();
 
-            // relabel ground truth using this ordering
-            std::vector<size_t> reverse_ordering(g.get_num_vertices());
-            for (size_t idx1=0; idx1<vertex_subset.size(); idx1++) {
-                reverse_ordering[vertex_subset[idx1]] = idx1;
-            }
+            const std::vector<size_t> & vertex_subset = vector_of_ccs[which_cc];
+            cc_results.relabeling_mode = false;
 
-            std::cout << "# CC " << which_cc + 1 << " of ";
-            std::cout << vector_of_ccs.size() << std::endl;
-            std::cout << "#\tsize: " << vertex_subset.size() << "/";
-            std::cout << g.get_num_vertices() << std::endl;
+            log << "# CC " << which_cc + 1 << " of ";
+            log << vector_of_ccs.size() << std::endl;
+            log << "#\tsize: " << vertex_subset.size() << "/";
+            log << g.get_num_vertices() << std::endl;
 
             // Skip Isolated vertices and empty sets
             if (vertex_subset.size() <= 1) {
-                mica_results.isolates ++;
-                continue;
+                cc_results.isolates ++;
+                return;
             }
 
             // Isolated edges are MIBs
             if (vertex_subset.size() == 2) {
                 BicliqueLite temp((std::vector<size_t>){vertex_subset.front()},
                                   (std::vector<size_t>){vertex_subset.back()});
-                mica_results.push_back_bipartite(temp);
-                mica_results.size_left ++;
-                mica_results.size_right ++;
-                continue;
+                cc_results.push_back_bipartite(temp);
+                cc_results.size_left ++;
+                cc_results.size_right ++;
+                return;
             }
 
             Graph g_cc = g.subgraph(vertex_subset);
 
-            mica_results.turn_on_relabeling_mode(vertex_subset);
-            mica_cc(mica_results, g_cc);
+            cc_results.turn_on_relabeling_mode(vertex_subset);
+            mica_cc(cc_results, g_cc);
 
-            endt = std::clock();
-            std::cout << "# this CC ran in ";
-            std::cout << double(endt - begint) / CLOCKS_PER_SEC;
-            std::cout << "\n#\n# " << std::endl;
+            clock_t end_cc = std::clock();
+            log << "# this CC ran in ";
+            log << double(end_cc - begin_cc) / CLOCKS_PER_SEC;
+            log << "\n#\n# " << std::endl;
 
-        }
+        });
 
     }
     else {
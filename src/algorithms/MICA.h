@@ -24,16 +24,19 @@
 
 #include "OutputOptions.h"
 
-std::vector<BicliqueLite*> consensus(BicliqueLite &, BicliqueLite &);
+std::vector<BicliqueLite> consensus(const BicliqueLite &, const BicliqueLite &);
 void mica_cc(OutputOptions &, const Graph &);
 void mica(OutputOptions &, const Graph &);
 std::vector<BicliqueLite> mica(const Graph &);
+std::vector<BicliqueLite> mica_stars(const Graph &, const std::vector<size_t> &, size_t num_threads = 1);
+std::vector<BicliqueLite> mica_closures(const Graph &, const std::vector<BicliqueLite> &, size_t num_threads = 1);
 
 /**
- * MICA algorithm that supplies the seed set of bicliques and the working set of bicliques, in that order.
- * If the working set is empty, it will be initialized to be the seed set.
+ * MICA algorithm that supplies the seed set of bicliques and the working set of bicliques, in that order,
+ * each without repeats. The working set is assumed to be already output; if it is empty, it will be
+ * initialized to be the seed set. Runs each round of consensus on OutputOptions::num_threads threads.
  */
-void mica_initialized(OutputOptions &, const Graph &, std::set<BicliqueLite>, std::set<BicliqueLite>);
+void mica_initialized(OutputOptions &, const Graph &, const std::vector<BicliqueLite> &, const std::vector<BicliqueLite> &);
 
 
 
@@ -0,0 +1,215 @@
+/**
+ * MISCache records the maximal independent sets found in induced subgraphs
+ * of one root graph, so that enumerators asking again for the same vertex set
+ * (for instance the neighborhood of a vertex, from another search tree or
+ * another algorithm) do not have to re-run the enumeration.
+ *
+ * Every subgraph keeps the external labels of the graph it was taken from, so
+ * a vertex set of any graph derived from the root graph is identified by the
+ * root labels of its vertices. Sorted, these form the key of the set; the
+ * independent sets are stored as ranks within the key, and are converted back
+ * to the labels of the calling graph on each lookup.
+ *
+ * Entries are kept in least-recently-used order and the oldest are dropped
+ * whenever the memory budget is exceeded. The cache may be used from several
+ * threads at once.
+ *
+ * @authors Eric Horton, Kyle Kloster, Drew van der Poel
+ *
+ * This file is part of MI-bicliques, https://github.com/TheoryInPractice/MI-bicliques,
+ * and is Copyright (C) North Carolina State University, 2018.
+ * It is licensed under the three-clause BSD license; see LICENSE.
+ */
+
+#include <algorithm> // for std::sort
+#include "MISCache.h"
+
+
+/**
+ * Construct an empty cache for subgraphs of root_graph that holds at most
+ * about memory_budget bytes of entries.
+ */
+MISCache::MISCache(const Graph & root_graph, size_t memory_budget) :
+    memory_budget(memory_budget) {
+
+    for (size_t vertex = 0; vertex < root_graph.get_num_vertices(); vertex++) {
+        root_labels[root_graph.get_external_vertex_label(vertex)] = vertex;
+    }
+
+}
+
+
+/**
+ * Build the key of the subgraph of g induced by vertices. g must be the root
+ * graph or a subgraph of it.
+ *
+ * @return False if some vertex has no label in the root graph, in which case
+ *         the set cannot be cached.
+ */
+bool MISCache::make_key(const Graph & g, const std::vector<size_t> & vertices, Key & key) const {
+
+    std::vector<std::pair<size_t, size_t>> root_and_position;
+    root_and_position.reserve(vertices.size());
+
+    for (size_t position = 0; position < vertices.size(); position++) {
+        auto label_itr = root_labels.find(g.get_external_vertex_label(vertices[position]));
+        if (label_itr == root_labels.end()) return false;
+        root_and_position.emplace_back(label_itr->second, position);
+    }
+    std::sort(root_and_position.begin(), root_and_position.end());
+
+    key.root_vertices.clear();
+    key.positions.clear();
+    for (auto & pair : root_and_position) {
+        key.root_vertices.push_back(pair.first);
+        key.positions.push_back(pair.second);
+    }
+    return true;
+
+}
+
+
+/**
+ * Look up the maximal independent sets of the vertex set of key. If found,
+ * store them in list_of_MIS in the labels of the graph the key was made from,
+ * where vertices is the vertex set passed to make_key.
+ *
+ * @return True if the set was in the cache.
+ */
+bool MISCache::lookup(const Key & key, const std::vector<size_t> & vertices,
+                      std::vector<std::vector<size_t>> & list_of_MIS) {
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    num_lookups++;
+    auto index_itr = index.find(key.root_vertices);
+    if (index_itr == index.end()) return false;
+
+    num_hits++;
+    entries.splice(entries.begin(), entries, index_itr->second);
+
+    const Entry & entry = *index_itr->second;
+    list_of_MIS.clear();
+    list_of_MIS.reserve(entry.offsets.size());
+    for (size_t idx = 0; idx < entry.offsets.size(); idx++) {
+        size_t end = (idx + 1 < entry.offsets.size()) ? entry.offsets[idx + 1] : entry.ranks.size();
+
+        std::vector<size_t> mis;
+        mis.reserve(end - entry.offsets[idx]);
+        for (size_t pos = entry.offsets[idx]; pos < end; pos++) {
+            mis.push_back(vertices[key.positions[entry.ranks[pos]]]);
+        }
+        std::sort(mis.begin(), mis.end());
+        list_of_MIS.push_back(std::move(mis));
+    }
+    return true;
+
+}
+
+
+/**
+ * Record list_of_MIS, the maximal independent sets of the vertex set of key
+ * given as positions in the vertex set passed to make_key (that is, in the
+ * labels of the induced subgraph). Evicts the least recently used entries if
+ * the memory budget is exceeded.
+ */
+void MISCache::insert(const Key & key, const std::vector<std::vector<size_t>> & list_of_MIS) {
+
+    Entry entry;
+    entry.root_vertices = key.root_vertices;
+
+    std::vector<uint32_t> rank_of_position(key.positions.size());
+    for (size_t rank = 0; rank < key.positions.size(); rank++) {
+        rank_of_position[key.positions[rank]] = uint32_t(rank);
+    }
+    entry.offsets.reserve(list_of_MIS.size());
+    for (auto & mis : list_of_MIS) {
+        entry.offsets.push_back(entry.ranks.size());
+        for (auto position : mis) entry.ranks.push_back(rank_of_position[position]);
+    }
+
+    // The key is held twice, by the entry and by the index
+    entry.bytes = sizeof(Entry) + 6*sizeof(void *)
+                  + 2*entry.root_vertices.size()*sizeof(size_t)
+                  + entry.ranks.size()*sizeof(uint32_t)
+                  + entry.offsets.size()*sizeof(size_t);
+    if (entry.bytes > memory_budget) return;
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    // Another thread may have recorded the same set in the meantime
+    if (index.find(entry.root_vertices) != index.end()) return;
+
+    memory_usage += entry.bytes;
+    entries.push_front(std::move(entry));
+    index[entries.front().root_vertices] = entries.begin();
+
+    while (memory_usage > memory_budget) {
+        memory_usage -= entries.back().bytes;
+        index.erase(entries.back().root_vertices);
+        entries.pop_back();
+        num_evictions++;
+    }
+
+}
+
+
+size_t MISCache::size() const {
+
+    std::lock_guard<std::mutex> lock(mutex);
+    return entries.size();
+
+}
+
+
+/**
+ * Approximate number of bytes held by the entries.
+ */
+size_t MISCache::get_memory_usage() const {
+
+    std::lock_guard<std::mutex> lock(mutex);
+    return memory_usage;
+
+}
+
+
+size_t MISCache::get_memory_budget() const {
+
+    return memory_budget;
+
+}
+
+
+size_t MISCache::get_num_lookups() const {
+
+    std::lock_guard<std::mutex> lock(mutex);
+    return num_lookups;
+
+}
+
+
+size_t MISCache::get_num_hits() const {
+
+    std::lock_guard<std::mutex> lock(mutex);
+    return num_hits;
+
+}
+
+
+size_t MISCache::get_num_evictions() const {
+
+    std::lock_guard<std::mutex> lock(mutex);
+    return num_evictions;
+
+}
+
+
+size_t MISCache::KeyHash::operator()(const std::vector<size_t> & root_vertices) const {
+
+    uint64_t hash = root_vertices.size();
+    for (auto vertex : root_vertices) {
+        hash ^= vertex + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+    }
+    return size_t(hash);
+
+}
@@ -0,0 +1,85 @@
+/**
+ * MISCache keeps the maximal independent sets of induced subgraphs of one
+ * root graph, keyed by vertex set, under a memory budget.
+ * See MISCache.cpp for full documentation.
+ *
+ * @authors Eric Horton, Kyle Kloster, Drew van der Poel
+ *
+ * This file is part of MI-bicliques, https://github.com/TheoryInPractice/MI-bicliques,
+ * and is Copyright (C) North Carolina State University, 2018.
+ * It is licensed under the three-clause BSD license; see LICENSE.
+ */
+
+#ifndef BICLIQUES_MISCACHE_H
+#define BICLIQUES_MISCACHE_H
+
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "../graph/Graph.h"
+#include "stddef.h"  // apparently required for size_t
+
+class MISCache {
+
+public:
+    /**
+     * A vertex set of some graph, identified within the root graph: the
+     * sorted root labels of its vertices, and for each of them the position
+     * of the vertex in the vertex set.
+     */
+    struct Key {
+        std::vector<size_t> root_vertices;
+        std::vector<size_t> positions;
+    };
+
+    MISCache(const Graph & root_graph, size_t memory_budget);
+
+    bool make_key(const Graph & g, const std::vector<size_t> & vertices, Key & key) const;
+
+    bool lookup(const Key & key, const std::vector<size_t> & vertices,
+                std::vector<std::vector<size_t>> & list_of_MIS);
+    void insert(const Key & key, const std::vector<std::vector<size_t>> & list_of_MIS);
+
+    size_t size() const;
+    size_t get_memory_usage() const;
+    size_t get_memory_budget() const;
+
+    size_t get_num_lookups() const;
+    size_t get_num_hits() const;
+    size_t get_num_evictions() const;
+
+private:
+    struct KeyHash {
+        size_t operator()(const std::vector<size_t> & root_vertices) const;
+    };
+
+    // Each MIS is stored as the ranks of its vertices in the key, back to back
+    struct Entry {
+        std::vector<size_t> root_vertices;
+        std::vector<uint32_t> ranks;
+        std::vector<size_t> offsets;
+        size_t bytes = 0;
+    };
+
+    std::unordered_map<std::string, size_t> root_labels;
+
+    // Most recently used entry first
+    std::list<Entry> entries;
+    std::unordered_map<std::vector<size_t>, std::list<Entry>::iterator, KeyHash> index;
+
+    size_t memory_budget;
+    size_t memory_usage = 0;
+
+    size_t num_lookups = 0;
+    size_t num_hits = 0;
+    size_t num_evictions = 0;
+
+    mutable std::mutex mutex;
+
+};
+
+
+#endif //BICLIQUES_MISCACHE_H
@@ -11,70 +11,42 @@
 #include <queue>
 
 /**
- * Updates all blueprints in a bag to ensure they point to
- * the correct search tree bag.
+ * Record the biclique of a maximal blueprint, held by a bag with the given
+ * iterative sets. In count-only mode the biclique is never built; only its
+ * side sizes are needed.
  */
-void update_iterative_pointers_in_blueprint(SearchTreeBag & current_bag) {
-
-    std::shared_ptr<std::vector<size_t>> & this_iter_wait = current_bag.get_iterative_wait_ptr();
-    std::shared_ptr<OrderedVertexSet> & this_iter_in = current_bag.get_iterative_in_ptr();
-    std::shared_ptr<std::vector<size_t>> & this_iter_past = current_bag.get_iterative_past_ptr();
-
-    for (BlueprintLite & temp_blueprint : current_bag) {
-        temp_blueprint.update_iterative_ptrs(this_iter_wait,
-                                             this_iter_in,
-                                             this_iter_past);
-
+inline void record_blueprint(OutputOptions & mcb_results,
+                             const BlueprintLite & blueprint,
+                             const IterativeSets & iterative) {
+    if (mcb_results.count_only_mode) {
+        mcb_results.count(blueprint.get_left_size(iterative), blueprint.get_right_size());
     }
-
+    else mcb_results.push_back(blueprint.get_biclique(iterative));
 }
 
 
-/**
- *  Handle the ban and delay processes for each bag in the input bag_list.
- */
- void handle_bans(const size_t & blueprint_id,
-                  const size_t & expanded_vertex,
-                  std::list<SearchTreeBag> & bag_list) {
-
-    // Iterate over each bag among children of current_bag
-    for ( SearchTreeBag & temp_bag : bag_list ) {
-
-        // No need to update any bag produced by expanding on a node
-        // that comes *after* the vertex getting banned
-        if (temp_bag.get_expanded_vertex() >= expanded_vertex) break;
-
-        temp_bag.ban_vertex_in_blueprints(expanded_vertex, blueprint_id);
-
-    } // end FOR updating ban lists
- }
-
-
 /**
  * Given expansion result info, determine whether the blueprint produces a
  * MIB we output, and whether or not to ban.
  */
  void process_expansion_result(BlueprintLite & current_blueprint,
                                ExpansionResult & expand_result,
-                               std::vector<BicliqueLite> & biclique_list,
+                               OutputOptions & mcb_results,
                                std::unordered_map<std::string,bool> & local_duplicates_table,
-                               std::list<SearchTreeBag> & bag_list,
+                               SearchTreeBag & expanded_bag,
                                SearchTreeBag & next_bag) {
 
     const auto & expand_result_type = expand_result.get_return_type();
 
     if (expand_result_type == ExpansionResult::RETURN_TYPE::SUCCESS) {
 
-        current_blueprint.update_iterative_ptrs(next_bag.get_iterative_wait_ptr(),
-                                                next_bag.get_iterative_in_ptr(),
-                                                next_bag.get_iterative_past_ptr());
-
         size_t next_future_maximal_vertex = current_blueprint.get_last_vertex();
 
         // If maximal, add to output list
-        if (current_blueprint.is_currently_maximal(next_future_maximal_vertex)) {
+        if (current_blueprint.is_currently_maximal(next_bag.get_iterative(),
+                                                   next_future_maximal_vertex)) {
 
-            biclique_list.push_back( current_blueprint.get_biclique() );
+            record_blueprint(mcb_results, current_blueprint, next_bag.get_iterative());
 
         }
         // Regardless of maximality, update next_future_maximal_vertex
@@ -88,57 +60,135 @@ void update_iterative_pointers_in_blueprint(SearchTreeBag & current_bag) {
         return;
     }
     else {
-        // BAN
-        handle_bans(current_blueprint.get_id(),
-                    expand_result.get_vertex(),
-                    bag_list);
+        // BAN, in the children of expanded_bag expanded before this one
+        expanded_bag.record_child_ban(current_blueprint.get_id(),
+                                      expand_result.get_vertex());
     } // end all ban checks
 
 }
 
 
+/**
+ * Expand every blueprint of current_bag on each vertex of its iterative_wait,
+ * recording the maximal bicliques found. The non-empty child bags are pushed
+ * onto `children`, with the bans between them applied, so that they come off
+ * in the order they were expanded on. With one_child_at_a_time, they are
+ * planned in current_bag instead (see SearchTreeBag::plan_child).
+ */
+void mcb_expand_bag(OutputOptions & mcb_results,
+                    SearchTreeBag & current_bag,
+                    SearchTreeStack<SearchTreeBag> & children,
+                    bool one_child_at_a_time) {
+
+    std::unordered_map<std::string,bool> local_duplicates_table;
+
+    // The iterative sets are the same for all blueprints in a bag together
+    const IterativeSets & iterative = current_bag.get_iterative();
+    const IterativeSets::Slice nodes_to_expand_on = iterative.get_wait();
+
+    // Every expansion is made into this blueprint, which is only copied
+    // into a child bag when the expansion succeeds
+    BlueprintLite expanded_blueprint(children.get_allocator());
+
+    // Children are built here; pushing one leaves the storage of an earlier
+    // bag in its place
+    SearchTreeBag child_bag(children.get_allocator());
+    size_t first_child = children.size();
+
+    // For each node in iterative wait...
+    for (size_t wait_index = 0; wait_index < nodes_to_expand_on.size(); wait_index++) {
+        const size_t expand_node = nodes_to_expand_on[wait_index];
+
+        child_bag.assign_child(current_bag, expand_node);
+
+        // For each blueprint in the current bag...
+        for (const BlueprintLite & temp_blueprint : current_bag) {
+
+            // If expand_node is beyond the next node needed for maximality, skip
+            // If expand_node is banned in blueprint, skip
+            if (temp_blueprint.skip_expanding_vertex(expand_node, wait_index)) continue;
+
+            ExpansionResult expand_result = temp_blueprint.expand(iterative,
+                                                                  expand_node,
+                                                                  local_duplicates_table,
+                                                                  mcb_results.size_constraints,
+                                                                  expanded_blueprint);
+
+            // Expansion performed --
+            // Now update BAN info, add to mcb_list if applicable
+            process_expansion_result(expanded_blueprint,
+                                     expand_result,
+                                     mcb_results,
+                                     local_duplicates_table,
+                                     current_bag,
+                                     child_bag);
+
+        }
+
+        // Keep non-empty children
+        if (child_bag.size() == 0) continue;
+        if (one_child_at_a_time) current_bag.plan_child(child_bag);
+        else children.push(child_bag);
+
+    } // end FOR over nodes to expand current search tree bag on.
+
+    if (!one_child_at_a_time) {
+        current_bag.apply_child_bans(children, first_child);
+        children.reverse(first_child);
+    }
+
+}
+
+
 /*
  * Enumerate all maximal induced bicliques with one partition contained
  * entirely within a specified independent set, `independent_set`.
  *
  * Proceed by iterating over every vertex of the input independent set,
- * and making a search_tree_list for each such vertex. Populate that search tree
+ * and making a search tree for each such vertex. Populate that search tree
  * with bag-nodes initialized by independent_sets found in the neighborhood of
- * vertex.
+ * vertex. Bags are expanded depth-first, one child at a time once the bag
+ * being expanded and those waiting hold more than
+ * mcb_results.max_frontier_bytes.
+ *
+ * Blueprints that cannot grow into a biclique meeting
+ * mcb_results.size_constraints (with the independent set as first side) are
+ * pruned during expansion. In count-only mode bicliques are only counted.
  *
+ * @param mcb_results           Receives the bicliques found.
  * @param graph                 A graph.
  * @param independent_set       Must be a independent set within graph.
  */
-std::vector<BicliqueLite> maximal_crossing_bicliques(const Graph &graph,
-                                                 const OrderedVector &independent_set) {
+void maximal_crossing_bicliques(OutputOptions &mcb_results,
+                                const Graph &graph,
+                                const OrderedVector &independent_set) {
 
 std::shared_ptr<Graph> graph_ptr = std::make_shared<Graph>(graph);
 
-std::vector<BicliqueLite> max_cross_biclique_list;
+const SizeConstraints & size_constraints = mcb_results.size_constraints;
 
 // For each vertex of independent_set
 for (auto vertex : independent_set) {
 
     if (graph.get_neighbors(vertex).size() == 0) continue;
 
-    std::vector<size_t> ind_set_at_vertex = independent_set.truncate_before_node_vec(vertex);
-    OrderedVertexSet iterative_in((std::vector<size_t>) {vertex});
-    std::vector<size_t> iterative_wait = ind_set_at_vertex;
-    std::vector<size_t> iterative_past = independent_set.truncate_after_node_vec(vertex);
+    // Bags waiting to be expanded, and the bag being expanded, allocated
+    // from the arena of this search tree
+    SearchTreeStack<SearchTreeBag> search_tree;
+    SearchTreeBag current_bag(search_tree.get_allocator());
 
-    SearchTreeBag initial_bag(iterative_wait, iterative_in, iterative_past, vertex);
+    // iterative_in is {vertex}, iterative_past the vertices of
+    // independent_set before it and iterative_wait those after
+    SearchTreeBag initial_bag(IterativeSets(independent_set.get_vertices(), vertex), vertex,
+                              search_tree.get_allocator());
+    const IterativeSets & iterative = initial_bag.get_iterative();
 
-    std::list<SearchTreeBag> search_tree_list;
     size_t blueprint_id = 0;
 
     // find all maximal independent sets in the graph induced on v's neighborhood
     const std::vector<size_t> vertex_neighborhood = graph.get_neighbors_vector(vertex);
-    Graph induced_neighborhood_graph = graph.subgraph(vertex_neighborhood);
-
-    // Need to map subgraph vertex labels to outer labels
-    std::vector<std::vector<size_t>> maximal_independent_sets = get_all_mis(induced_neighborhood_graph);
-    // Get subgraph-to-graph label converter
-    convert_node_labels_vector_inplace(maximal_independent_sets, vertex_neighborhood);
+    std::vector<std::vector<size_t>> maximal_independent_sets =
+        get_all_mis(graph, vertex_neighborhood, mcb_results.mis_cache.get());
 
     // For each MIS in vertex's neighborhood, create blueprints
     for (auto & MIS_instance : maximal_independent_sets) {
@@ -171,9 +221,6 @@ for (auto vertex : independent_set) {
         BlueprintLite this_blueprint(
                                     blueprint_id,
                                     graph_ptr,
-                                    initial_bag.get_iterative_wait_ptr(),
-                                    initial_bag.get_iterative_in_ptr(),
-                                    initial_bag.get_iterative_past_ptr(),
                                     CC_in,
                                     CC_out,
                                     IF_in,
@@ -181,90 +228,86 @@ for (auto vertex : independent_set) {
                                     OCT_aux
                                 );
 
+        if (!this_blueprint.can_satisfy(iterative, size_constraints)) continue;
+
         blueprint_id++;
         initial_bag.add_blueprint(this_blueprint);
         size_t next_future_max_vert = this_blueprint.get_last_vertex();
         // Add maximal bicliques to output list
-        if (this_blueprint.is_currently_maximal(next_future_max_vert)) {
+        if (this_blueprint.is_currently_maximal(iterative, next_future_max_vert)) {
 
-            max_cross_biclique_list.push_back( this_blueprint.get_biclique() );
+            record_blueprint(mcb_results, this_blueprint, iterative);
         }
         this_blueprint.set_next_future_maximal(next_future_max_vert);
 
     }
 
-    if (initial_bag.size() > 0) search_tree_list.push_back(initial_bag);
+    if (initial_bag.size() > 0) search_tree.push(initial_bag);
 
-    // For each bag in search_tree_list...
-    while (search_tree_list.size() > 0) {
+    // For each bag in search_tree...
+    while (!search_tree.empty()) {
+
+        // A bag expanded one child at a time stays below its children until
+        // the last of them is built
+        if (search_tree.top().has_planned_child()) {
+            search_tree.top().build_planned_child(current_bag, size_constraints);
+            if (!search_tree.top().has_planned_child()) search_tree.pop();
+            search_tree.push(current_bag);
+            continue;
+        }
 
-        SearchTreeBag & current_bag = search_tree_list.front();
+        search_tree.pop(current_bag);
 
         // Skip empty bags
         if (current_bag.size() == 0) continue;
 
-        // update the iterative_set pointers for all blueprints in this bag.
-        update_iterative_pointers_in_blueprint(current_bag);
-        std::vector<size_t> & this_iter_wait = current_bag.get_iterative_wait();
-        OrderedVertexSet & this_iter_in = current_bag.get_iterative_in();
-        std::vector<size_t> & this_iter_past = current_bag.get_iterative_past();
-
-        // Initialize empty vector to hold all children bags of current_bag
-        std::list<SearchTreeBag> child_bag_list;
-        std::unordered_map<std::string,bool> local_duplicates_table;
-
-        // iterative_wait is the same for all blueprints in a bag together
-        const std::vector<size_t> & nodes_to_expand_on = current_bag.get_iterative_wait();
-
-        // For each node in iterative wait...
-        for (const size_t expand_node : nodes_to_expand_on) {
+        bool one_child_at_a_time = mcb_results.max_frontier_bytes > 0 &&
+                                   search_tree.memory_usage() + current_bag.memory_usage() >
+                                   mcb_results.max_frontier_bytes;
 
-            SearchTreeBag child_bag(this_iter_wait,
-                                    this_iter_in,
-                                    this_iter_past,
-                                    expand_node);
+        mcb_expand_bag(mcb_results, current_bag, search_tree, one_child_at_a_time);
+        search_tree.note_held(current_bag.memory_usage());
 
-            child_bag.expand_on_vertex(expand_node);
-
-            // For each blueprint in the current bag...
-            for (const BlueprintLite & temp_blueprint : current_bag) {
-
-                // If expand_node is beyond the next node needed for maximality, skip
-                // If expand_node is banned in blueprint, skip
-                if (temp_blueprint.skip_expanding_vertex(expand_node)) continue;
-
-                BlueprintLite current_blueprint = temp_blueprint;
-
-                ExpansionResult expand_result = current_blueprint.expand(expand_node, local_duplicates_table);
-
-                // Expansion performed --
-                // Now update BAN info, add to mcb_list if applicable
-                process_expansion_result(current_blueprint,
-                                         expand_result,
-                                         max_cross_biclique_list,
-                                         local_duplicates_table,
-                                         child_bag_list,
-                                         child_bag);
+        if (one_child_at_a_time && current_bag.has_planned_child()) {
+            search_tree.push(current_bag);
+        }
 
-            }
-            // If child_bag non empty, add to temp list
-            if (child_bag.size() > 0) child_bag_list.push_back(child_bag);
+    } // WHILE loop over search_tree
 
-        } // end FOR over nodes to expand current search tree bag on.
+    mcb_results.peak_frontier_bytes = std::max(mcb_results.peak_frontier_bytes,
+                                               search_tree.peak_memory_usage());
 
-        search_tree_list.pop_front();
+} // FOR loop over independent_set
 
-        // Done creating children of current_bag;
-        // add non-empty children to search_tree.
-        if (child_bag_list.size() > 0) {
-            search_tree_list.splice(search_tree_list.begin(), child_bag_list);
-        }
+} // end outer-most function
 
-    } // WHILE loop over search_tree_list
 
+/**
+ * Return all maximal crossing bicliques of graph with one side contained in
+ * independent_set; see maximal_crossing_bicliques above.
+ */
+std::vector<BicliqueLite> maximal_crossing_bicliques(const Graph &graph,
+                                                 const OrderedVector &independent_set,
+                                                 const SizeConstraints &size_constraints) {
 
-} // FOR loop over independent_set
+    OutputOptions mcb_results;
+    mcb_results.size_constraints = size_constraints;
+    maximal_crossing_bicliques(mcb_results, graph, independent_set);
+    return std::move(mcb_results.mibs_computed);
+}
 
-return max_cross_biclique_list;
 
-} // end outer-most function
+/**
+ * Count the maximal crossing bicliques of graph with one side contained in
+ * independent_set, without building any of them.
+ */
+size_t count_maximal_crossing_bicliques(const Graph &graph,
+                                        const OrderedVector &independent_set,
+                                        const SizeConstraints &size_constraints) {
+
+    OutputOptions mcb_results;
+    mcb_results.size_constraints = size_constraints;
+    mcb_results.count_only_mode = true;
+    maximal_crossing_bicliques(mcb_results, graph, independent_set);
+    return mcb_results.total_num_mibs;
+}
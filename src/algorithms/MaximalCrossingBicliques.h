@@ -10,44 +10,57 @@
 #define BICLIQUES_MAXIMALCROSSINGBICLIQUES_H
 
 #include <vector>
-#include <list>
 
 #include "../graph/Graph.h"
 #include "../graph/BicliqueLite.h"
 #include "../graph/BlueprintLite.h"
 #include "../graph/SearchTreeBag.h"
+#include "../graph/SearchTreeStack.h"
 #include "../graph/ExpansionResult.h"
 
 #include "../graph/OrderedVector.h"
 
+#include "OutputOptions.h"
 
-void update_iterative_pointers_in_blueprint(SearchTreeBag &);
 
-void handle_bans(const size_t & blueprint_id,
-                 const size_t & expanded_vertex,
-                 std::list<SearchTreeBag> & bag_list);
 
 void process_expansion_result(BlueprintLite & current_blueprint,
                               ExpansionResult & expand_result,
-                              std::vector<BicliqueLite> & mib_list,
+                              OutputOptions & mcb_results,
                               std::unordered_map<std::string,bool> & local_duplicates_list,
-                              std::list<SearchTreeBag> & bag_list,
+                              SearchTreeBag & expanded_bag,
                               SearchTreeBag & next_bag);
 
+void mcb_expand_bag(OutputOptions & mcb_results,
+                    SearchTreeBag & current_bag,
+                    SearchTreeStack<SearchTreeBag> & children,
+                    bool one_child_at_a_time = false);
+
+
+void maximal_crossing_bicliques(OutputOptions &mcb_results,
+                                const Graph &graph,
+                                const OrderedVector &independent_set);
 
 std::vector<BicliqueLite> maximal_crossing_bicliques(const Graph &graph,
-                            const OrderedVector &independent_set);
+                            const OrderedVector &independent_set,
+                            const SizeConstraints &size_constraints = SizeConstraints());
+
+size_t count_maximal_crossing_bicliques(const Graph &graph,
+                                        const OrderedVector &independent_set,
+                                        const SizeConstraints &size_constraints = SizeConstraints());
 
 inline std::vector<BicliqueLite> maximal_crossing_bicliques(const Graph &graph,
-                                     const std::vector<size_t> &independent_set) {
+                                     const std::vector<size_t> &independent_set,
+                                     const SizeConstraints &size_constraints = SizeConstraints()) {
     OrderedVector temp_vec(independent_set);
-    return maximal_crossing_bicliques(graph, temp_vec);
+    return maximal_crossing_bicliques(graph, temp_vec, size_constraints);
 }
 
 inline std::vector<BicliqueLite> maximal_crossing_bicliques(const Graph &graph,
-                                     const OrderedVertexSet &independent_set) {
+                                     const OrderedVertexSet &independent_set,
+                                     const SizeConstraints &size_constraints = SizeConstraints()) {
 
-    return maximal_crossing_bicliques(graph, independent_set.get_vertices());
+    return maximal_crossing_bicliques(graph, independent_set.get_vertices(), size_constraints);
 }
 
 #endif //BICLIQUES_MAXIMALCROSSINGBICLIQUES_H
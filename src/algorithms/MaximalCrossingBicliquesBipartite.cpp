@@ -7,7 +7,6 @@
 */
 
 #include <queue>
-#include <list>
 
 #include "MaximalCrossingBicliques.h"
 #include "MaximalCrossingBicliquesBipartite.h"
@@ -16,68 +15,43 @@
 
 #include "../graph/BicliqueLite.h"
 
-/*
- * Enumerate all maximal induced bicliques with one partition contained
- * entirely within a specified independent set, `indset`.
- *
- * Proceed by iterating over every vertex of the input independent set,
- * and making a search_tree_list for each such vertex. Populate that search tree
- * with bag-nodes initialized by independent_sets found in the neighborhood of
- * vertex.
- *
- * @param graph                 A graph.
- * @param independent_set       Must be a independent set within graph.
+/**
+ * Record the biclique held by a bag. In count-only mode without maximality
+ * checks the biclique is never built; only its side sizes are needed.
  */
-void maximal_crossing_bicliques_bipartite(OutputOptions &mcbbresults,
-                                          const Graph &input_graph,
-                                          const std::vector<size_t> &input_left_set,
-                                          const std::vector<size_t> &input_right_set) {
-
-// First re-order graph and sets
-const auto vertex_ordering = degree_reordering(input_graph);
-Graph graph = input_graph.subgraph(vertex_ordering);
-
-mcbbresults.turn_on_relabeling_mode(vertex_ordering);
-
-std::vector<size_t> reverse_ordering(vertex_ordering.size());
-for (size_t idx1=0; idx1<vertex_ordering.size(); idx1++) {
-    reverse_ordering[vertex_ordering[idx1]] = idx1;
-}
-
-// Relabel input sets with new labeling
-auto left_set = convert_node_labels_vector(input_left_set, reverse_ordering);
-auto right_set = convert_node_labels_vector(input_right_set, reverse_ordering);
-
-// Make sure independent_set is the smaller partition
-std::vector<size_t> independent_set = left_set;
-if (left_set.size() > right_set.size()) {
-    independent_set = right_set;
+inline void record_bag(OutputOptions &mcbbresults, SearchTreeBagPlus &bag) {
+    if (mcbbresults.count_only_mode && !mcbbresults.check_maximality_mode) {
+        mcbbresults.count_bipartite(bag.get_left_size(), bag.get_right_size());
+    }
+    else mcbbresults.push_back_with_maximality_check(bag.get_biclique());
 }
 
-std::shared_ptr<Graph> graph_ptr = std::make_shared<Graph>(graph);
 
+/**
+ * Build the root bag of the MCBB search tree grown from `vertex` of
+ * independent_set. Returns false if no tree is grown from this vertex: it has
+ * no neighbors, an earlier vertex of independent_set covers its neighborhood,
+ * or no biclique grown from it meets the size constraints.
+ */
+bool mcbb_initial_bag(const std::shared_ptr<Graph> &graph_ptr,
+                      const std::vector<size_t> &independent_set,
+                      size_t vertex,
+                      const SizeConstraints &size_constraints,
+                      SearchTreeBagPlus &initial_bag) {
 
-// For each vertex of independent_set
-for (const size_t & vertex : independent_set) {
+    const Graph & graph = *graph_ptr;
 
     // find all maximal independent sets in the graph induced on v's neighborhood
     const auto & vertex_neighborhood = graph.get_neighbors_vector(vertex);
 
-    if (vertex_neighborhood.size() == 0) continue;
-    OrderedVertexSet MIS_instance = vertex_neighborhood;
+    if (vertex_neighborhood.size() == 0) return false;
 
     // Skip MIS if any prior IS node is completely connected to it
-    bool skip_this_MIS = false;
     for (const size_t & u : independent_set) {
         if (u >= vertex) break;
-        if (graph.is_completely_connect_to(u, vertex_neighborhood)) {
-            skip_this_MIS = true;
-            break;
-        }
+        if (graph.is_completely_connect_to(u, vertex_neighborhood)) return false;
     }
 
-    if (skip_this_MIS) continue;
-
     // Initialize first searchtree bag
     std::vector<size_t> iterative_past, ind_set_at_vertex;
     size_t ind_idx = 0;
@@ -110,56 +84,165 @@ for (const size_t & vertex : independent_set) {
 
     std::vector<size_t> CC_in = vertex_neighborhood;
 
-    SearchTreeBagPlus initial_bag(graph_ptr,
-                                  CC_in,
-                                  iterative_wait,
-                                  iterative_in,
-                                  iterative_past,
-                                  vertex);
+    initial_bag = SearchTreeBagPlus(graph_ptr,
+                                    CC_in,
+                                    iterative_wait,
+                                    iterative_in,
+                                    iterative_past,
+                                    vertex,
+                                    initial_bag.get_allocator());
 
-    std::list<SearchTreeBagPlus> search_tree_list;
-    size_t blueprint_id = 0;
+    // Skip this vertex if no biclique grown from it meets the size constraints
+    return initial_bag.can_satisfy(size_constraints);
+}
 
-    mcbbresults.push_back_with_maximality_check(initial_bag.get_biclique());
-    search_tree_list.push_back(initial_bag);
 
-    // SEARCH TREE INITIALIZED
-    // Now iterate over each bag in search_tree_list...
-    while (search_tree_list.size() > 0) {
+/**
+ * Expand current_bag on each vertex of its iterative_wait, recording the
+ * biclique of every child bag and pushing the children onto `children` so
+ * that they come off in the order they were expanded on.
+ */
+void mcbb_expand_bag(OutputOptions &mcbbresults,
+                     SearchTreeBagPlus &current_bag,
+                     SearchTreeStack<SearchTreeBagPlus> &children) {
+
+    // iterative_wait is the same for all blueprints in a bag together
+    const std::pmr::vector<size_t> & nodes_to_expand_on = current_bag.get_iterative_wait();
+
+    // Children are built here; pushing one leaves the storage of an earlier
+    // bag in its place
+    SearchTreeBagPlus child_bag(children.get_allocator());
+    size_t first_child = children.size();
+
+    // For each node we can expand current blueprints on...
+    for (const size_t expand_node : nodes_to_expand_on) {
+
+        child_bag = current_bag;
+
+        bool expansion_outcome = child_bag.expand(expand_node,
+                                                  mcbbresults.size_constraints);
+
+        if (expansion_outcome==true) {
+            record_bag(mcbbresults, child_bag);
+
+            children.push(child_bag);
 
-        SearchTreeBagPlus & current_bag = search_tree_list.front();
+        }
 
-        // iterative_wait is the same for all blueprints in a bag together
-        const std::vector<size_t> & nodes_to_expand_on = current_bag.get_iterative_wait();
+    } // end FOR over nodes to expand current search tree bag on.
 
-        // Initialize empty vector to hold all children bags of current_bag
-        std::list<SearchTreeBagPlus> child_bag_list;
+    children.reverse(first_child);
+}
 
-        // For each node we can expand current blueprints on...
-        for (const size_t expand_node : nodes_to_expand_on) {
 
-            SearchTreeBagPlus child_bag = current_bag;
+/**
+ * Expand current_bag, which is expanded one child at a time, on its next
+ * vertices until a child bag is found, recording its biclique into
+ * child_bag. Returns false if no vertex left gives a child.
+ */
+bool mcbb_expand_next_child(OutputOptions &mcbbresults,
+                            SearchTreeBagPlus &current_bag,
+                            SearchTreeBagPlus &child_bag) {
 
-            bool expansion_outcome = child_bag.expand(expand_node);
+    while (current_bag.has_next_child()) {
 
-            if (expansion_outcome==true) {
-                mcbbresults.push_back_with_maximality_check(child_bag.get_biclique());
+        size_t expand_node = current_bag.next_child_vertex();
+        child_bag = current_bag;
+
+        if (child_bag.expand(expand_node, mcbbresults.size_constraints)) {
+            record_bag(mcbbresults, child_bag);
+            return true;
+        }
+    }
+    return false;
+}
 
-                child_bag_list.push_back(child_bag);
 
-            }
+/*
+ * Enumerate all maximal induced bicliques with one partition contained
+ * entirely within a specified independent set, `indset`.
+ *
+ * Proceed by iterating over every vertex of the input independent set,
+ * and making a search tree for each such vertex. Populate that search tree
+ * with bag-nodes initialized by independent_sets found in the neighborhood of
+ * vertex. Bags are expanded depth-first, one child at a time once the bag
+ * being expanded and those waiting hold more than
+ * mcbbresults.max_frontier_bytes.
+ *
+ * @param graph                 A graph.
+ * @param independent_set       Must be a independent set within graph.
+ */
+void maximal_crossing_bicliques_bipartite(OutputOptions &mcbbresults,
+                                          const Graph &input_graph,
+                                          const std::vector<size_t> &input_left_set,
+                                          const std::vector<size_t> &input_right_set) {
 
-        } // end FOR over nodes to expand current search tree bag on.
+// First re-order graph and sets
+const auto vertex_ordering = degree_reordering(input_graph);
+Graph graph = input_graph.subgraph(vertex_ordering);
 
-        search_tree_list.pop_front();
+mcbbresults.turn_on_relabeling_mode(vertex_ordering);
 
-        // Done creating children of current_bag;
-        // add non-empty children to search_tree.
-        if (child_bag_list.size() > 0) {
-            search_tree_list.splice(search_tree_list.begin(), child_bag_list);
+std::vector<size_t> reverse_ordering(vertex_ordering.size());
+for (size_t idx1=0; idx1<vertex_ordering.size(); idx1++) {
+    reverse_ordering[vertex_ordering[idx1]] = idx1;
+}
+
+// Relabel input sets with new labeling
+auto left_set = convert_node_labels_vector(input_left_set, reverse_ordering);
+auto right_set = convert_node_labels_vector(input_right_set, reverse_ordering);
+
+// Make sure independent_set is the smaller partition
+std::vector<size_t> independent_set = left_set;
+if (left_set.size() > right_set.size()) {
+    independent_set = right_set;
+}
+
+std::shared_ptr<Graph> graph_ptr = std::make_shared<Graph>(graph);
+
+// For each vertex of independent_set
+for (const size_t & vertex : independent_set) {
+
+    // Bags waiting to be expanded, and the bag being expanded, allocated
+    // from the arena of this search tree
+    SearchTreeStack<SearchTreeBagPlus> search_tree;
+    SearchTreeBagPlus current_bag(search_tree.get_allocator());
+
+    if (!mcbb_initial_bag(graph_ptr, independent_set, vertex,
+                          mcbbresults.size_constraints, current_bag)) continue;
+
+    record_bag(mcbbresults, current_bag);
+    search_tree.push(current_bag);
+
+    // SEARCH TREE INITIALIZED
+    // Now iterate over each bag in search_tree...
+    while (!search_tree.empty()) {
+
+        // A bag expanded one child at a time stays below its children until
+        // the last of them is built
+        if (search_tree.top().has_next_child()) {
+            bool found_child = mcbb_expand_next_child(mcbbresults, search_tree.top(), current_bag);
+            if (!search_tree.top().has_next_child()) search_tree.pop();
+            if (found_child) search_tree.push(current_bag);
+            continue;
+        }
+
+        search_tree.pop(current_bag);
+
+        if (mcbbresults.max_frontier_bytes > 0 &&
+            search_tree.memory_usage() + current_bag.memory_usage() >
+            mcbbresults.max_frontier_bytes) {
+            if (current_bag.start_children_one_at_a_time()) search_tree.push(current_bag);
+            continue;
         }
 
-    } // WHILE loop over search_tree_list
+        mcbb_expand_bag(mcbbresults, current_bag, search_tree);
+        search_tree.note_held(current_bag.memory_usage());
+
+    } // WHILE loop over search_tree
+
+    mcbbresults.peak_frontier_bytes = std::max(mcbbresults.peak_frontier_bytes,
+                                               search_tree.peak_memory_usage());
 
 } // FOR loop over independent_set
 
@@ -10,15 +10,32 @@
 #define BICLIQUES_MAXIMALCROSSINGBICLIQUESBIPARTITE_H
 
 #include <vector>
+#include <memory>
 #include "../graph/Graph.h"
 #include "../graph/OrderedVertexSet.h"
 #include "../graph/BicliqueLite.h"
 #include "../graph/SearchTreeBagPlus.h"
+#include "../graph/SearchTreeStack.h"
 
 #include "OutputOptions.h"
 
 
 
+bool mcbb_initial_bag(const std::shared_ptr<Graph> &graph_ptr,
+                      const std::vector<size_t> &independent_set,
+                      size_t vertex,
+                      const SizeConstraints &size_constraints,
+                      SearchTreeBagPlus &initial_bag);
+
+void mcbb_expand_bag(OutputOptions &mcbbresults,
+                     SearchTreeBagPlus &current_bag,
+                     SearchTreeStack<SearchTreeBagPlus> &children);
+
+bool mcbb_expand_next_child(OutputOptions &mcbbresults,
+                            SearchTreeBagPlus &current_bag,
+                            SearchTreeBagPlus &child_bag);
+
+
 void maximal_crossing_bicliques_bipartite(OutputOptions &mcbbresults,
                                           const Graph &graph,
                                           const std::vector<size_t> &left_set,
@@ -0,0 +1,301 @@
+/**
+ * get_all_mis_near_bipartite enumerates the maximal independent sets of an
+ * induced subgraph H of g, given an OCT decomposition of g whose restriction
+ * to H leaves a small OCT part O and a bipartite remainder with sides L and
+ * R -- as the neighborhood of an OCT vertex in OCT-MIB-II mostly is.
+ *
+ * A maximal independent set I of H is split by S = I within O, which is an
+ * independent set of O though not necessarily a maximal one. The rest of I is
+ * then a maximal independent set of the bipartite graph on the vertices of L
+ * and R with no neighbor in S, and every vertex of O outside S must have a
+ * neighbor in I. So the independent sets S of O are enumerated by branching,
+ * and for each, the maximal independent sets of its bipartite remainder.
+ *
+ * Those are A + free_right(A), for A within L, with free_right(A) the
+ * vertices of R with no neighbor in A, and A closed: equal to
+ * free_left(free_right(A)), the vertices of L with no neighbor in
+ * free_right(A). That is a closure operator, so the closed sets are
+ * enumerated by Ganter's NextClosure algorithm, each after at most |L|
+ * closures, rather than by branching on every vertex. Sets are kept as
+ * bitsets over L and R.
+ *
+ * The sets found are those of get_all_mis, though in another order. With
+ * more than MAX_OCT_PART OCT vertices in H, get_all_mis is used instead.
+ *
+ * @authors Eric Horton, Kyle Kloster, Drew van der Poel
+ *
+ * This file is part of MI-bicliques, https://github.com/TheoryInPractice/MI-bicliques,
+ * and is Copyright (C) North Carolina State University, 2018.
+ * It is licensed under the three-clause BSD license; see LICENSE.
+ */
+
+#include <algorithm> // for std::sort
+#include <cstdint>
+#include "NearBipartiteMIS.h"
+#include "AllMaximalIndependentSets.h"
+
+
+namespace {
+
+const size_t MAX_OCT_PART = 20;
+
+typedef std::vector<uint64_t> Bits;
+
+inline bool test_bit(const Bits & bits, size_t i) {
+    return (bits[i >> 6] >> (i & 63)) & 1;
+}
+
+inline void set_bit(Bits & bits, size_t i) {
+    bits[i >> 6] |= uint64_t(1) << (i & 63);
+}
+
+inline void reset_bit(Bits & bits, size_t i) {
+    bits[i >> 6] &= ~(uint64_t(1) << (i & 63));
+}
+
+inline bool intersects(const Bits & a, const Bits & b) {
+    for (size_t word = 0; word < a.size(); word++) {
+        if (a[word] & b[word]) return true;
+    }
+    return false;
+}
+
+// Call f(i) for each bit i set in bits, in ascending order
+template <typename F>
+inline void for_each_bit(const Bits & bits, const F & f) {
+    for (size_t word = 0; word < bits.size(); word++) {
+        for (uint64_t w = bits[word]; w != 0; w &= w - 1) f(64*word + __builtin_ctzll(w));
+    }
+}
+
+
+/**
+ * The maximal independent sets of the subgraph induced by some vertices of
+ * g, split into OCT, left and right parts; see above.
+ */
+class NearBipartiteMIS {
+
+public:
+    NearBipartiteMIS(const Graph & g,
+                     const std::vector<size_t> & vertices,
+                     const OrderedVertexSet & oct_set,
+                     const OrderedVertexSet & left_partition) {
+
+        for (size_t pos = 0; pos < vertices.size(); pos++) {
+            if (oct_set.has_vertex(vertices[pos])) oct_part.push_back(pos);
+            else if (left_partition.has_vertex(vertices[pos])) left_part.push_back(pos);
+            else right_part.push_back(pos);
+        }
+
+        Bits no_left((left_part.size() + 63)/64, 0), no_right((right_part.size() + 63)/64, 0);
+        all_left = no_left;
+        all_right = no_right;
+        for (size_t i = 0; i < left_part.size(); i++) set_bit(all_left, i);
+        for (size_t j = 0; j < right_part.size(); j++) set_bit(all_right, j);
+
+        right_neighbors.assign(left_part.size(), no_right);
+        left_neighbors.assign(right_part.size(), no_left);
+        for (size_t i = 0; i < left_part.size(); i++) {
+            for (size_t j = 0; j < right_part.size(); j++) {
+                if (g.has_edge(vertices[left_part[i]], vertices[right_part[j]])) {
+                    set_bit(right_neighbors[i], j);
+                    set_bit(left_neighbors[j], i);
+                }
+            }
+        }
+
+        oct_left_neighbors.assign(oct_part.size(), no_left);
+        oct_right_neighbors.assign(oct_part.size(), no_right);
+        oct_adjacent.assign(oct_part.size(), std::vector<bool>(oct_part.size(), false));
+        for (size_t o = 0; o < oct_part.size(); o++) {
+            size_t v = vertices[oct_part[o]];
+            for (size_t i = 0; i < left_part.size(); i++) {
+                if (g.has_edge(v, vertices[left_part[i]])) set_bit(oct_left_neighbors[o], i);
+            }
+            for (size_t j = 0; j < right_part.size(); j++) {
+                if (g.has_edge(v, vertices[right_part[j]])) set_bit(oct_right_neighbors[o], j);
+            }
+            for (size_t p = 0; p < oct_part.size(); p++) {
+                oct_adjacent[o][p] = g.has_edge(v, vertices[oct_part[p]]);
+            }
+        }
+
+    }
+
+    size_t get_oct_part_size() const {
+        return oct_part.size();
+    }
+
+    /**
+     * Add every maximal independent set to list_of_MIS, as ascending
+     * positions in vertices.
+     */
+    void enumerate(std::vector<std::vector<size_t>> & list_of_MIS) {
+        std::vector<size_t> chosen;
+        branch_oct(0, chosen, list_of_MIS);
+    }
+
+private:
+    // Positions in vertices of each part
+    std::vector<size_t> oct_part, left_part, right_part;
+    Bits all_left, all_right;
+
+    // Neighbors within the other side of each left and each right vertex
+    std::vector<Bits> right_neighbors, left_neighbors;
+
+    // Neighbors of each OCT vertex on each side, and within the OCT part
+    std::vector<Bits> oct_left_neighbors, oct_right_neighbors;
+    std::vector<std::vector<bool>> oct_adjacent;
+
+    // Choose, for each OCT vertex from the idx-th on, whether it is in S
+    void branch_oct(size_t idx,
+                    std::vector<size_t> & chosen,
+                    std::vector<std::vector<size_t>> & list_of_MIS) {
+
+        if (idx == oct_part.size()) {
+            enumerate_remainder(chosen, list_of_MIS);
+            return;
+        }
+
+        bool independent = true;
+        for (size_t o : chosen) independent = independent && !oct_adjacent[idx][o];
+        if (independent) {
+            chosen.push_back(idx);
+            branch_oct(idx + 1, chosen, list_of_MIS);
+            chosen.pop_back();
+        }
+        branch_oct(idx + 1, chosen, list_of_MIS);
+
+    }
+
+    // Vertices of R within allowed_right with no neighbor in A
+    Bits free_right(const Bits & A, const Bits & allowed_right) const {
+        Bits B = allowed_right;
+        for_each_bit(A, [&](size_t i) {
+            for (size_t word = 0; word < B.size(); word++) B[word] &= ~right_neighbors[i][word];
+        });
+        return B;
+    }
+
+    // Vertices of L within allowed_left with no neighbor in B
+    Bits free_left(const Bits & B, const Bits & allowed_left) const {
+        Bits A = allowed_left;
+        for_each_bit(B, [&](size_t j) {
+            for (size_t word = 0; word < A.size(); word++) A[word] &= ~left_neighbors[j][word];
+        });
+        return A;
+    }
+
+    // The maximal independent sets of H that meet the OCT part in chosen
+    void enumerate_remainder(const std::vector<size_t> & chosen,
+                             std::vector<std::vector<size_t>> & list_of_MIS) const {
+
+        Bits allowed_left = all_left, allowed_right = all_right;
+        for (size_t o : chosen) {
+            for (size_t word = 0; word < allowed_left.size(); word++) allowed_left[word] &= ~oct_left_neighbors[o][word];
+            for (size_t word = 0; word < allowed_right.size(); word++) allowed_right[word] &= ~oct_right_neighbors[o][word];
+        }
+
+        // OCT vertices outside chosen with no neighbor in it, which the rest
+        // of the set must dominate
+        std::vector<size_t> undominated;
+        std::vector<bool> in_chosen(oct_part.size(), false);
+        for (size_t o : chosen) in_chosen[o] = true;
+        for (size_t o = 0; o < oct_part.size(); o++) {
+            if (in_chosen[o]) continue;
+            bool dominated = false;
+            for (size_t p : chosen) dominated = dominated || oct_adjacent[o][p];
+            if (dominated) continue;
+            if (!intersects(oct_left_neighbors[o], allowed_left) &&
+                !intersects(oct_right_neighbors[o], allowed_right)) return;
+            undominated.push_back(o);
+        }
+
+        std::vector<size_t> allowed;
+        for_each_bit(allowed_left, [&](size_t i) { allowed.push_back(i); });
+
+        auto output = [&](const Bits & A) {
+            Bits B = free_right(A, allowed_right);
+            for (size_t o : undominated) {
+                if (!intersects(oct_left_neighbors[o], A) && !intersects(oct_right_neighbors[o], B)) return;
+            }
+            std::vector<size_t> mis;
+            for (size_t o : chosen) mis.push_back(oct_part[o]);
+            for_each_bit(A, [&](size_t i) { mis.push_back(left_part[i]); });
+            for_each_bit(B, [&](size_t j) { mis.push_back(right_part[j]); });
+            std::sort(mis.begin(), mis.end());
+            list_of_MIS.push_back(std::move(mis));
+        };
+
+        // NextClosure: the closed sets in lectic order
+        Bits A = free_left(free_right(Bits(allowed_left.size(), 0), allowed_right), allowed_left);
+        output(A);
+        while (A != allowed_left) {
+            bool found = false;
+            for (size_t k = allowed.size(); k-- > 0 && !found;) {
+                size_t i = allowed[k];
+                if (test_bit(A, i)) {
+                    reset_bit(A, i);
+                    continue;
+                }
+                Bits candidate = A;
+                set_bit(candidate, i);
+                Bits closed = free_left(free_right(candidate, allowed_right), allowed_left);
+
+                // Keep it if it adds no vertex before i
+                bool adds_before_i = false;
+                for (size_t word = 0; word < closed.size() && !adds_before_i; word++) {
+                    uint64_t added = closed[word] & ~A[word];
+                    if (added) {
+                        adds_before_i = 64*word + __builtin_ctzll(added) < i;
+                        break;
+                    }
+                }
+                if (!adds_before_i) {
+                    A = closed;
+                    output(A);
+                    found = true;
+                }
+            }
+            if (!found) break;
+        }
+
+    }
+
+};
+
+}
+
+
+/**
+ * Output all maximal independent sets in the subgraph of g induced by
+ * vertices, each as a vector of labels of g in ascending order, using the OCT
+ * decomposition of g given by oct_set and left_partition (every other vertex
+ * being on the right). The sets are those get_all_mis outputs.
+ *
+ * If mis_cache is given, it is used as by get_all_mis.
+ */
+std::vector<std::vector<size_t>> get_all_mis_near_bipartite(const Graph & g,
+                                                            const std::vector<size_t> & vertices,
+                                                            const OrderedVertexSet & oct_set,
+                                                            const OrderedVertexSet & left_partition,
+                                                            MISCache * mis_cache) {
+
+    std::vector<std::vector<size_t>> list_of_MIS;
+
+    MISCache::Key key;
+    bool cacheable = mis_cache != nullptr && mis_cache->make_key(g, vertices, key);
+    if (cacheable && mis_cache->lookup(key, vertices, list_of_MIS)) return list_of_MIS;
+
+    NearBipartiteMIS enumerator(g, vertices, oct_set, left_partition);
+    if (enumerator.get_oct_part_size() > MAX_OCT_PART) {
+        return get_all_mis(g, vertices, mis_cache);
+    }
+    enumerator.enumerate(list_of_MIS);
+    if (cacheable) mis_cache->insert(key, list_of_MIS);
+
+    // Convert each MIS to use labelling of g instead of positions in vertices
+    convert_node_labels_vector_inplace(list_of_MIS, vertices);
+    return list_of_MIS;
+
+}
@@ -0,0 +1,24 @@
+/**
+* @authors Eric Horton, Kyle Kloster, Drew van der Poel
+*
+* This file is part of MI-bicliques, https://github.com/TheoryInPractice/MI-bicliques,
+* and is Copyright (C) North Carolina State University, 2018.
+* It is licensed under the three-clause BSD license; see LICENSE.
+*/
+
+#ifndef BICLIQUES_NEARBIPARTITEMIS_H
+#define BICLIQUES_NEARBIPARTITEMIS_H
+
+#include <vector>
+#include "../graph/Graph.h"
+#include "../graph/OrderedVertexSet.h"
+#include "MISCache.h"
+
+
+std::vector<std::vector<size_t>> get_all_mis_near_bipartite(const Graph & g,
+                                                            const std::vector<size_t> & vertices,
+                                                            const OrderedVertexSet & oct_set,
+                                                            const OrderedVertexSet & left_partition,
+                                                            MISCache * mis_cache = nullptr);
+
+#endif //BICLIQUES_NEARBIPARTITEMIS_H
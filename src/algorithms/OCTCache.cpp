@@ -0,0 +1,244 @@
+/**
+ * An OCT decomposition cache file keeps the OCT decomposition computed for
+ * each connected component of a graph, in external vertex labels:
+ *
+ *     fingerprint <hash of the graph>
+ *     options <how the decompositions were computed>
+ *     oct <vertices>
+ *     left <vertices>
+ *     right <vertices>
+ *     oct ...
+ *
+ * with one oct, left and right line for each component, and lines starting
+ * with # ignored. The fingerprint is a 64-bit FNV-1a hash of the vertex
+ * labels and edges, sorted, so it does not depend on the order of the input
+ * file. A cache is only read back for a graph with the same fingerprint,
+ * decomposed with the same options, and only if it is a valid OCT
+ * decomposition of the graph. An existing file is only replaced if its first
+ * line is the header every cache file starts with, so that a mistyped path
+ * does not overwrite some other file.
+ *
+ * @authors Eric Horton, Kyle Kloster, Drew van der Poel
+ *
+ * This file is part of MI-bicliques, https://github.com/TheoryInPractice/MI-bicliques,
+ * and is Copyright (C) North Carolina State University, 2018.
+ * It is licensed under the three-clause BSD license; see LICENSE.
+ */
+
+#include <algorithm> // for std::sort
+#include <cstdint>
+#include <cstdio> // for snprintf
+#include <fstream>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+#include "OCTCache.h"
+
+
+namespace {
+
+const uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+const uint64_t FNV_PRIME = 1099511628211ULL;
+
+// First line of every cache file
+const std::string CACHE_HEADER = "# OCT decomposition of each connected component";
+
+void fnv1a(uint64_t & hash, const std::string & s) {
+    for (unsigned char c : s) {
+        hash ^= c;
+        hash *= FNV_PRIME;
+    }
+}
+
+}
+
+
+/**
+ * Hash of the vertex labels and edges of g, independent of their order, as
+ * 16 hex digits.
+ */
+std::string graph_fingerprint(const Graph & g) {
+
+    std::vector<std::string> labels;
+    std::vector<std::pair<std::string, std::string>> edges;
+    for (size_t v = 0; v < g.get_num_vertices(); v++) {
+        std::string v_label = g.get_external_vertex_label(v);
+        labels.push_back(v_label);
+        for (size_t u : g.get_neighbors_vector(v)) {
+            std::string u_label = g.get_external_vertex_label(u);
+            if (v_label < u_label) edges.emplace_back(v_label, u_label);
+        }
+    }
+    std::sort(labels.begin(), labels.end());
+    std::sort(edges.begin(), edges.end());
+
+    uint64_t hash = FNV_OFFSET_BASIS;
+    fnv1a(hash, std::to_string(labels.size()) + " " + std::to_string(edges.size()) + "\n");
+    for (auto & label : labels) fnv1a(hash, label + "\n");
+    for (auto & edge : edges) fnv1a(hash, edge.first + " " + edge.second + "\n");
+
+    char hex[17];
+    snprintf(hex, sizeof(hex), "%016llx", (unsigned long long) hash);
+    return std::string(hex);
+
+}
+
+
+/**
+ * The options that determine the decompositions computed, as one line; the
+ * number of threads does not.
+ */
+std::string oct_options_key(const OCTSearchOptions & options) {
+    std::ostringstream key;
+    key << "search " << options.time_budget << " restarts " << options.num_restarts;
+    key << " seed " << options.seed << " portfolio " << options.portfolio_starts;
+    key << " exact " << options.exact_time_cap;
+    return key.str();
+}
+
+
+/**
+ * Read the OCT decomposition cached for g in filename.
+ *
+ * @param filename        Cache file.
+ * @param g               Graph decomposed.
+ * @param options_key     oct_options_key of the options the run would use.
+ * @param oct_set         OCT set read.
+ * @param left_partition  Left partition read.
+ * @param right_partition Right partition read.
+ * @return                False, leaving the sets unchanged, if there is no
+ *                        cache for g and these options, or it is invalid.
+ */
+bool read_oct_cache(const std::string & filename,
+                    const Graph & g,
+                    const std::string & options_key,
+                    OrderedVertexSet & oct_set,
+                    OrderedVertexSet & left_partition,
+                    OrderedVertexSet & right_partition) {
+
+    std::ifstream infile(filename);
+    if (!infile) return false;
+
+    size_t num_vertices = g.get_num_vertices();
+    std::vector<std::vector<size_t>> sets(3);
+    std::vector<bool> seen(num_vertices, false);
+    bool fingerprint_matches = false, options_match = false;
+
+    std::string line_string;
+    while (std::getline(infile, line_string)) {
+        std::stringstream line(line_string);
+        std::string tag;
+        if (!(line >> tag) || tag[0] == '#') continue;
+
+        if (tag == "fingerprint") {
+            std::string fingerprint;
+            line >> fingerprint;
+            fingerprint_matches = (fingerprint == graph_fingerprint(g));
+            if (!fingerprint_matches) return false;
+            continue;
+        }
+        if (tag == "options") {
+            std::string key;
+            std::getline(line >> std::ws, key);
+            options_match = (key == options_key);
+            if (!options_match) return false;
+            continue;
+        }
+
+        size_t which_set;
+        if (tag == "oct") which_set = 0;
+        else if (tag == "left") which_set = 1;
+        else if (tag == "right") which_set = 2;
+        else return false;
+
+        std::string label;
+        while (line >> label) {
+            size_t v = 0;
+            if (!g.get_internal_vertex_label(label, v) || seen[v]) return false;
+            seen[v] = true;
+            sets[which_set].push_back(v);
+        }
+    }
+    if (!fingerprint_matches || !options_match) return false;
+
+    // Every vertex is in one set, and neither partition has an edge
+    for (size_t v = 0; v < num_vertices; v++) {
+        if (!seen[v]) return false;
+    }
+    for (auto & partition : sets) std::sort(partition.begin(), partition.end());
+    OrderedVertexSet cached_oct(sets[0]), cached_left(sets[1]), cached_right(sets[2]);
+    for (const OrderedVertexSet * partition : {&cached_left, &cached_right}) {
+        for (size_t v : *partition) {
+            for (size_t u : g.get_neighbors_vector(v)) {
+                if (partition->has_vertex(u)) return false;
+            }
+        }
+    }
+
+    oct_set = std::move(cached_oct);
+    left_partition = std::move(cached_left);
+    right_partition = std::move(cached_right);
+    return true;
+
+}
+
+
+/**
+ * Check whether filename may be written as a cache: it does not exist, or it
+ * starts with the header of a cache file.
+ */
+bool may_overwrite_oct_cache(const std::string & filename) {
+
+    std::ifstream infile(filename);
+    if (!infile) return true;
+
+    std::string line;
+    return std::getline(infile, line) && line == CACHE_HEADER;
+
+}
+
+
+/**
+ * Write the OCT decomposition of g, computed for each of its connected
+ * components, to filename.
+ *
+ * @param filename        Cache file, replaced if it exists and
+ *                        may_overwrite_oct_cache allows it.
+ * @param g               Graph decomposed.
+ * @param options_key     oct_options_key of the options used.
+ * @param vector_of_ccs   Connected components of g.
+ * @param oct_set         OCT set of g.
+ * @param left_partition  Left partition of g; every other vertex is right.
+ * @return                Whether the file was written.
+ */
+bool write_oct_cache(const std::string & filename,
+                     const Graph & g,
+                     const std::string & options_key,
+                     const std::vector<std::vector<size_t>> & vector_of_ccs,
+                     const OrderedVertexSet & oct_set,
+                     const OrderedVertexSet & left_partition) {
+
+    if (!may_overwrite_oct_cache(filename)) return false;
+
+    std::ofstream outfile(filename);
+    if (!outfile) return false;
+
+    outfile << CACHE_HEADER << std::endl;
+    outfile << "fingerprint " << graph_fingerprint(g) << std::endl;
+    outfile << "options " << options_key << std::endl;
+
+    for (auto & vertex_subset : vector_of_ccs) {
+        std::vector<std::string> rows = {"oct", "left", "right"};
+        for (size_t v : vertex_subset) {
+            std::string & row = oct_set.has_vertex(v) ? rows[0] :
+                                left_partition.has_vertex(v) ? rows[1] : rows[2];
+            row += " " + g.get_external_vertex_label(v);
+        }
+        for (auto & row : rows) outfile << row << "\n";
+    }
+    outfile.close();
+
+    return !outfile.fail();
+
+}
@@ -0,0 +1,42 @@
+/**
+ * Files keeping the OCT decompositions computed for a graph, so that later
+ * runs on the same graph can reuse them. See OCTCache.cpp for full
+ * documentation.
+ *
+ * @authors Eric Horton, Kyle Kloster, Drew van der Poel
+ *
+ * This file is part of MI-bicliques, https://github.com/TheoryInPractice/MI-bicliques,
+ * and is Copyright (C) North Carolina State University, 2018.
+ * It is licensed under the three-clause BSD license; see LICENSE.
+ */
+
+#ifndef BICLIQUES_OCTCACHE_H
+#define BICLIQUES_OCTCACHE_H
+
+#include <string>
+#include "../graph/OrderedVertexSet.h"
+#include "../graph/Graph.h"
+#include "OCTDecomposition.h"
+
+
+std::string graph_fingerprint(const Graph & g);
+std::string oct_options_key(const OCTSearchOptions & options);
+
+bool read_oct_cache(const std::string & filename,
+                    const Graph & g,
+                    const std::string & options_key,
+                    OrderedVertexSet & oct_set,
+                    OrderedVertexSet & left_partition,
+                    OrderedVertexSet & right_partition);
+
+bool may_overwrite_oct_cache(const std::string & filename);
+
+bool write_oct_cache(const std::string & filename,
+                     const Graph & g,
+                     const std::string & options_key,
+                     const std::vector<std::vector<size_t>> & vector_of_ccs,
+                     const OrderedVertexSet & oct_set,
+                     const OrderedVertexSet & left_partition);
+
+
+#endif //BICLIQUES_OCTCACHE_H
@@ -0,0 +1,109 @@
+/**
+ * octdecomposition finds an OCT decomposition of a graph in up to three
+ * stages, each starting from the last:
+ *
+ * - simpleoct, a greedy BFS coloring;
+ * - localsearchoct, which shrinks the OCT set by local search, if given a
+ *   time budget, or instead octportfolio, which keeps the best of many
+ *   randomized starts, if asked for some; and
+ * - exactoct, which finds a minimum OCT set by iterative compression, if
+ *   given a time cap. Its running time grows as 3^k in the OCT size k, so
+ *   past a few dozen vertices it will not finish; the decomposition found
+ *   by the earlier stages is then kept.
+ *
+ * @authors Eric Horton, Kyle Kloster, Drew van der Poel
+ *
+ * This file is part of MI-bicliques, https://github.com/TheoryInPractice/MI-bicliques,
+ * and is Copyright (C) North Carolina State University, 2018.
+ * It is licensed under the three-clause BSD license; see LICENSE.
+ */
+
+#include <algorithm> // for std::sort
+#include <vector>
+
+#include "OCTDecomposition.h"
+#include "ExactOCT.h"
+#include "LocalSearchOCT.h"
+#include "OCTPortfolio.h"
+#include "SimpleOCT.h"
+
+
+/**
+ * Compute an OCT decomposition of g as the options ask (see above). If
+ * oct_set is prescribed, this is simpleoct.
+ *
+ * @param g               Graph to decompose.
+ * @param oct_set         OCT set found; if not empty, kept as it is.
+ * @param left_partition  Left partition found, with every isolated vertex.
+ * @param right_partition Right partition found.
+ * @param options         Local search budget, portfolio starts and exact
+ *                        search cap.
+ * @param log             Where the portfolio's report is written.
+ */
+void octdecomposition(const Graph & g,
+                      OrderedVertexSet & oct_set,
+                      OrderedVertexSet & left_partition,
+                      OrderedVertexSet & right_partition,
+                      const OCTSearchOptions & options,
+                      std::ostream & log) {
+
+    if (oct_set.size() > 0) {
+        simpleoct(g, oct_set, left_partition, right_partition);
+        return;
+    }
+
+    if (options.portfolio_starts > 0) {
+        octportfolio(g, oct_set, left_partition, right_partition, options).print(log);
+    }
+    else {
+        localsearchoct(g, oct_set, left_partition, right_partition, options);
+    }
+
+    // An empty OCT set is already minimum
+    if (options.exact_time_cap <= 0 || oct_set.size() == 0) return;
+
+    // exactoct leaves the sets alone if it runs out of time
+    exactoct(g, oct_set, left_partition, right_partition, options.exact_time_cap);
+
+}
+
+
+/**
+ * Compute an OCT decomposition of g by octdecomposition on each of its
+ * connected components, as the OCT algorithms do when given none.
+ *
+ * @param g               Graph to decompose.
+ * @param vector_of_ccs   Connected components of g.
+ * @param oct_set         OCT set found.
+ * @param left_partition  Left partition found.
+ * @param right_partition Right partition found.
+ * @param options         Local search budget, portfolio starts and exact
+ *                        search cap.
+ * @param log             Where the portfolio's reports are written.
+ */
+void octdecomposition_by_component(const Graph & g,
+                                   const std::vector<std::vector<size_t>> & vector_of_ccs,
+                                   OrderedVertexSet & oct_set,
+                                   OrderedVertexSet & left_partition,
+                                   OrderedVertexSet & right_partition,
+                                   const OCTSearchOptions & options,
+                                   std::ostream & log) {
+
+    std::vector<std::vector<size_t>> sets(3);
+    for (auto & vertex_subset : vector_of_ccs) {
+        Graph g_cc = g.subgraph(vertex_subset);
+        OrderedVertexSet oct_set_cc, left_set_cc, right_set_cc;
+        octdecomposition(g_cc, oct_set_cc, left_set_cc, right_set_cc, options, log);
+
+        // Vertex idx of the subgraph is vertex_subset[idx] of g
+        for (size_t idx : oct_set_cc) sets[0].push_back(vertex_subset[idx]);
+        for (size_t idx : left_set_cc) sets[1].push_back(vertex_subset[idx]);
+        for (size_t idx : right_set_cc) sets[2].push_back(vertex_subset[idx]);
+    }
+
+    for (auto & partition : sets) std::sort(partition.begin(), partition.end());
+    oct_set = OrderedVertexSet(sets[0]);
+    left_partition = OrderedVertexSet(sets[1]);
+    right_partition = OrderedVertexSet(sets[2]);
+
+}
@@ -0,0 +1,57 @@
+/**
+ * octdecomposition finds the OCT decomposition each OCT algorithm runs on,
+ * by whichever of simpleoct, localsearchoct and exactoct the options ask for.
+ * See OCTDecomposition.cpp for full documentation.
+ *
+ * @authors Eric Horton, Kyle Kloster, Drew van der Poel
+ *
+ * This file is part of MI-bicliques, https://github.com/TheoryInPractice/MI-bicliques,
+ * and is Copyright (C) North Carolina State University, 2018.
+ * It is licensed under the three-clause BSD license; see LICENSE.
+ */
+
+#ifndef BICLIQUES_OCTDECOMPOSITION_H
+#define BICLIQUES_OCTDECOMPOSITION_H
+
+#include <iostream>
+#include "../graph/OrderedVertexSet.h"
+#include "../graph/Graph.h"
+#include "stddef.h"  // apparently required for size_t
+
+
+/**
+ * How an OCT decomposition is found. localsearchoct searches for time_budget
+ * seconds, covering all restarts together; no local search if it is 0. With
+ * portfolio_starts, octportfolio instead runs that many starts on num_threads
+ * threads, within the same time budget. exactoct then searches for a minimum
+ * OCT set for up to exact_time_cap seconds; no exact search if it is 0.
+ */
+struct OCTSearchOptions {
+    double time_budget = 0.0;
+    size_t num_restarts = 16;
+    unsigned long seed = 0;
+    size_t portfolio_starts = 0;
+    size_t num_threads = 1;
+    double exact_time_cap = 0.0;
+
+    inline bool is_active() const { return time_budget > 0; }
+};
+
+
+void octdecomposition(const Graph & g,
+                      OrderedVertexSet & oct_set,
+                      OrderedVertexSet & left_partition,
+                      OrderedVertexSet & right_partition,
+                      const OCTSearchOptions & options,
+                      std::ostream & log = std::cout);
+
+void octdecomposition_by_component(const Graph & g,
+                                   const std::vector<std::vector<size_t>> & vector_of_ccs,
+                                   OrderedVertexSet & oct_set,
+                                   OrderedVertexSet & left_partition,
+                                   OrderedVertexSet & right_partition,
+                                   const OCTSearchOptions & options,
+                                   std::ostream & log = std::cout);
+
+
+#endif //BICLIQUES_OCTDECOMPOSITION_H
@@ -6,13 +6,14 @@
 * It is licensed under the three-clause BSD license; see LICENSE.
 */
 
+#include <algorithm> // for std::find
+#include <atomic>
 #include <ctime> // for timing
-#include <csignal> // for triggering early termination
-#include <list>
 
 #include "OCTMIB.h"
 #include "MaximalCrossingBicliques.h"
 #include "MaximalCrossingBicliquesBipartite.h"
+#include "ComponentScheduler.h"
 #include "SimpleCCs.h"
 
 #include "../graph/OrderedVector.h"
@@ -24,27 +25,27 @@
  void process_expansion_result(OutputOptions & octmib_results,
                                BlueprintLite & current_blueprint,
                                ExpansionResult & expand_result,
-                               std::unordered_map<std::string,bool> & global_duplicates_table,
+                               DuplicatesTable & global_duplicates_table,
                                std::unordered_map<std::string,bool> & local_duplicates_table,
-                               std::list<SearchTreeBag> & bag_list,
+                               SearchTreeBag & expanded_bag,
                                SearchTreeBag & next_bag) {
 
     auto expand_result_type = expand_result.get_return_type();
 
     if (expand_result_type == ExpansionResult::RETURN_TYPE::SUCCESS) {
 
-        current_blueprint.update_iterative_ptrs(next_bag.get_iterative_wait_ptr(),
-                                                next_bag.get_iterative_in_ptr(),
-                                                next_bag.get_iterative_past_ptr());
-
+        const IterativeSets & next_iterative = next_bag.get_iterative();
         size_t next_future_maximal_vertex = current_blueprint.get_last_vertex();
 
         // If maximal, add to output list
-        if (current_blueprint.is_currently_maximal(next_future_maximal_vertex)) {
-            std::string this_blueprint_string = current_blueprint.get_biclique_string();
-            if (global_duplicates_table.find(this_blueprint_string) == global_duplicates_table.end()) {
-                octmib_results.push_back(current_blueprint.get_biclique());
-                global_duplicates_table[this_blueprint_string] = true;
+        if (current_blueprint.is_currently_maximal(next_iterative, next_future_maximal_vertex)) {
+            std::string this_blueprint_string = current_blueprint.get_biclique_string(next_iterative);
+            if (global_duplicates_table.insert(this_blueprint_string)) {
+                if (octmib_results.count_only_mode) {
+                    octmib_results.count(current_blueprint.get_left_size(next_iterative),
+                                         current_blueprint.get_right_size());
+                }
+                else octmib_results.push_back(current_blueprint.get_biclique(next_iterative));
             }
         }
         // Regardless of maximality, update next_future_maximal_vertex
@@ -58,608 +59,1138 @@
         return;
     }
     else {
-        // BAN
-        handle_bans(current_blueprint.get_id(),
-                    expand_result.get_vertex(),
-                    bag_list);
+        // BAN, in the children of expanded_bag expanded before this one
+        expanded_bag.record_child_ban(current_blueprint.get_id(),
+                                      expand_result.get_vertex());
     } // end all ban checks
 
 }
 
 
- /**
-  * Implements our Maximal Induced Biclique algorithm exploiting an OCT set.
-  *
-  * - Compute OCT decomposition using simple BFS coloring algorithm.
-  *
-  * - on the biparite portion, use our MCB algorithm to find all bicliques there.
-  * - check those bicliques against the OCT set to check for maximality.
-  *
-  * - Use our implementation of Eppstein's algorithm to compute all MIS in OCT
-  * - iterate over MIS in OCT, extract relevant portions from L and R partitions
-  * - use our MCB to extract MIBs on relevant subgraph determined this way
-  *
-  * - heavily uses BlueprintLite::expand
-  */
-void octmib_with_oct(OutputOptions & octmib_results, OctGraph &og) {
+/**
+ * Append to `seeds` a blueprint seed for each crossing biclique found by MCB
+ * on og.subgraph(vertices) between `side` and the rest, skipping bicliques
+ * that some vertex of `other_side` not adjacent to v could extend (those are
+ * found from another root).
+ */
+void octmib_add_mcb_seeds(OutputOptions & octmib_results,
+                          OctGraph & og,
+                          const OrderedVertexSet & v_neighb,
+                          const OrderedVector & non_oct_non_v_neighb_vertices,
+                          const std::vector<size_t> & vertices,
+                          const OrderedVector & side,
+                          const OrderedVector & other_side,
+                          const SizeConstraints & mcb_size_constraints,
+                          std::vector<BlueprintSeed> & seeds) {
+
+    clock_t begin_mcb_timing = std::clock();
+
+    Graph subgraph = og.subgraph(vertices);
+
+    // Must convert global labels to subgraph labels.
+    std::vector<size_t> subgraph_labels_for_side;
+    for (size_t temp_i=0; temp_i < vertices.size(); temp_i++) {
+        if (side.has_vertex(vertices[temp_i])) {
+            subgraph_labels_for_side.push_back(temp_i);
+        }
+    }
 
-    std::unordered_map<std::string, bool> global_duplicates_table;
+    OutputOptions mcb_results;
+    mcb_results.size_constraints = mcb_size_constraints;
+    mcb_results.mis_cache = octmib_results.mis_cache;
+    mcb_results.max_frontier_bytes = octmib_results.max_frontier_bytes;
+    maximal_crossing_bicliques(mcb_results, subgraph, OrderedVector(subgraph_labels_for_side));
+    auto & mcbs_list = mcb_results.mibs_computed;
 
-    auto graph_ptr = std::make_shared<Graph>(og);
+    convert_node_labels_biclique(mcbs_list, vertices);
 
-    const OrderedVertexSet & left_partition = og.get_left();
-    const OrderedVertexSet & oct_set = og.get_oct();
-    const OrderedVertexSet & right_partition = og.get_right();
+    clock_t end_mcb_timing = std::clock();
+    octmib_results.time_mcbs += double(end_mcb_timing - begin_mcb_timing) / CLOCKS_PER_SEC;
 
-    const OrderedVector left_partition_OV(left_partition.get_vertices());
-    const OrderedVector oct_set_OV(oct_set.get_vertices());
-    const OrderedVector right_partition_OV(right_partition.get_vertices());
+    clock_t begin_mcb_checking = std::clock();
+    // for each mcb which is found, we check to see if a non-neighbor of v in
+    // other_side can be added to the side of the mcb containing side's nodes.
+    // If it can we discard the biclique as we will have found a corresponding
+    // blueprint elsewhere. Otherwise we create a blueprint for this biclique.
+    while (mcbs_list.size() > 0) {
+        const BicliqueLite & this_mcb = mcbs_list.back();
 
-    OrderedVector non_oct_vertices(left_partition_OV.set_union(right_partition_OV));
+        bool node_can_be_added_left = false;
+        const std::vector<size_t> & this_mcb_left = this_mcb.get_left();
+        const std::vector<size_t> & this_mcb_right = this_mcb.get_right();
 
-    std::vector<size_t> external_labeling;
-    bool relabel_flag = false;
-    if (octmib_results.relabeling_mode) {
-        external_labeling = octmib_results.relabeling_vector;
-        relabel_flag = true;
-    }
+        for (auto j: other_side) {
 
-    /**
-     * PHASE 1.1: run MCB (or Langston) on the bipartite graph (g - OCT)
-     */
-     clock_t begin_mcb_timing = std::clock();
+            if ( std::binary_search(this_mcb_left.begin(),
+                                    this_mcb_left.end(), j) ) continue;
+            if ( std::binary_search(this_mcb_right.begin(),
+                                    this_mcb_right.end(), j) ) continue;
 
-    // Case 1: OCT-set empty --> just run MCBB
-    if (oct_set.size() == 0) {
-        maximal_crossing_bicliques_bipartite(octmib_results,
-                                             og,
-                                             left_partition.get_vertices(),
-                                             right_partition.get_vertices() );
-    }
-    // Case 2: non-empty OCT-set
-    else {
+            if (og.is_completely_independent_from(j, this_mcb_left)
+                && og.is_completely_connect_to(j, this_mcb_right) ) {
 
-         // Extract bipartite subgraph
-        Graph g_minus_oct = og.subgraph(non_oct_vertices);
-        std::vector<size_t> bipartite_left, bipartite_right;
-        for (size_t idx=0; idx< non_oct_vertices.size(); idx++){
-            if (left_partition.has_vertex(non_oct_vertices[idx])) {
-                bipartite_left.push_back(idx);
+                node_can_be_added_left = true;
+                break;
             }
-            else bipartite_right.push_back(idx);
+        }
+        if (!node_can_be_added_left) {
+            seeds.push_back({this_mcb_right,
+                             v_neighb.set_minus_vec(this_mcb_right),
+                             this_mcb_left,
+                             non_oct_non_v_neighb_vertices.set_minus(this_mcb_left),
+                             false});
         }
 
-        // Compute mcbs on bipartite graph
-        octmib_results.turn_on_max_check_mode(global_duplicates_table, oct_set);
-        octmib_results.turn_on_relabeling_mode(non_oct_vertices);
-
-        maximal_crossing_bicliques_bipartite(octmib_results,
-                                             g_minus_oct,
-                                             bipartite_left,
-                                             bipartite_right);
-
+        mcbs_list.pop_back();
     }
 
-    // Reseting the labelling system is required in case MCBB alters labeling
-    octmib_results.turn_off_relabeling_mode();
-    octmib_results.turn_off_max_check_mode();
-    if (relabel_flag) {
-        octmib_results.turn_on_relabeling_mode(external_labeling);
-    }
+    clock_t end_mcb_checking = std::clock();
+    octmib_results.time_mcb_checking += double(end_mcb_checking - begin_mcb_checking) / CLOCKS_PER_SEC;
 
-    clock_t end_mcb_timing = std::clock();
-    octmib_results.time_bipartite_mcb += double(end_mcb_timing - begin_mcb_timing) / CLOCKS_PER_SEC;
-    // if no oct set, the graph is bipartite -- return
+}
 
-    if (oct_set.size() == 0) return;
 
+/**
+ * The size-constraint slack of the MCB runs for the search tree rooted at
+ * vertex v of mis_in_oct: MCB results later gain v and the nodes of
+ * iterative_wait on their left side. Without constraints the slack has no
+ * effect, so it is always 0 and all roots of v share their MCB seeds.
+ */
+size_t octmib_mcb_slack(const OutputOptions & octmib_results,
+                        const OrderedVector & mis_in_oct,
+                        size_t v) {
 
-    /**
-     * PHASE 2: find MIBS on the rest of the input graph
-     */
-    // Compute MIS on graph induced by OCT set
-    clock_t begin_oct_mis_timing = std::clock();
+    if (!octmib_results.size_constraints.is_active()) return 0;
+    return 1 + mis_in_oct.truncate_before_node_vec(v).size();
 
-    auto oct_subgraph = og.subgraph(oct_set);
-    auto all_mis_in_oct = get_all_mis(oct_subgraph);
-    // Convert each MIS to use labelling of graph instead of subgraph(oct_set).
-    convert_node_labels_vector_inplace(all_mis_in_oct, oct_set);
+}
 
-    // Update the OCTMIB results object
-    octmib_results.num_oct_mis += all_mis_in_oct.size();
-    octmib_results.num_oct_edges += oct_subgraph.get_num_edges();
 
-    clock_t end_oct_mis_timing = std::clock();
-    octmib_results.time_oct_MIS += double(end_oct_mis_timing - begin_oct_mis_timing) / CLOCKS_PER_SEC;
+/**
+ * Do the part of building initial bags for search trees rooted at OCT vertex
+ * v that does not depend on the MIS of the OCT set the root belongs to: find
+ * the MIS in v's neighborhood and run MCB on the two subgraphs around v, and
+ * reduce the results to blueprint seeds. MCB is run once for each slack in
+ * mcb_slacks (see octmib_mcb_slack).
+ */
+OctVertexSeeds octmib_vertex_seeds(OutputOptions & octmib_results,
+                                   OctGraph & og,
+                                   size_t v,
+                                   const std::vector<size_t> & mcb_slacks) {
 
+    const OrderedVertexSet & left_partition = og.get_left();
+    const OrderedVertexSet & oct_set = og.get_oct();
+    const OrderedVertexSet & right_partition = og.get_right();
 
-    // Process each MIS in OCT separately. For each MIS in OCT,
-    // for each node in the MIS, initialize blueprints
+    const OrderedVector left_partition_OV(left_partition.get_vertices());
+    const OrderedVector oct_set_OV(oct_set.get_vertices());
+    const OrderedVector right_partition_OV(right_partition.get_vertices());
 
-    // First, compute sum of sizes of MISes, for statistics tracking purposes.
-    for (auto & mis_in_oct : all_mis_in_oct) {
-            octmib_results.num_oct_iter_mis += mis_in_oct.size();
-    }
+    OrderedVector non_oct_vertices(left_partition_OV.set_union(right_partition_OV));
 
-    // For each maximal independent set mis of OCT
-    for (auto & temp_mis_in_oct : all_mis_in_oct) {
+    OctVertexSeeds seeds;
+    seeds.v = v;
 
-        OrderedVector mis_in_oct(temp_mis_in_oct);
+    // Compute sets relevant to v, neighb, and oct, l ,r
+    OrderedVector v_neighb_oct_OV(og.get_oct_neighbors(v).get_vertices());
+    OrderedVector v_neighb_left_OV(og.get_left_neighbors(v).get_vertices());
+    OrderedVector v_neighb_right_OV(og.get_right_neighbors(v).get_vertices());
 
-        // For each vertex v of MIS found in OCT
-        for (auto v : mis_in_oct) {
+    seeds.oct_non_v_neighb = oct_set_OV.set_minus(v_neighb_oct_OV);
 
-            // Initialization of search-tree
-            std::list<SearchTreeBag> search_tree_list;
-            size_t blueprint_id = 0;
+    // Compute all MIS in subgraph induced by v's neighborhood
+    const auto & v_neighb = og.get_neighbors(v);
+    OrderedVector v_neighb_OV(v_neighb.get_vertices());
 
-            // Compute sets relevant to v, neighb, and oct, l ,r
-            OrderedVector v_neighb_oct_OV(og.get_oct_neighbors(v).get_vertices());
-            OrderedVector v_neighb_left_OV(og.get_left_neighbors(v).get_vertices());
-            OrderedVector v_neighb_right_OV(og.get_right_neighbors(v).get_vertices());
+    clock_t begin_mis_timing = std::clock();
 
-            OrderedVector dummy_temp_OV = oct_set_OV.set_minus(v_neighb_oct_OV);
-            std::vector<size_t> oct_non_v_neighb_non_mis = dummy_temp_OV.set_minus(temp_mis_in_oct);
-            dummy_temp_OV.clear();
+    auto all_mis_in_v_neighb = get_all_mis(og, v_neighb.get_vertices(),
+                                           octmib_results.mis_cache.get());
 
-            // Compute all MIS in subgraph induced by v's neighborhood
-            const auto & v_neighb = og.get_neighbors(v);
-            OrderedVector v_neighb_OV(v_neighb.get_vertices());
-            Graph v_neighb_subgraph = og.subgraph(v_neighb);
+    clock_t end_mis_timing = std::clock();
+    octmib_results.time_iter_mis += double(end_mis_timing - begin_mis_timing) / CLOCKS_PER_SEC;
 
-            clock_t begin_mis_timing = std::clock();
+    // Compute relevant MIS information to initialize blueprints
+    OrderedVertexSet v_exclusion_set = v_neighb.set_union(oct_set); // useful as OVS
 
-            auto all_mis_in_v_neighb = get_all_mis(v_neighb_subgraph);
+    OrderedVector non_oct_non_v_neighb_vertices = non_oct_vertices;
+    non_oct_non_v_neighb_vertices.vector_minus_neighborhood(og, v);
 
-            convert_node_labels_vector_inplace(all_mis_in_v_neighb, v_neighb);
+    // for each MIS in the neighborhood of v
+    while (all_mis_in_v_neighb.size() > 0) {
+        auto & mis_in_v_neighb = all_mis_in_v_neighb.back();
 
-            clock_t end_mis_timing = std::clock();
-            octmib_results.time_iter_mis += double(end_mis_timing - begin_mis_timing) / CLOCKS_PER_SEC;
+        clock_t begin_blueprint_init_timing = std::clock();
 
-            // Compute relevant MIS information to initialize blueprints
-            OrderedVertexSet v_exclusion_set = v_neighb.set_union(oct_set); // useful as OVS
+        // We do not want to store blueprints more than once so we check to see
+        // if any nodes from the left or right partitions could be added to the biclique
+        // which includes v and the MIS in v's neighborhood
 
-            OrderedVector non_oct_non_v_neighb_vertices = non_oct_vertices;
-            non_oct_non_v_neighb_vertices.vector_minus_neighborhood(og, v);
+        // Get all nodes in left or right, that are not neighbors of v,
+        // but *are* neighbors with all nodes in mis_in_v_neighb
 
+        OrderedVector temp_set(og.get_neighborhood_intersection(mis_in_v_neighb,
+                                                     v_exclusion_set));
 
-            std::vector<size_t> mis_in_oct_truncate_after_v = mis_in_oct.truncate_after_node_vec(v);
+        auto temp_left = temp_set.set_intersection(left_partition.get_vertices());
+        auto temp_right = temp_set.set_intersection(right_partition.get_vertices());
 
-            OrderedVertexSet iterative_in((std::vector<size_t>) {v});
-            std::vector<size_t> iterative_past = mis_in_oct_truncate_after_v;
-            std::vector<size_t> iterative_wait = mis_in_oct.truncate_before_node_vec(v);
-            SearchTreeBag initial_bag(iterative_wait,
-                                      iterative_in,
-                                      iterative_past,
-                                      v);
+        // If only one of temp_left and temp_right is non-empty, skip this
+        // MIS: we'll find these MIBs via MCB below.
 
-            // for each MIS in the neighborhood of v
-            // for (auto & mis_in_v_neighb: all_mis_in_v_neighb) {
-            while (all_mis_in_v_neighb.size() > 0) {
-                auto & mis_in_v_neighb = all_mis_in_v_neighb.back();
+        // In this case we will not find this blueprint elsewhere so we initialize a
+        // blueprint here.
+        if (temp_left.size() == 0 && temp_right.size() == 0) {
 
-                clock_t begin_blueprint_init_timing = std::clock();
+            seeds.mis_seeds.push_back({mis_in_v_neighb,
+                                       v_neighb_OV.set_minus(mis_in_v_neighb),
+                                       (std::vector<size_t>) {},
+                                       non_oct_non_v_neighb_vertices.get_vertices(),
+                                       true});
 
-                bool skip_this_check = false;
-                for (auto temp_v: mis_in_oct_truncate_after_v) {
-                    if (og.is_completely_connect_to(temp_v, mis_in_v_neighb)){
-                        // continue;
-                        skip_this_check = true;
+        }
+        else if (temp_left.size() > 0 && temp_right.size() > 0) {
+        // mis_in_v_neighb has neighbors in both Left and Right which
+        // are not neighbors with v here we check if we will find a
+        // biclique which contains this MIS in another part of the algorithm
+
+            bool temp_left_node_ind_from_temp_right = false;
+            for (auto this_node: temp_left) {
+                // if no node from temp_left is completely indepenent
+                // from temp_right, then we will find a biclique which
+                // contains the MIS later on
+                if (og.is_completely_independent_from(this_node, temp_right)) {
+                    temp_left_node_ind_from_temp_right = true;
+                    break;
+                }
+            }
+            if (temp_left_node_ind_from_temp_right) {
+                bool temp_right_node_ind_from_temp_left = false;
+                // if no node from temp_right is completely independent
+                // from temp_left, then we will find a biclique which
+                // contains the MIS later on
+                for (auto this_node: temp_right) {
+                    if (og.is_completely_independent_from(this_node, temp_left)) {
+                        temp_right_node_ind_from_temp_left = true;
                         break;
                     }
                 }
-                if (skip_this_check) {
-                    all_mis_in_v_neighb.pop_back();
-                    continue;
-                }
 
-                // We do not want to store blueprints more than once so we check to see
-                // if any nodes from the left or right partitions could be added to the biclique
-                // which includes v and the MIS in v's neighborhood
+                // otherwise we find a biclique which contains this MIS now,
+                // as it will not be found elsewhere
+                if (temp_right_node_ind_from_temp_left) {
 
-                // Get all nodes in left or right, that are not neighbors of v,
-                // but *are* neighbors with all nodes in mis_in_v_neighb
+                    // Get MIS from temp_set: find all the nodes from
+                    // temp_right which are completely independent from temp_left
+                    OrderedVector temp_right_ind_from_left;
+                    for (auto this_node: temp_right) {
+                        if (og.is_completely_independent_from(this_node, temp_left)){
+                            temp_right_ind_from_left.push_back(this_node);
+                        }
+                    }
 
-                OrderedVector temp_set(og.get_neighborhood_intersection(mis_in_v_neighb,
-                                                             v_exclusion_set));
+                    std::vector<size_t> mis_in_temp_set = temp_right_ind_from_left.set_union(temp_left);
 
-                auto temp_left = temp_set.set_intersection(left_partition.get_vertices());
-                auto temp_right = temp_set.set_intersection(right_partition.get_vertices());
+                    // seed for biclique which contains the MIS
+                    seeds.mis_seeds.push_back({mis_in_v_neighb,
+                                               v_neighb_OV.set_minus(mis_in_v_neighb),
+                                               mis_in_temp_set,
+                                               non_oct_non_v_neighb_vertices.set_minus(mis_in_temp_set),
+                                               true});
 
-                // Skip these cases because we'll find these MIBs via MCB below
-                if (temp_left.size() > 0 && temp_right.size() == 0) {
-                    // continue;
-                    skip_this_check = true;
-                }
-                else if (temp_left.size() == 0 && temp_right.size() > 0) {
-                    // continue;
-                    skip_this_check = true;
                 }
+            }
+        }
 
-                // In this case we will not find this blueprint elsewhere so we initialize a
-                // blueprint here.
-                else if (temp_left.size() == 0 && temp_right.size() == 0) {
-
-                    BlueprintLite this_blueprint(
-                                                blueprint_id,
-                                                graph_ptr,
-                                                initial_bag.get_iterative_wait_ptr(),
-                                                initial_bag.get_iterative_in_ptr(),
-                                                initial_bag.get_iterative_past_ptr(),
-                                                mis_in_v_neighb,
-                                                v_neighb_OV.set_minus(mis_in_v_neighb),
-                                                (std::vector<size_t>) {},
-                                                non_oct_non_v_neighb_vertices.get_vertices(),
-                                                oct_non_v_neighb_non_mis
-                                            );
-
-                    blueprint_id++;
-                    initial_bag.add_blueprint(this_blueprint);
+        clock_t end_blueprint_init_timing = std::clock();
+        octmib_results.time_blueprint_init += double(end_blueprint_init_timing - begin_blueprint_init_timing) / CLOCKS_PER_SEC;
 
-                }
-                else {
-                // mis_in_v_neighb has neighbors in both Left and Right which
-                // are not neighbors with v here we check if we will find a
-                // biclique which contains this MIS in another part of the algorithm
-
-                    bool temp_left_node_ind_from_temp_right = false;
-                    for (auto this_node: temp_left) {
-                        // if no node from temp_left is completely indepenent
-                        // from temp_right, then we will find a biclique which
-                        // contains the MIS later on
-                        if (og.is_completely_independent_from(this_node, temp_right)) {
-                            temp_left_node_ind_from_temp_right = true;
+        all_mis_in_v_neighb.pop_back();
+    } // end FOR over inner mis
+
+    /**
+    * Now call MCB on subgraphs. We will find bicliques where v is
+    * independent from all left nodes in the biclique and completely
+    * connected to all right and OCT nodes; and then find bicliques
+    * where v is independent from all right nodes in the biclique and
+    * completely connected to all left and OCT nodes.
+    */
+    OrderedVector right_non_v_neighb = right_partition_OV.set_minus(v_neighb_OV);  // needs to be OV for has_vertex
+    OrderedVector left_non_v_neighb = left_partition_OV.set_minus(v_neighb_OV);  // needs to be OV for has_vertex
+
+    // Subgraph on (v's neighbs in oct and right + non-neighbs in left)
+    std::vector<size_t> v_oct_right_neighb = v_neighb_oct_OV.set_union(v_neighb_right_OV);
+    std::vector<size_t> v_oct_right_neighb_non_left_neighb = left_non_v_neighb.set_union(v_oct_right_neighb);
+
+    // and the reverse: (v's neighbs in oct and left + non-neighbs in right)
+    std::vector<size_t> v_oct_left_neighb = v_neighb_oct_OV.set_union(v_neighb_left_OV);
+    std::vector<size_t> v_oct_left_neighb_non_right_neighb = right_non_v_neighb.set_union(v_oct_left_neighb);
+
+    for (size_t slack : mcb_slacks) {
+
+        if (seeds.mcb_seeds.count(slack) > 0) continue;
+        std::vector<BlueprintSeed> & mcb_seeds = seeds.mcb_seeds[slack];
+
+        const SizeConstraints mcb_size_constraints =
+            octmib_results.size_constraints.relax_first_side(slack);
+
+        octmib_add_mcb_seeds(octmib_results, og, v_neighb, non_oct_non_v_neighb_vertices,
+                             v_oct_right_neighb_non_left_neighb,
+                             left_non_v_neighb, right_non_v_neighb,
+                             mcb_size_constraints, mcb_seeds);
+
+        octmib_add_mcb_seeds(octmib_results, og, v_neighb, non_oct_non_v_neighb_vertices,
+                             v_oct_left_neighb_non_right_neighb,
+                             right_non_v_neighb, left_non_v_neighb,
+                             mcb_size_constraints, mcb_seeds);
+    }
+
+    return seeds;
+}
+
+
+namespace {
+
+/**
+ * octmib_initial_bag with the blueprints built and checked by subtasks of
+ * the calling task on pool, each for a chunk of the seeds. The blueprints
+ * kept are added to the bag in the same order, and with the same IDs, as
+ * octmib_initial_bag adds them.
+ */
+SearchTreeBag octmib_initial_bag_on_pool(OutputOptions & octmib_results,
+                                         const std::shared_ptr<Graph> & graph_ptr,
+                                         const OrderedVector & mis_in_oct,
+                                         const OctVertexSeeds & seeds,
+                                         const SearchTreeBag::allocator_type & alloc,
+                                         WorkStealingPool & pool) {
+
+    size_t v = seeds.v;
+
+    std::vector<size_t> oct_non_v_neighb_non_mis = OrderedVector(seeds.oct_non_v_neighb).set_minus(mis_in_oct.get_vertices());
+
+    std::vector<size_t> mis_in_oct_truncate_after_v = mis_in_oct.truncate_after_node_vec(v);
+
+    IterativeSets iterative(mis_in_oct.get_vertices(), v);
+
+    const std::vector<BlueprintSeed> & mis_seeds = seeds.mis_seeds;
+    const std::vector<BlueprintSeed> & mcb_seeds =
+        seeds.mcb_seeds.at(octmib_mcb_slack(octmib_results, mis_in_oct, v));
+    const size_t num_seeds = mis_seeds.size() + mcb_seeds.size();
+
+    clock_t begin_blueprint_init_timing = std::clock();
+
+    // The blueprints each chunk keeps, with IDs counted from the start of the
+    // chunk, and the number of IDs it used
+    const size_t num_chunks = std::min(num_seeds, 4 * pool.size());
+    std::vector<std::vector<BlueprintLite>> kept(num_chunks);
+    std::vector<size_t> num_ids(num_chunks, 0);
+    std::atomic<size_t> num_unfinished(num_chunks);
+
+    for (size_t chunk = 0; chunk < num_chunks; chunk++) {
+        pool.submit([&, chunk] {
+            size_t end = (chunk + 1) * num_seeds / num_chunks;
+            for (size_t idx = chunk * num_seeds / num_chunks; idx < end; idx++) {
+                bool is_mis_seed = idx < mis_seeds.size();
+                const BlueprintSeed & seed = is_mis_seed ? mis_seeds[idx]
+                                                         : mcb_seeds[idx - mis_seeds.size()];
+
+                if (is_mis_seed) {
+                    bool skip_this_check = false;
+                    for (auto temp_v: mis_in_oct_truncate_after_v) {
+                        if (graph_ptr->is_completely_connect_to(temp_v, seed.completely_connected_in)){
+                            skip_this_check = true;
                             break;
                         }
                     }
-                    if (temp_left_node_ind_from_temp_right) {
-                        bool temp_right_node_ind_from_temp_left = false;
-                        // if no node from temp_right is completely independent
-                        // from temp_left, then we will find a biclique which
-                        // contains the MIS later on
-                        for (auto this_node: temp_right) {
-                            if (og.is_completely_independent_from(this_node, temp_left)) {
-                                temp_right_node_ind_from_temp_left = true;
-                                break;
-                            }
-                        }
+                    if (skip_this_check) continue;
+                }
 
-                        // otherwise we find a biclique which contains this MIS now,
-                        // as it will not be found elsewhere
-                        if (temp_right_node_ind_from_temp_left) {
-
-                            // Get MIS from temp_set: find all the nodes from
-                            // temp_right which are completely independent from temp_left
-                            OrderedVector temp_right_ind_from_left;
-                            for (auto this_node: temp_right) {
-                                if (og.is_completely_independent_from(this_node, temp_left)){
-                                    temp_right_ind_from_left.push_back(this_node);
-                                }
-                            }
-
-                            std::vector<size_t> mis_in_temp_set = temp_right_ind_from_left.set_union(temp_left);
-
-                            // create blueprint for biclique which contains the MIS
-                            BlueprintLite this_blueprint(
-                                                        blueprint_id,
-                                                        graph_ptr,
-                                                        initial_bag.get_iterative_wait_ptr(),
-                                                        initial_bag.get_iterative_in_ptr(),
-                                                        initial_bag.get_iterative_past_ptr(),
-                                                        mis_in_v_neighb,
-                                                        v_neighb_OV.set_minus(mis_in_v_neighb),
-                                                        mis_in_temp_set,
-                                                        non_oct_non_v_neighb_vertices.set_minus(mis_in_temp_set),
-                                                        oct_non_v_neighb_non_mis
-                                                        );
-
-                            blueprint_id++;
-                            initial_bag.add_blueprint(this_blueprint);
+                BlueprintLite this_blueprint(num_ids[chunk]++,
+                                             graph_ptr,
+                                             seed.completely_connected_in,
+                                             seed.completely_connected_out,
+                                             seed.independent_from_in,
+                                             seed.independent_from_out,
+                                             oct_non_v_neighb_non_mis);
 
-                        }
+                if (this_blueprint.can_be_added_left(iterative.get_past())) continue;
+                if (!this_blueprint.can_satisfy(iterative, octmib_results.size_constraints)) continue;
+
+                kept[chunk].push_back(std::move(this_blueprint));
+            }
+            num_unfinished--;
+        });
+    }
+    pool.wait(num_unfinished);
+
+    std::vector<size_t> first_id(num_chunks, 0);
+    for (size_t chunk = 1; chunk < num_chunks; chunk++) {
+        first_id[chunk] = first_id[chunk - 1] + num_ids[chunk - 1];
+    }
+
+    // octmib_initial_bag adds the blueprints of the last seeds first
+    SearchTreeBag future_maximal_bag(iterative, v, alloc);
+    for (size_t chunk = num_chunks; chunk-- > 0; ) {
+        for (auto it = kept[chunk].rbegin(); it != kept[chunk].rend(); ++it) {
+            it->set_id(first_id[chunk] + it->get_id());
+            future_maximal_bag.add_blueprint(*it);
+        }
+        std::vector<BlueprintLite>().swap(kept[chunk]);
+    }
+
+    clock_t end_blueprint_init_timing = std::clock();
+    octmib_results.time_blueprint_init += double(end_blueprint_init_timing - begin_blueprint_init_timing) / CLOCKS_PER_SEC;
+
+    return future_maximal_bag;
+}
+
+
+/**
+ * An expansion made by octmib_expand_bag_on_pool without the duplicates of
+ * the bag: its result, and what is needed to redo its duplicate check and
+ * process it. Expansions discontinued before that check are not kept.
+ */
+struct PendingExpansion {
+    ExpansionResult result;
+    size_t blueprint_id;
+    std::string partial_biclique_string;  // if the duplicates were checked
+    BlueprintLite expanded;               // on SUCCESS
+};
+
+/**
+ * octmib_expand_bag without one_child_at_a_time, with the expansions made by
+ * subtasks of the calling task on pool: for each vertex of iterative_wait,
+ * several chunks of the blueprints of current_bag, so that idle workers
+ * share a large bag. The subtasks expand without the bag's duplicates list;
+ * the expansions are then processed in the order octmib_expand_bag makes
+ * them, discontinuing those whose partial biclique an earlier one added to
+ * the list, so that the children, bans and output are the same.
+ */
+void octmib_expand_bag_on_pool(OutputOptions & octmib_results,
+                               SearchTreeBag & current_bag,
+                               DuplicatesTable & global_duplicates_table,
+                               SearchTreeStack<SearchTreeBag> & children,
+                               WorkStealingPool & pool) {
+
+    const IterativeSets & iterative = current_bag.get_iterative();
+    const IterativeSets::Slice nodes_to_expand_on = iterative.get_wait();
+
+    const size_t num_chunks = std::min(current_bag.size(), 4 * pool.size());
+    std::vector<std::vector<PendingExpansion>> expansions(nodes_to_expand_on.size() * num_chunks);
+    std::atomic<size_t> num_unfinished(expansions.size());
+
+    for (size_t wait_index = 0; wait_index < nodes_to_expand_on.size(); wait_index++) {
+        for (size_t chunk = 0; chunk < num_chunks; chunk++) {
+            pool.submit([&, wait_index, chunk] {
+                const size_t expand_node = nodes_to_expand_on[wait_index];
+                const std::unordered_map<std::string,bool> no_duplicates;
+                BlueprintLite expanded_blueprint;
+                auto & chunk_expansions = expansions[wait_index * num_chunks + chunk];
+
+                auto begin = current_bag.begin() + chunk * current_bag.size() / num_chunks;
+                auto end = current_bag.begin() + (chunk + 1) * current_bag.size() / num_chunks;
+                for (auto it = begin; it != end; ++it) {
+                    if (it->skip_expanding_vertex(expand_node, wait_index)) continue;
+
+                    ExpansionResult expand_result = it->expand(iterative,
+                                                               expand_node,
+                                                               no_duplicates,
+                                                               octmib_results.size_constraints,
+                                                               expanded_blueprint);
+                    if (expand_result.get_return_type() == ExpansionResult::RETURN_TYPE::DISCONTINUE) continue;
+
+                    chunk_expansions.push_back({expand_result, expanded_blueprint.get_id(), "", BlueprintLite()});
+                    PendingExpansion & expansion = chunk_expansions.back();
+                    if (expand_result.get_checked_duplicates()) {
+                        expansion.partial_biclique_string = expanded_blueprint.get_partial_biclique_string();
+                    }
+                    if (expand_result.get_return_type() == ExpansionResult::RETURN_TYPE::SUCCESS) {
+                        expansion.expanded = expanded_blueprint;
                     }
                 }
+                num_unfinished--;
+            });
+        }
+    }
+    pool.wait(num_unfinished);
+
+    std::unordered_map<std::string,bool> local_duplicates_table;
+    SearchTreeBag child_bag(children.get_allocator());
+    size_t first_child = children.size();
+
+    for (size_t wait_index = 0; wait_index < nodes_to_expand_on.size(); wait_index++) {
 
-                clock_t end_blueprint_init_timing = std::clock();
-                octmib_results.time_blueprint_init += double(end_blueprint_init_timing - begin_blueprint_init_timing) / CLOCKS_PER_SEC;
-
-                all_mis_in_v_neighb.pop_back();
-            } // end FOR over inner mis
-
-            /**
-            * Now call MCB on subgraphs. We will find bicliques where v is
-            * independent from all left nodes in the biclique and completely
-            * connected to all right and OCT nodes; and then find bicliques
-            * where v is independent from all right nodes in the biclique and
-            * completely connected to all left and OCT nodes.
-            */
-            clock_t begin_mcb_timing = std::clock();
-
-            // we begin by making the subgraphs
-            OrderedVector right_non_v_neighb = right_partition_OV.set_minus(v_neighb_OV);  // needs to be OV for has_vertex
-            OrderedVector left_non_v_neighb = left_partition_OV.set_minus(v_neighb_OV);  // needs to be OV for has_vertex
-
-            // Get subgraph on (v's neighbs in oct and right + non-neighbs in left)
-            std::vector<size_t> v_oct_right_neighb = v_neighb_oct_OV.set_union(v_neighb_right_OV);
-            OrderedVector v_oct_right_neighb_non_left_neighb = left_non_v_neighb.set_union(v_oct_right_neighb);
-
-            Graph subgraph_v_oct_right_neighb_non_left_neighb = og.subgraph(v_oct_right_neighb_non_left_neighb);
-
-            // Must convert global labels to subgraph labels.
-            OrderedVector subgraph_labels_for_left_non_v_neighb;
-            for (size_t temp_i=0; temp_i < v_oct_right_neighb_non_left_neighb.size(); temp_i++) {
-                size_t temp_global_idx = v_oct_right_neighb_non_left_neighb[temp_i];
-                if (left_non_v_neighb.has_vertex(temp_global_idx)) {
-                    subgraph_labels_for_left_non_v_neighb.push_back(temp_i);
+        child_bag.assign_child(current_bag, nodes_to_expand_on[wait_index]);
+
+        for (size_t chunk = 0; chunk < num_chunks; chunk++) {
+            auto & chunk_expansions = expansions[wait_index * num_chunks + chunk];
+            for (auto & expansion : chunk_expansions) {
+
+                // Discontinued by the duplicate check, as in BlueprintLite::expand
+                if (expansion.result.get_checked_duplicates() &&
+                    local_duplicates_table.count(expansion.partial_biclique_string) > 0) continue;
+
+                if (expansion.result.get_return_type() == ExpansionResult::RETURN_TYPE::BAN) {
+                    current_bag.record_child_ban(expansion.blueprint_id,
+                                                 expansion.result.get_vertex());
+                    continue;
                 }
+
+                process_expansion_result(octmib_results,
+                                         expansion.expanded,
+                                         expansion.result,
+                                         global_duplicates_table,
+                                         local_duplicates_table,
+                                         current_bag,
+                                         child_bag);
             }
+            std::vector<PendingExpansion>().swap(chunk_expansions);
+        }
 
-            auto mcbs_list = maximal_crossing_bicliques(subgraph_v_oct_right_neighb_non_left_neighb,
-                                       subgraph_labels_for_left_non_v_neighb);
+        if (child_bag.size() > 0) children.push(child_bag);
+    }
+
+    current_bag.apply_child_bans(children, first_child);
+    children.reverse(first_child);
+
+}
 
-            convert_node_labels_biclique(mcbs_list,
-                                         v_oct_right_neighb_non_left_neighb);
+}
 
-            clock_t end_mcb_timing = std::clock();
-            octmib_results.time_mcbs += double(end_mcb_timing - begin_mcb_timing) / CLOCKS_PER_SEC;
 
-            clock_t begin_mcb_checking = std::clock();
-            // for each mcb which is found, we check to see if a right non-neighbor of v can be added to the side of the mcb containing
-            // left nodes. If it can we discard the biclique as we will have found a corresponding blueprint elsewhere. Otherwise
-            // we create a blueprint for this biclique.
-            while (mcbs_list.size() > 0) {
-                const BicliqueLite & this_mcb = mcbs_list.back();
+/**
+ * Build the first bag of the search tree that OCT-MIB grows from vertex
+ * seeds.v of mis_in_oct, a maximal independent set of the OCT set, from the
+ * blueprint seeds of that vertex. Seeds from an MIS of v's neighborhood that
+ * a later vertex of mis_in_oct is completely connected to are skipped, as
+ * are blueprints that are not future maximal or cannot meet the size
+ * constraints. The bag is allocated with alloc, such as that of the stack it
+ * is to be pushed on. Called from a task on `pool`, a bag from many seeds is
+ * built by subtasks of that task (see octmib_initial_bag_on_pool).
+ */
+SearchTreeBag octmib_initial_bag(OutputOptions & octmib_results,
+                                 const std::shared_ptr<Graph> & graph_ptr,
+                                 const OrderedVector & mis_in_oct,
+                                 const OctVertexSeeds & seeds,
+                                 const SearchTreeBag::allocator_type & alloc,
+                                 WorkStealingPool * pool) {
+
+    size_t v = seeds.v;
+    size_t blueprint_id = 0;
+
+    const std::vector<BlueprintSeed> & mcb_seeds =
+        seeds.mcb_seeds.at(octmib_mcb_slack(octmib_results, mis_in_oct, v));
+
+    if (pool != nullptr && pool->worker_index() < pool->size() &&
+        seeds.mis_seeds.size() + mcb_seeds.size() >= octmib_results.min_pool_work) {
+        return octmib_initial_bag_on_pool(octmib_results, graph_ptr, mis_in_oct, seeds,
+                                          alloc, *pool);
+    }
 
-                bool node_can_be_added_left = false;
-                const std::vector<size_t> & this_mcb_left = this_mcb.get_left();
-                const std::vector<size_t> & this_mcb_right = this_mcb.get_right();
+    std::vector<size_t> oct_non_v_neighb_non_mis = OrderedVector(seeds.oct_non_v_neighb).set_minus(mis_in_oct.get_vertices());
 
-                for (auto j: right_non_v_neighb) {
+    std::vector<size_t> mis_in_oct_truncate_after_v = mis_in_oct.truncate_after_node_vec(v);
 
-                    if ( std::binary_search(this_mcb_left.begin(),
-                                            this_mcb_left.end(), j) ) continue;
-                    if ( std::binary_search(this_mcb_right.begin(),
-                                            this_mcb_right.end(), j) ) continue;
+    // iterative_in is {v}, iterative_past the vertices of mis_in_oct before
+    // it and iterative_wait those after
+    IterativeSets iterative(mis_in_oct.get_vertices(), v);
+    SearchTreeBag initial_bag(iterative, v);
 
-                    if (og.is_completely_independent_from(j, this_mcb_left)
-                        && og.is_completely_connect_to(j, this_mcb_right) ) {
+    clock_t begin_blueprint_init_timing = std::clock();
 
-                        node_can_be_added_left = true;
-                        break;
-                    }
-                }
-                if (!node_can_be_added_left) {
-                    BlueprintLite this_blueprint(blueprint_id,
-                                                 graph_ptr,
-                                                 initial_bag.get_iterative_wait_ptr(),
-                                                 initial_bag.get_iterative_in_ptr(),
-                                                 initial_bag.get_iterative_past_ptr(),
-                                                 this_mcb_right,
-                                                 v_neighb.set_minus_vec(this_mcb_right),
-                                                 this_mcb_left,
-                                                 non_oct_non_v_neighb_vertices.set_minus(this_mcb_left),
-                                                 oct_non_v_neighb_non_mis
-                                                );
-
-                    blueprint_id++;
-                    initial_bag.add_blueprint(this_blueprint);
-                }
+    for (const BlueprintSeed & seed : seeds.mis_seeds) {
 
-                mcbs_list.pop_back();
+        bool skip_this_check = false;
+        for (auto temp_v: mis_in_oct_truncate_after_v) {
+            if (graph_ptr->is_completely_connect_to(temp_v, seed.completely_connected_in)){
+                skip_this_check = true;
+                break;
             }
+        }
+        if (skip_this_check) continue;
+
+        BlueprintLite this_blueprint(blueprint_id,
+                                     graph_ptr,
+                                     seed.completely_connected_in,
+                                     seed.completely_connected_out,
+                                     seed.independent_from_in,
+                                     seed.independent_from_out,
+                                     oct_non_v_neighb_non_mis);
+        initial_bag.add_blueprint(this_blueprint);
+        blueprint_id++;
+    }
+
+    clock_t end_blueprint_init_timing = std::clock();
+    octmib_results.time_blueprint_init += double(end_blueprint_init_timing - begin_blueprint_init_timing) / CLOCKS_PER_SEC;
+
+    clock_t begin_mcb_checking = std::clock();
+
+    for (const BlueprintSeed & seed : mcb_seeds) {
+
+        BlueprintLite this_blueprint(blueprint_id,
+                                     graph_ptr,
+                                     seed.completely_connected_in,
+                                     seed.completely_connected_out,
+                                     seed.independent_from_in,
+                                     seed.independent_from_out,
+                                     oct_non_v_neighb_non_mis);
+        initial_bag.add_blueprint(this_blueprint);
+        blueprint_id++;
+    }
+
+    // Now that we have populated initial bag with blueprints, we will check them for future maximality
+    SearchTreeBag future_maximal_bag(iterative, v, alloc);
+    while (initial_bag.size() > 0) {
+        BlueprintLite & this_blueprint = initial_bag.back();
+
+        // If anything from iterative_past can be added to blueprint,
+        // skip that blueprint -- not future maximal
+        // otherwise add it to future maximal bag
+        if (this_blueprint.can_be_added_left(iterative.get_past())) {
+            initial_bag.pop_back();
+            continue;
+        }
+
+        // Skip blueprints that can never grow into a biclique
+        // meeting the size constraints, if any are in place
+        if (!this_blueprint.can_satisfy(iterative, octmib_results.size_constraints)) {
+            initial_bag.pop_back();
+            continue;
+        }
+
+        future_maximal_bag.add_blueprint(this_blueprint);
 
-            clock_t end_mcb_checking = std::clock();
-            octmib_results.time_mcb_checking += double(end_mcb_checking - begin_mcb_checking) / CLOCKS_PER_SEC;
+        initial_bag.pop_back();
+    }
+
+    clock_t end_mcb_checking = std::clock();
+    octmib_results.time_mcb_checking += double(end_mcb_checking - begin_mcb_checking) / CLOCKS_PER_SEC;
+
+    return future_maximal_bag;
+}
+
+
+/**
+ * Build the first bag of the search tree that OCT-MIB grows from vertex v of
+ * mis_in_oct, a maximal independent set of the OCT set of og. Blueprints come
+ * from the MIS in v's neighborhood and from MCB on the two subgraphs around v;
+ * those that are not future maximal, or that cannot meet the size
+ * constraints, are dropped. To build the bags of several roots with the same
+ * v, call octmib_vertex_seeds once and use the overload above.
+ */
+SearchTreeBag octmib_initial_bag(OutputOptions & octmib_results,
+                                 OctGraph & og,
+                                 const std::shared_ptr<Graph> & graph_ptr,
+                                 const OrderedVector & mis_in_oct,
+                                 size_t v) {
+
+    OctVertexSeeds seeds = octmib_vertex_seeds(octmib_results, og, v,
+                                               {octmib_mcb_slack(octmib_results, mis_in_oct, v)});
 
+    return octmib_initial_bag(octmib_results, graph_ptr, mis_in_oct, seeds);
 
-            begin_mcb_timing = std::clock();
-            // We then repeat the process on the reversed graph.
-            // Get subgraph on (v's neighbs in oct and left + non-neighbs in right)
-            std::vector<size_t> v_oct_left_neighb = v_neighb_oct_OV.set_union(v_neighb_left_OV);
-            std::vector<size_t> v_oct_left_neighb_non_right_neighb = right_non_v_neighb.set_union(v_oct_left_neighb);
+}
 
-            Graph subgraph_v_oct_left_neighb_non_right_neighb = og.subgraph(v_oct_left_neighb_non_right_neighb);
 
-            // Must convert global labels to subgraph labels.
-            std::vector<size_t> subgraph_labels_for_right_non_v_neighb;
-            for (size_t temp_i=0; temp_i < v_oct_left_neighb_non_right_neighb.size(); temp_i++) {
-                size_t temp_global_idx = v_oct_left_neighb_non_right_neighb[temp_i];
-                if (right_non_v_neighb.has_vertex(temp_global_idx)) {
-                    subgraph_labels_for_right_non_v_neighb.push_back(temp_i);
+/**
+ * Output the bicliques of blueprints in a bag built by octmib_initial_bag
+ * that are already maximal.
+ */
+void octmib_record_initial_bag(OutputOptions & octmib_results,
+                               SearchTreeBag & initial_bag,
+                               DuplicatesTable & global_duplicates_table) {
+
+    const IterativeSets & iterative = initial_bag.get_iterative();
+
+    for (BlueprintLite & this_blueprint : initial_bag) {
+
+        size_t next_future_maximal_vertex = this_blueprint.get_last_vertex();
+        if (this_blueprint.is_currently_maximal(iterative, next_future_maximal_vertex)) {
+            auto this_blueprint_string = this_blueprint.get_biclique_string(iterative);
+            if (global_duplicates_table.insert(this_blueprint_string)) {
+                if (octmib_results.count_only_mode) {
+                    octmib_results.count(this_blueprint.get_left_size(iterative),
+                                         this_blueprint.get_right_size());
                 }
+                else octmib_results.push_back(this_blueprint.get_biclique(iterative));
             }
+        }
+    }
+}
 
-            mcbs_list = maximal_crossing_bicliques(subgraph_v_oct_left_neighb_non_right_neighb,
-                                       subgraph_labels_for_right_non_v_neighb);
 
-            convert_node_labels_biclique(mcbs_list,
-                                         v_oct_left_neighb_non_right_neighb);
+/**
+ * Expand every blueprint of current_bag on each vertex of its iterative_wait,
+ * outputting the maximal bicliques found. The non-empty child bags are
+ * pushed onto `children`, with the bans between them applied, so that they
+ * come off in the order they were expanded on.
+ *
+ * With one_child_at_a_time, no child is kept: each is planned in current_bag
+ * instead, to be rebuilt when it is needed (see SearchTreeBag::plan_child).
+ * Otherwise, called from a task on `pool`, a large bag is expanded by
+ * subtasks of that task (see octmib_expand_bag_on_pool).
+ */
+void octmib_expand_bag(OutputOptions & octmib_results,
+                       SearchTreeBag & current_bag,
+                       DuplicatesTable & global_duplicates_table,
+                       SearchTreeStack<SearchTreeBag> & children,
+                       bool one_child_at_a_time,
+                       WorkStealingPool * pool) {
+
+    // The iterative sets are the same for all blueprints in a bag together
+    const IterativeSets & iterative = current_bag.get_iterative();
+    const IterativeSets::Slice nodes_to_expand_on = iterative.get_wait();
+
+    if (pool != nullptr && pool->worker_index() < pool->size() && !one_child_at_a_time &&
+        current_bag.size() * nodes_to_expand_on.size() >= octmib_results.min_pool_work) {
+        octmib_expand_bag_on_pool(octmib_results, current_bag, global_duplicates_table,
+                                  children, *pool);
+        return;
+    }
 
-            end_mcb_timing = std::clock();
-            octmib_results.time_mcbs += double(end_mcb_timing - begin_mcb_timing) / CLOCKS_PER_SEC;
+    std::unordered_map<std::string,bool> local_duplicates_table;
 
+    // Every expansion is made into this blueprint, which is only copied into
+    // a child bag when the expansion succeeds
+    BlueprintLite expanded_blueprint(children.get_allocator());
 
-            begin_mcb_checking = std::clock();
-            // for each mcb which is found, we check to see if a left non-neighbor of v can be added to the side of the mcb containing
-            // right nodes. If it can we discard the biclique as we will have found a corresponding blueprint elsewhere. Otherwise
-            // we create a blueprint for this biclique.
-            while (mcbs_list.size() > 0) {
-                BicliqueLite & this_mcb = mcbs_list.back();
+    // Children are built here; pushing one leaves the storage of an earlier
+    // bag in its place
+    SearchTreeBag child_bag(children.get_allocator());
+    size_t first_child = children.size();
 
-                bool node_can_be_added_left = false;
-                const std::vector<size_t> & this_mcb_left = this_mcb.get_left();
-                const std::vector<size_t> & this_mcb_right = this_mcb.get_right();
+    for (size_t wait_index = 0; wait_index < nodes_to_expand_on.size(); wait_index++) {
+        const size_t expand_node = nodes_to_expand_on[wait_index];
 
-                for (auto j: left_non_v_neighb) {
+        child_bag.assign_child(current_bag, expand_node);
 
-                    if ( std::binary_search(this_mcb_left.begin(),
-                                            this_mcb_left.end(), j) ) continue;
-                    if ( std::binary_search(this_mcb_right.begin(),
-                                            this_mcb_right.end(), j) ) continue;
+        for (const BlueprintLite & this_blueprint: current_bag) {
 
-                    if (og.is_completely_independent_from(j, this_mcb_left)
-                        && og.is_completely_connect_to(j, this_mcb_right) ) {
+            // If expand_node is beyond the next node needed for maximality, skip
+            // If expand_node is banned in blueprint, skip
+            if (this_blueprint.skip_expanding_vertex(expand_node, wait_index)) continue;
 
-                        node_can_be_added_left = true;
-                        break;
-                    }
-                }
-                if (!node_can_be_added_left) {
-                    BlueprintLite this_blueprint(blueprint_id,
-                                                 graph_ptr,
-                                                 initial_bag.get_iterative_wait_ptr(),
-                                                 initial_bag.get_iterative_in_ptr(),
-                                                 initial_bag.get_iterative_past_ptr(),
-                                                 this_mcb_right,
-                                                 v_neighb.set_minus_vec(this_mcb_right),
-                                                 this_mcb_left,
-                                                 non_oct_non_v_neighb_vertices.set_minus(this_mcb_left),
-                                                 oct_non_v_neighb_non_mis
-                                                );
-
-                    blueprint_id++;
-                    initial_bag.add_blueprint(this_blueprint);
-                }
+            ExpansionResult expand_result = this_blueprint.expand(iterative,
+                                                                  expand_node,
+                                                                  local_duplicates_table,
+                                                                  octmib_results.size_constraints,
+                                                                  expanded_blueprint);
 
-                mcbs_list.pop_back();
-            }
+            // Expansion performed --
+            // Now update BAN info, add to mcb_list if applicable
+            process_expansion_result(octmib_results,
+                                     expanded_blueprint,
+                                     expand_result,
+                                     global_duplicates_table,
+                                     local_duplicates_table,
+                                     current_bag,
+                                     child_bag);
 
-            // Now that we have populated initial bag with blueprints, we will check them for future maximality
-            // and then maximality if applicable
-            SearchTreeBag future_maximal_bag(iterative_wait, iterative_in, iterative_past, v);
-            while (initial_bag.size() > 0) {
-                BlueprintLite & this_blueprint = initial_bag.back();
+        } // end FOR over blueprints in current bag
 
-                const std::vector<size_t> & iter_past = initial_bag.get_iterative_past();
+        // Keep non-empty children
+        if (child_bag.size() == 0) continue;
+        if (one_child_at_a_time) current_bag.plan_child(child_bag);
+        else children.push(child_bag);
 
-                // If anything from iter_past can be added to blueprint,
-                // skip that blueprint -- not future maximal
-                // otherwise add it to future maximal bag
-                if (this_blueprint.can_be_added_left(iter_past)) {
-                    initial_bag.pop_back();
-                    continue;
-                }
+    } // end FOR over nodes to expand current search tree bag on.
 
-                this_blueprint.update_iterative_ptrs(future_maximal_bag.get_iterative_wait_ptr(),
-                                                     future_maximal_bag.get_iterative_in_ptr(),
-                                                     future_maximal_bag.get_iterative_past_ptr());
+    if (!one_child_at_a_time) {
+        current_bag.apply_child_bans(children, first_child);
+        children.reverse(first_child);
+    }
 
-                future_maximal_bag.add_blueprint(this_blueprint);
+}
 
 
-                // now we check for maximality, if it is maximal we update appropriately
-                size_t next_future_maximal_vertex = this_blueprint.get_last_vertex();
-                if (this_blueprint.is_currently_maximal(next_future_maximal_vertex)) {
-                    auto this_blueprint_string = this_blueprint.get_biclique_string();
-                    if (global_duplicates_table.find(this_blueprint_string) == global_duplicates_table.end()) {
-                        octmib_results.push_back(this_blueprint.get_biclique());
-                        global_duplicates_table[this_blueprint_string] = true;
-                    }
-                }
-                // Regardless of maximality, update next_future_maximal_vertex
-                this_blueprint.set_next_future_maximal(next_future_maximal_vertex);
+/**
+ * Expand the bags of search_tree, and all bags they produce, depth-first
+ * until none are left.
+ *
+ * Once the bag being expanded and those waiting on search_tree hold more
+ * than octmib_results.max_frontier_bytes, a bag's children are no longer all
+ * kept: the bag stays on the stack and its children are rebuilt one at a
+ * time, each expanded fully before the next is built. Bags are given `pool`;
+ * see octmib_expand_bag.
+ */
+void octmib_expand_search_tree(OutputOptions & octmib_results,
+                               SearchTreeStack<SearchTreeBag> & search_tree,
+                               DuplicatesTable & global_duplicates_table,
+                               WorkStealingPool * pool) {
 
-                initial_bag.pop_back();
-            }
+    clock_t begin_search_tree_expand = std::clock();
 
-            end_mcb_checking = std::clock();
-            octmib_results.time_mcb_checking += double(end_mcb_checking - begin_mcb_checking) / CLOCKS_PER_SEC;
+    SearchTreeBag current_bag(search_tree.get_allocator());
 
-            // as long as the bag is not empty we add it to our queue
-            if (future_maximal_bag.size() > 0) {
-                search_tree_list.push_back(future_maximal_bag);
-            }
-            future_maximal_bag.clear();
+    // NOW BEGIN EXPANSION
+    while (!search_tree.empty()) {
 
-            clock_t begin_search_tree_expand = std::clock();
-            // NOW BEGIN EXPANSION
-            while ( search_tree_list.size() > 0 ) {
+        // A bag expanded one child at a time stays below its children until
+        // the last of them is built
+        if (search_tree.top().has_planned_child()) {
+            search_tree.top().build_planned_child(current_bag, octmib_results.size_constraints);
+            if (!search_tree.top().has_planned_child()) search_tree.pop();
+            search_tree.push(current_bag);
+            continue;
+        }
 
-                SearchTreeBag & current_bag = search_tree_list.front();
+        search_tree.pop(current_bag);
 
-                // Skip empty bags
-                if (current_bag.size() == 0) {
-                    search_tree_list.pop_front();
-                    continue;
-                }
+        // Skip empty bags
+        if (current_bag.size() == 0) continue;
+
+        bool one_child_at_a_time = octmib_results.max_frontier_bytes > 0 &&
+                                   search_tree.memory_usage() + current_bag.memory_usage() >
+                                   octmib_results.max_frontier_bytes;
+
+        octmib_expand_bag(octmib_results,
+                          current_bag,
+                          global_duplicates_table,
+                          search_tree,
+                          one_child_at_a_time,
+                          pool);
+        search_tree.note_held(current_bag.memory_usage());
+
+        if (one_child_at_a_time && current_bag.has_planned_child()) {
+            search_tree.push(current_bag);
+        }
+
+    } // end WHILE over search_tree
+
+    octmib_results.peak_frontier_bytes = std::max(octmib_results.peak_frontier_bytes,
+                                                  search_tree.peak_memory_usage());
 
-                // update the iterative_set pointsers for all blueprints in this bag.
-                update_iterative_pointers_in_blueprint(current_bag);
-                std::vector<size_t> & this_iter_wait = current_bag.get_iterative_wait();
-                OrderedVertexSet & this_iter_in = current_bag.get_iterative_in();
-                std::vector<size_t> & this_iter_past = current_bag.get_iterative_past();
+    clock_t end_search_tree_expand = std::clock();
+    octmib_results.time_search_tree_expand += double(end_search_tree_expand - begin_search_tree_expand) / CLOCKS_PER_SEC;
 
-                // Initialize empty vector to hold all children bags of current_bag
-                std::list<SearchTreeBag> child_bag_list;
-                std::unordered_map<std::string,bool> local_duplicates_table;
+}
 
-                // iterative_wait, _in are the same for all blueprints in a bag together
-                const std::vector<size_t> & nodes_to_expand_on = current_bag.get_iterative_wait();
-                size_t last_iter_in_node = this_iter_in.back();
 
-                for (size_t expand_node: nodes_to_expand_on) {
+/**
+ * Run the search tree rooted at vertex seeds.v of the MIS mis_in_oct of the
+ * OCT set: build the initial bag, then expand bags depth-first until none are
+ * left, large ones on `pool` when called from one of its tasks.
+ */
+void octmib_search_tree(OutputOptions & octmib_results,
+                        const std::shared_ptr<Graph> & graph_ptr,
+                        const OrderedVector & mis_in_oct,
+                        const OctVertexSeeds & seeds,
+                        DuplicatesTable & global_duplicates_table,
+                        WorkStealingPool * pool) {
+
+    // Initialization of search-tree
+    SearchTreeStack<SearchTreeBag> search_tree;
+
+    SearchTreeBag future_maximal_bag = octmib_initial_bag(octmib_results,
+                                                          graph_ptr,
+                                                          mis_in_oct,
+                                                          seeds,
+                                                          search_tree.get_allocator(),
+                                                          pool);
+
+    octmib_record_initial_bag(octmib_results,
+                              future_maximal_bag,
+                              global_duplicates_table);
+
+    // as long as the bag is not empty we add it to our stack
+    if (future_maximal_bag.size() > 0) {
+        search_tree.push(future_maximal_bag);
+    }
 
-                    SearchTreeBag child_bag(this_iter_wait,
-                                            this_iter_in,
-                                            this_iter_past,
-                                            expand_node);
+    octmib_expand_search_tree(octmib_results,
+                              search_tree,
+                              global_duplicates_table,
+                              pool);
 
-                    child_bag.expand_on_vertex(expand_node);
+    octmib_results.num_oct_iter_mis_completed++;
 
-                    for (const BlueprintLite & this_blueprint: current_bag) {
+}
 
-                        // If expand_node is beyond the next node needed for maximality, skip
-                        // If expand_node is banned in blueprint, skip
-                        if (this_blueprint.skip_expanding_vertex(expand_node)) continue;
 
-                        // copy blueprint because it needs to be reused
-                        BlueprintLite temp_blueprint = this_blueprint;
+/**
+ * Group the (MIS of OCT, vertex) roots by vertex: for each vertex of the OCT
+ * set that is in some MIS, in order, the indices of the MISes containing it.
+ */
+std::map<size_t, std::vector<size_t>> octmib_roots_by_vertex(const std::vector<OrderedVector> & all_mis) {
 
-                        ExpansionResult expand_result = temp_blueprint.expand(expand_node, local_duplicates_table);
+    std::map<size_t, std::vector<size_t>> roots_by_vertex;
+    for (size_t mis_index = 0; mis_index < all_mis.size(); mis_index++) {
+        for (auto v : all_mis[mis_index]) roots_by_vertex[v].push_back(mis_index);
+    }
+    return roots_by_vertex;
 
-                        // Expansion performed --
-                        // Now update BAN info, add to mcb_list if applicable
-                        process_expansion_result(octmib_results,
-                                                 temp_blueprint,
-                                                 expand_result,
-                                                 global_duplicates_table,
-                                                 local_duplicates_table,
-                                                 child_bag_list,
-                                                 child_bag);
+}
 
-                    } // end FOR over blueprints in current bag
 
-                    // If bag non-empty, add to child_bag_list
-                    if (child_bag.size() > 0) child_bag_list.push_back(child_bag);
+/**
+ * The MCB slacks needed by the roots of v, one per distinct slack.
+ */
+std::vector<size_t> octmib_mcb_slacks(const OutputOptions & octmib_results,
+                                      const std::vector<OrderedVector> & all_mis,
+                                      const std::vector<size_t> & mis_indices,
+                                      size_t v) {
+
+    std::vector<size_t> slacks;
+    for (size_t mis_index : mis_indices) {
+        size_t slack = octmib_mcb_slack(octmib_results, all_mis[mis_index], v);
+        if (std::find(slacks.begin(), slacks.end(), slack) == slacks.end()) {
+            slacks.push_back(slack);
+        }
+    }
+    return slacks;
 
-                } // end FOR over nodes to expand current search tree bag on.
+}
 
-                search_tree_list.pop_front();
 
-                // Done creating children of current_bag;
-                // add non-empty children to search_tree.
-                if (child_bag_list.size() > 0) {
-                    search_tree_list.splice(search_tree_list.begin(), child_bag_list);
-                }
+/**
+ * Run the search trees of all (MIS of OCT, vertex) roots on a work-stealing
+ * pool of octmib_results.num_threads workers, one task per OCT vertex. A
+ * vertex's task builds its blueprint seeds, then runs its first root and
+ * hands the others to the pool as tasks sharing those seeds; a root's large
+ * bags are built and expanded by subtasks of its task. Each worker outputs
+ * to its own OutputOptions, which are merged into octmib_results once every
+ * tree is done. The tasks only share global_duplicates_table, which must
+ * have been built with several shards.
+ *
+ * The MIBs recorded by all workers are also counted together as each tree
+ * finishes. Once a MIB limit is passed, no further tree is started, and the
+ * tasks still queued return at once; the limit then stops the run after the
+ * merge, as after each tree of a serial run.
+ */
+void octmib_search_trees_parallel(OutputOptions & octmib_results,
+                                  OctGraph & og,
+                                  const std::shared_ptr<Graph> & graph_ptr,
+                                  const std::vector<OrderedVector> & all_mis,
+                                  DuplicatesTable & global_duplicates_table) {
+
+    WorkStealingPool pool(octmib_results.num_threads);
+
+    // Workers record bicliques with the labels of og; relabeling and
+    // printing happen when merging into octmib_results.
+    std::vector<OutputOptions> worker_results(pool.size());
+    for (auto & results : worker_results) octmib_results.configure_shard(results);
+
+    const auto roots_by_vertex = octmib_roots_by_vertex(all_mis);
+
+    std::atomic<size_t> num_mibs_recorded(octmib_results.total_num_mibs);
+    std::atomic<bool> limit_passed(false);
+
+    // Run one search tree on the calling worker, unless the limit is passed
+    auto run_search_tree = [&](const OrderedVector & mis_in_oct, const OctVertexSeeds & seeds) {
+        if (limit_passed) return;
+        OutputOptions & results = worker_results[pool.worker_index()];
+        size_t num_mibs_before = results.total_num_mibs;
 
-            } // end WHILE over search_tree_list
+        octmib_search_tree(results,
+                           graph_ptr,
+                           mis_in_oct,
+                           seeds,
+                           global_duplicates_table,
+                           &pool);
 
-            clock_t end_search_tree_expand = std::clock();
-            octmib_results.time_search_tree_expand += double(end_search_tree_expand - begin_search_tree_expand) / CLOCKS_PER_SEC;
+        size_t num_mibs = num_mibs_recorded += results.total_num_mibs - num_mibs_before;
+        if (octmib_results.passes_mib_limit(num_mibs)) limit_passed = true;
+    };
 
-        octmib_results.num_oct_iter_mis_completed++;
+    for (auto & vertex_roots : roots_by_vertex) {
 
-        // If MIB limit is in place, check for early termination
-        if (octmib_results.mib_limit_flag) {
-            if (octmib_results.total_num_mibs > octmib_results.mib_limit_value) {
-                raise(SIGINT);
+        size_t v = vertex_roots.first;
+        const std::vector<size_t> & mis_indices = vertex_roots.second;
+
+        pool.submit([&, v] {
+            if (limit_passed) return;
+            OutputOptions & results = worker_results[pool.worker_index()];
+
+            auto seeds = std::make_shared<const OctVertexSeeds>(
+                octmib_vertex_seeds(results, og, v,
+                                    octmib_mcb_slacks(results, all_mis, mis_indices, v)));
+
+            for (size_t idx = 1; idx < mis_indices.size() && !limit_passed; idx++) {
+                const OrderedVector & mis_in_oct = all_mis[mis_indices[idx]];
+                pool.submit([&, seeds] { run_search_tree(mis_in_oct, *seeds); });
             }
+
+            run_search_tree(all_mis[mis_indices.front()], *seeds);
+        });
+    }
+    pool.wait();
+
+    for (auto & results : worker_results) octmib_results.merge(results);
+    if (!limit_passed) octmib_results.num_oct_mis_completed += all_mis.size();
+
+    // If MIB limit is in place, check for early termination
+    octmib_results.check_mib_limit();
+
+}
+
+
+ /**
+  * Implements our Maximal Induced Biclique algorithm exploiting an OCT set.
+  *
+  * - Compute OCT decomposition using simple BFS coloring algorithm.
+  *
+  * - on the biparite portion, use our MCB algorithm to find all bicliques there.
+  * - check those bicliques against the OCT set to check for maximality.
+  *
+  * - Use our implementation of Eppstein's algorithm to compute all MIS in OCT
+  * - iterate over MIS in OCT, extract relevant portions from L and R partitions
+  * - use our MCB to extract MIBs on relevant subgraph determined this way
+  *
+  * - heavily uses BlueprintLite::expand
+  */
+void octmib_with_oct(OutputOptions & octmib_results, OctGraph &og) {
+
+    auto graph_ptr = std::make_shared<Graph>(og);
+
+    const OrderedVertexSet & left_partition = og.get_left();
+    const OrderedVertexSet & oct_set = og.get_oct();
+    const OrderedVertexSet & right_partition = og.get_right();
+
+    const OrderedVector left_partition_OV(left_partition.get_vertices());
+    const OrderedVector right_partition_OV(right_partition.get_vertices());
+
+    OrderedVector non_oct_vertices(left_partition_OV.set_union(right_partition_OV));
+
+    std::vector<size_t> external_labeling;
+    bool relabel_flag = false;
+    if (octmib_results.relabeling_mode) {
+        external_labeling = octmib_results.relabeling_vector;
+        relabel_flag = true;
+    }
+
+    /**
+     * PHASE 1.1: run MCB (or Langston) on the bipartite graph (g - OCT)
+     */
+     clock_t begin_mcb_timing = std::clock();
+    size_t num_bipartite_mibs_before = octmib_results.bipartite_num_mibs;
+
+    // Case 1: OCT-set empty --> just run MCBB
+    if (oct_set.size() == 0) {
+        maximal_crossing_bicliques_bipartite(octmib_results,
+                                             og,
+                                             left_partition.get_vertices(),
+                                             right_partition.get_vertices() );
+    }
+    // Case 2: non-empty OCT-set
+    else {
+
+         // Extract bipartite subgraph
+        Graph g_minus_oct = og.subgraph(non_oct_vertices);
+        std::vector<size_t> bipartite_left, bipartite_right;
+        for (size_t idx=0; idx< non_oct_vertices.size(); idx++){
+            if (left_partition.has_vertex(non_oct_vertices[idx])) {
+                bipartite_left.push_back(idx);
+            }
+            else bipartite_right.push_back(idx);
         }
 
-        } // FOR loop over each vertex in MIS
+        // Compute mcbs on bipartite graph
+        octmib_results.turn_on_max_check_mode(oct_set);
+        octmib_results.turn_on_relabeling_mode(non_oct_vertices);
+
+        maximal_crossing_bicliques_bipartite(octmib_results,
+                                             g_minus_oct,
+                                             bipartite_left,
+                                             bipartite_right);
+
+    }
+
+    // Reseting the labelling system is required in case MCBB alters labeling
+    octmib_results.turn_off_relabeling_mode();
+    octmib_results.turn_off_max_check_mode();
+    if (relabel_flag) {
+        octmib_results.turn_on_relabeling_mode(external_labeling);
+    }
+
+    clock_t end_mcb_timing = std::clock();
+    octmib_results.time_bipartite_mcb += double(end_mcb_timing - begin_mcb_timing) / CLOCKS_PER_SEC;
+    // if no oct set, the graph is bipartite -- return
+
+    if (oct_set.size() == 0) return;
 
-        octmib_results.num_oct_mis_completed++;
-    } // FOR loop over each MIS in OCT
+
+    /**
+     * PHASE 2: find MIBS on the rest of the input graph
+     */
+    // Compute MIS on graph induced by OCT set
+    clock_t begin_oct_mis_timing = std::clock();
+
+    auto oct_subgraph = og.subgraph(oct_set);
+    auto all_mis_in_oct = get_all_mis(oct_subgraph);
+    // Convert each MIS to use labelling of graph instead of subgraph(oct_set).
+    convert_node_labels_vector_inplace(all_mis_in_oct, oct_set);
+
+    // Update the OCTMIB results object
+    octmib_results.num_oct_mis += all_mis_in_oct.size();
+    octmib_results.num_oct_edges += oct_subgraph.get_num_edges();
+
+    clock_t end_oct_mis_timing = std::clock();
+    octmib_results.time_oct_MIS += double(end_oct_mis_timing - begin_oct_mis_timing) / CLOCKS_PER_SEC;
+
+
+    // Process each MIS in OCT separately. For each MIS in OCT,
+    // for each node in the MIS, initialize blueprints
+
+    // First, compute sum of sizes of MISes, for statistics tracking purposes.
+    size_t num_search_trees = 0;
+    for (auto & mis_in_oct : all_mis_in_oct) {
+            num_search_trees += mis_in_oct.size();
+    }
+    octmib_results.num_oct_iter_mis += num_search_trees;
+
+    // Size the duplicates filter assuming each search tree finds about as many
+    // new MIBs as the bipartite graph has per vertex; it grows if needed.
+    // Parallel runs share the table, so it is split into locked shards.
+    size_t num_bipartite_mibs = octmib_results.bipartite_num_mibs - num_bipartite_mibs_before;
+    size_t num_shards = (octmib_results.num_threads > 1) ? 16*octmib_results.num_threads : 1;
+    DuplicatesTable global_duplicates_table(num_search_trees +
+                                            num_bipartite_mibs*num_search_trees/(non_oct_vertices.size() + 1),
+                                            num_shards);
+
+    const std::vector<OrderedVector> all_mis(all_mis_in_oct.begin(), all_mis_in_oct.end());
+
+    if (octmib_results.num_threads > 1) {
+        octmib_search_trees_parallel(octmib_results,
+                                     og,
+                                     graph_ptr,
+                                     all_mis,
+                                     global_duplicates_table);
+    }
+    else {
+        // Number of roots of each MIS in OCT not yet done
+        std::vector<size_t> num_roots_left;
+        for (auto & mis_in_oct : all_mis) num_roots_left.push_back(mis_in_oct.size());
+
+        // For each vertex v of OCT, do the work on v's neighborhood once for
+        // all the MISes of OCT that contain v
+        for (auto & vertex_roots : octmib_roots_by_vertex(all_mis)) {
+
+            size_t v = vertex_roots.first;
+            const std::vector<size_t> & mis_indices = vertex_roots.second;
+
+            OctVertexSeeds seeds = octmib_vertex_seeds(octmib_results, og, v,
+                                                       octmib_mcb_slacks(octmib_results, all_mis, mis_indices, v));
+
+            // For each maximal independent set mis of OCT containing v
+            for (size_t mis_index : mis_indices) {
+
+                octmib_search_tree(octmib_results,
+                                   graph_ptr,
+                                   all_mis[mis_index],
+                                   seeds,
+                                   global_duplicates_table);
+
+                // If MIB limit is in place, check for early termination
+                octmib_results.check_mib_limit();
+
+                if (--num_roots_left[mis_index] == 0) octmib_results.num_oct_mis_completed++;
+
+            } // FOR loop over each MIS containing v
+        } // FOR loop over each vertex in OCT
+    }
+
+    octmib_results.num_dup_filter_lookups += global_duplicates_table.get_num_filter_lookups();
+    octmib_results.num_dup_table_lookups += global_duplicates_table.get_num_table_lookups();
 
 }
 
@@ -680,9 +1211,10 @@ void octmib(OutputOptions & octmib_results,
     octmib_results.n = g.get_num_vertices();
     octmib_results.m = g.get_num_edges();
 
-    // Determine connected components
+    // Determine connected components (of the core left after size-constraint
+    // peeling, if any size constraints are in place)
     clock_t begint = std::clock();
-    std::vector<std::vector<size_t>> vector_of_ccs = simpleccs(g);
+    std::vector<std::vector<size_t>> vector_of_ccs = simpleccs(g, octmib_results.size_constraints.min_degree());
     clock_t endt = std::clock();
     octmib_results.time_ccs += double(endt - begint) / CLOCKS_PER_SEC;
     octmib_results.num_connected_components = vector_of_ccs.size();
@@ -698,48 +1230,51 @@ void octmib(OutputOptions & octmib_results,
     }
 
 
-    if (vector_of_ccs.size() > 1) {
-        OrderedVertexSet oct_set_cc, left_set_cc, right_set_cc;
-
-        // run octmib on each CC
-        for (size_t which_cc = 0; which_cc < vector_of_ccs.size(); which_cc++) {
-
-            // Time this CC
-            begint = std::clock();
-
-            std::vector<size_t> vertex_subset = vector_of_ccs[which_cc];
-            octmib_results.relabeling_mode = false;
+    // Peeled vertices also force the per-CC path, as the core is a proper subgraph
+    if (vector_of_ccs.size() != 1 || vector_of_ccs.front().size() < g.get_num_vertices()) {
 
-            // relabel ground truth using this ordering
-            std::vector<size_t> reverse_ordering(g.get_num_vertices());
+        // Position of each vertex within its CC, for relabeling into the CC
+        std::vector<size_t> reverse_ordering(g.get_num_vertices());
+        for (auto & vertex_subset : vector_of_ccs) {
             for (size_t idx1=0; idx1<vertex_subset.size(); idx1++) {
                 reverse_ordering[vertex_subset[idx1]] = idx1;
             }
+        }
 
-            std::cout << "# CC " << which_cc + 1 << " of ";
-            std::cout << vector_of_ccs.size() << std::endl;
-            std::cout << "#\tsize: " << vertex_subset.size() << "/";
-            std::cout << g.get_num_vertices() << std::endl;
+        // run octmib on each CC, possibly several at once
+        auto run_cc = [&](OutputOptions & cc_results, size_t which_cc, std::ostream & log) {
+
+            // Time this CC
+            clock_t begin_cc = std::clock();
+
+            const std::vector<size_t> & vertex_subset = vector_of_ccs[which_cc];
+            cc_results.relabeling_mode = false;
+
+            log << "# CC " << which_cc + 1 << " of ";
+            log << vector_of_ccs.size() << std::endl;
+            log << "#\tsize: " << vertex_subset.size() << "/";
+            log << g.get_num_vertices() << std::endl;
 
             // Skip Isolated vertices and empty sets
             if (vertex_subset.size() <= 1) {
-                octmib_results.isolates ++;
-                continue;
+                cc_results.isolates ++;
+                return;
             }
 
             // Isolated edges are MIBs
             if (vertex_subset.size() == 2) {
                 BicliqueLite temp((std::vector<size_t>){vertex_subset.front()},
                                   (std::vector<size_t>){vertex_subset.back()});
-                octmib_results.push_back_bipartite(temp);
-                octmib_results.size_left ++;
-                octmib_results.size_right ++;
-                continue;
+                cc_results.push_back_bipartite(temp);
+                cc_results.size_left ++;
+                cc_results.size_right ++;
+                return;
             }
 
             Graph g_cc = g.subgraph(vertex_subset);
 
             // Restrict OCT decomposition to this subgraph
+            OrderedVertexSet oct_set_cc, left_set_cc, right_set_cc;
             if (input_oct_set.size() > 0) {
                 oct_set_cc = input_oct_set.set_intersection(vertex_subset);
                 left_set_cc = input_left_set.set_intersection(vertex_subset);
@@ -751,15 +1286,22 @@ void octmib(OutputOptions & octmib_results,
             left_set_cc = convert_node_labels_OVS(left_set_cc, reverse_ordering);
             right_set_cc = convert_node_labels_OVS(right_set_cc, reverse_ordering);
 
-            octmib_results.turn_on_relabeling_mode(vertex_subset);
-            octmib_cc(octmib_results, g_cc, oct_set_cc, left_set_cc, right_set_cc);
+            cc_results.turn_on_relabeling_mode(vertex_subset);
+            octmib_cc(cc_results, g_cc, oct_set_cc, left_set_cc, right_set_cc, log);
 
-            endt = std::clock();
-            std::cout << "# this CC ran in ";
-            std::cout << double(endt - begint) / CLOCKS_PER_SEC;
-            std::cout << "\n#\n# " << std::endl;
+            clock_t end_cc = std::clock();
+            log << "# this CC ran in ";
+            log << double(end_cc - begin_cc) / CLOCKS_PER_SEC;
+            log << "\n#\n# " << std::endl;
 
-        }
+        };
+
+        // Stop taking components once the MIB limit is passed, but end the
+        // run from this thread, after every worker has finished
+        run_components(octmib_results, vector_of_ccs, run_cc, [](OutputOptions & results) {
+            return results.passes_mib_limit(results.total_num_mibs);
+        });
+        octmib_results.check_mib_limit();
 
     }
     else {
@@ -776,18 +1318,20 @@ void octmib(OutputOptions & octmib_results,
  * Wrapper for our OCTMIB algorithm together with OCT decomposition algorithm.
  * This allows user to input a specified OCT decomposition, if desired,
  * but if no oct set is specified, then one is computed before calling the
- * actual OCTMIB algorithm.
+ * actual OCTMIB algorithm. Progress lines are written to log.
  */
 void octmib_cc(OutputOptions & octmib_results,
                 const Graph & g,
                 OrderedVertexSet input_oct_set,
                 OrderedVertexSet input_left_set,
-                OrderedVertexSet input_right_set) {
+                OrderedVertexSet input_right_set,
+                std::ostream & log) {
 
-    // If we're missing either OCT or left_partition, call simpleOCT
+    // If we're missing either OCT or left_partition, compute them
     if (input_oct_set.size() == 0 || input_left_set.size() == 0) {
         clock_t begin = std::clock();
-        simpleoct(g, input_oct_set, input_left_set, input_right_set);
+        octdecomposition(g, input_oct_set, input_left_set, input_right_set,
+                         octmib_results.oct_search, log);
         clock_t end = std::clock();
         octmib_results.time_oct_decomp += double(end - begin) / CLOCKS_PER_SEC;
 
@@ -801,9 +1345,9 @@ void octmib_cc(OutputOptions & octmib_results,
     }
 
     // Call main OCTMIB function
-    std::cout << "#\tOCT in CC has size " << input_oct_set.size() << std::endl;
-    std::cout << "#\tL in CC has size " << input_left_set.size() << std::endl;
-    std::cout << "#\tR in CC has size " << input_right_set.size() << std::endl;
+    log << "#\tOCT in CC has size " << input_oct_set.size() << std::endl;
+    log << "#\tL in CC has size " << input_left_set.size() << std::endl;
+    log << "#\tR in CC has size " << input_right_set.size() << std::endl;
 
     // OCT decomposition is determined -- now run OCTMIB
     OctGraph og(g, input_oct_set, input_left_set, input_right_set);
@@ -10,29 +10,133 @@
 #define BICLIQUES_OCTMIB_H
 
 
+#include <iostream>
 #include <vector>
 #include <queue>
+#include <map>
 #include "../graph/BicliqueLite.h"
 #include "../graph/BlueprintLite.h"
 #include "../graph/ExpansionResult.h"
 #include "../graph/Graph.h"
+#include "../graph/DuplicatesTable.h"
 #include "../graph/OctGraph.h"
 #include "../graph/SearchTreeBag.h"
+#include "../graph/SearchTreeStack.h"
+#include "../graph/OrderedVector.h"
 
+#include "../algorithms/OCTDecomposition.h"
 #include "../algorithms/SimpleOCT.h"
 #include "../algorithms/AllMaximalIndependentSets.h"
 
 #include "OutputOptions.h"
+#include "WorkStealingPool.h"
 
 void process_expansion_result(OutputOptions & octmib_results,
                               BlueprintLite & current_blueprint,
                               ExpansionResult & expand_result,
-                              std::unordered_map<std::string,bool> & global_duplicates_list,
+                              DuplicatesTable & global_duplicates_list,
                               std::unordered_map<std::string,bool> & local_duplicates_list,
-                              std::vector<SearchTreeBag> & bag_list,
+                              SearchTreeBag & expanded_bag,
                               SearchTreeBag & next_bag);
 
 
+/**
+ * The sets of one blueprint of an initial bag, less its OCT auxiliary set,
+ * which depends on the MIS of the OCT set the search tree belongs to.
+ */
+struct BlueprintSeed {
+    std::vector<size_t> completely_connected_in;
+    std::vector<size_t> completely_connected_out;
+    std::vector<size_t> independent_from_in;
+    std::vector<size_t> independent_from_out;
+
+    // Seeds from an MIS of v's neighborhood are skipped for roots with a
+    // later vertex of their OCT MIS completely connected to that MIS
+    bool from_neighborhood_mis;
+};
+
+/**
+ * The blueprint seeds shared by every search tree rooted at OCT vertex v,
+ * whichever MIS of the OCT set it belongs to. MCB seeds are kept for each
+ * size-constraint slack used (see octmib_mcb_slack).
+ */
+struct OctVertexSeeds {
+    size_t v = 0;
+    std::vector<size_t> oct_non_v_neighb;
+    std::vector<BlueprintSeed> mis_seeds;
+    std::map<size_t, std::vector<BlueprintSeed>> mcb_seeds;
+};
+
+void octmib_add_mcb_seeds(OutputOptions & octmib_results,
+                          OctGraph & og,
+                          const OrderedVertexSet & v_neighb,
+                          const OrderedVector & non_oct_non_v_neighb_vertices,
+                          const std::vector<size_t> & vertices,
+                          const OrderedVector & side,
+                          const OrderedVector & other_side,
+                          const SizeConstraints & mcb_size_constraints,
+                          std::vector<BlueprintSeed> & seeds);
+
+size_t octmib_mcb_slack(const OutputOptions & octmib_results,
+                        const OrderedVector & mis_in_oct,
+                        size_t v);
+
+OctVertexSeeds octmib_vertex_seeds(OutputOptions & octmib_results,
+                                   OctGraph & og,
+                                   size_t v,
+                                   const std::vector<size_t> & mcb_slacks);
+
+SearchTreeBag octmib_initial_bag(OutputOptions & octmib_results,
+                                 const std::shared_ptr<Graph> & graph_ptr,
+                                 const OrderedVector & mis_in_oct,
+                                 const OctVertexSeeds & seeds,
+                                 const SearchTreeBag::allocator_type & alloc = SearchTreeBag::allocator_type(),
+                                 WorkStealingPool * pool = nullptr);
+
+SearchTreeBag octmib_initial_bag(OutputOptions & octmib_results,
+                                 OctGraph & og,
+                                 const std::shared_ptr<Graph> & graph_ptr,
+                                 const OrderedVector & mis_in_oct,
+                                 size_t v);
+
+void octmib_record_initial_bag(OutputOptions & octmib_results,
+                               SearchTreeBag & initial_bag,
+                               DuplicatesTable & global_duplicates_list);
+
+void octmib_expand_bag(OutputOptions & octmib_results,
+                       SearchTreeBag & current_bag,
+                       DuplicatesTable & global_duplicates_list,
+                       SearchTreeStack<SearchTreeBag> & children,
+                       bool one_child_at_a_time = false,
+                       WorkStealingPool * pool = nullptr);
+
+
+void octmib_expand_search_tree(OutputOptions & octmib_results,
+                               SearchTreeStack<SearchTreeBag> & search_tree,
+                               DuplicatesTable & global_duplicates_list,
+                               WorkStealingPool * pool = nullptr);
+
+void octmib_search_tree(OutputOptions & octmib_results,
+                        const std::shared_ptr<Graph> & graph_ptr,
+                        const OrderedVector & mis_in_oct,
+                        const OctVertexSeeds & seeds,
+                        DuplicatesTable & global_duplicates_list,
+                        WorkStealingPool * pool = nullptr);
+
+std::map<size_t, std::vector<size_t>> octmib_roots_by_vertex(const std::vector<OrderedVector> & all_mis);
+
+std::vector<size_t> octmib_mcb_slacks(const OutputOptions & octmib_results,
+                                      const std::vector<OrderedVector> & all_mis,
+                                      const std::vector<size_t> & mis_indices,
+                                      size_t v);
+
+void octmib_search_trees_parallel(OutputOptions & octmib_results,
+                                  OctGraph & og,
+                                  const std::shared_ptr<Graph> & graph_ptr,
+                                  const std::vector<OrderedVector> & all_mis,
+                                  DuplicatesTable & global_duplicates_list);
+
+
 void octmib_with_oct(OutputOptions & results, OctGraph &);
 
 
@@ -47,7 +151,8 @@ void octmib_cc(OutputOptions & results,
                 const Graph &,
                 OrderedVertexSet input_oct_set = OrderedVertexSet(),
                 OrderedVertexSet input_left_set = OrderedVertexSet(),
-                OrderedVertexSet input_right_set = OrderedVertexSet() );
+                OrderedVertexSet input_right_set = OrderedVertexSet(),
+                std::ostream & log = std::cout);
 
 
 std::vector<BicliqueLite> octmib(const Graph &,
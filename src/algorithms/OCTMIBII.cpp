@@ -10,15 +10,25 @@
 *   This code assumes no node is isolated.
 */
 
+#include <algorithm> // for std::max
+#include <functional>
 #include "OCTMIBII.h"
+#include "ComponentScheduler.h"
+#include "NearBipartiteMIS.h"
 #include "SimpleCCs.h"
+#include "WorkStealingPool.h"
+#include "../graph/BicliqueStore.h"
 #include "../graph/OrderedVector.h"
+
+namespace {
+
 /**
- * Edits the given biclique to be maximal with respect to expansion_set1.
- * Then, checks agains expansion_set2 to see if the biclique is maximal wrt set2.
- * Returns true if maximal wrt set2 (and edits the Biclique), false and does not edit otherwise.
+ * make_maximal for a biclique with an empty side, which any vertex
+ * independent from the other side can join: scan both expansion sets.
  */
-bool make_maximal(const Graph & g, BicliqueLite & b, OrderedVertexSet expansion_set1, OrderedVertexSet expansion_set2) {
+bool make_maximal_by_scan(const Graph & g, BicliqueLite & b,
+                          const OrderedVertexSet & expansion_set1,
+                          const OrderedVertexSet & expansion_set2) {
     // Proceed with update set_x and set_y.
     OrderedVector set_x = OrderedVector(b.get_left());
     OrderedVector set_y = OrderedVector(b.get_right());
@@ -56,6 +66,78 @@ bool make_maximal(const Graph & g, BicliqueLite & b, OrderedVertexSet expansion_
     return true;
 }
 
+/**
+ * Keep only the vertices of candidates adjacent to v, by the adjacency matrix.
+ */
+void keep_neighbors_of(const Graph & g, std::vector<size_t> & candidates, size_t v) {
+    candidates.erase(std::remove_if(candidates.begin(), candidates.end(),
+                                    [&](size_t u) { return !g.has_edge(u, v); }),
+                     candidates.end());
+}
+
+}
+
+/**
+ * Edits the given biclique to be maximal with respect to expansion_set1.
+ * Then, checks agains expansion_set2 to see if the biclique is maximal wrt set2.
+ * Returns true if maximal wrt set2 (and edits the Biclique), false and does not edit otherwise.
+ *
+ * A vertex can only join X if it is adjacent to all of Y, and Y if adjacent
+ * to all of X, so with both sides nonempty only the common neighbors of each
+ * side are candidates, rather than every vertex of the expansion sets. Those
+ * only lose vertices as the sides grow, so they are computed once and pruned
+ * by the adjacency matrix as vertices join.
+ */
+bool make_maximal(const Graph & g, BicliqueLite & b,
+                  const OrderedVertexSet & expansion_set1,
+                  const OrderedVertexSet & expansion_set2) {
+    if (b.get_left().empty() || b.get_right().empty()) {
+        return make_maximal_by_scan(g, b, expansion_set1, expansion_set2);
+    }
+
+    OrderedVector set_x = OrderedVector(b.get_left());
+    OrderedVector set_y = OrderedVector(b.get_right());
+    // Vertices adjacent to all of Y, which may join X, and to all of X
+    std::vector<size_t> joins_x = g.get_neighborhood_intersection(set_y.get_vertices());
+    std::vector<size_t> joins_y = g.get_neighborhood_intersection(set_x.get_vertices());
+
+    // Candidates from expansion_set1, in the order the full scan takes them
+    std::vector<size_t> candidates;
+    std::set_union(joins_x.begin(), joins_x.end(), joins_y.begin(), joins_y.end(),
+                   std::back_inserter(candidates));
+    for (auto current_vertex : candidates) {
+        if (!expansion_set1.has_vertex(current_vertex) ||
+            set_x.has_vertex(current_vertex) || set_y.has_vertex(current_vertex)) {
+            continue;
+        }
+        if (g.is_completely_independent_from(current_vertex, set_x) && g.is_completely_connect_to(current_vertex, set_y)) {
+            set_x.bubble_sort(current_vertex);
+            keep_neighbors_of(g, joins_y, current_vertex);
+        }
+
+        if (g.is_completely_independent_from(current_vertex, set_y) && g.is_completely_connect_to(current_vertex, set_x)) {
+            set_y.bubble_sort(current_vertex);
+            keep_neighbors_of(g, joins_x, current_vertex);
+        }
+    }
+
+    // Any vertex of expansion_set2 that could still join makes b not maximal
+    for (auto current_vertex : joins_x) {
+        if (expansion_set2.has_vertex(current_vertex) && !set_x.has_vertex(current_vertex) &&
+            g.is_completely_independent_from(current_vertex, set_x)) {
+            return false;
+        }
+    }
+    for (auto current_vertex : joins_y) {
+        if (expansion_set2.has_vertex(current_vertex) && !set_y.has_vertex(current_vertex) &&
+            g.is_completely_independent_from(current_vertex, set_y)) {
+            return false;
+        }
+    }
+    b = BicliqueLite(set_x, set_y);
+    return true;
+}
+
 BicliqueLite add_to(const Graph & g, BicliqueLite & b, bool left, size_t vertex) {
 	OrderedVector x_edited = b.get_left();
 	OrderedVector y_edited = b.get_right();
@@ -71,12 +153,123 @@ BicliqueLite add_to(const Graph & g, BicliqueLite & b, bool left, size_t vertex)
 	return BicliqueLite(x_edited, y_edited);
 }
 
+namespace {
+
+/**
+ * Maximal crossing bicliques of the bipartite graph left by removing the OCT
+ * set of og, labeled as in og.
+ */
+std::vector<BicliqueLite> crossing_bicliques(OutputOptions & results,
+                                             const OctGraph & og,
+                                             const OrderedVector & non_oct_vertices) {
+	OutputOptions temp;
+	// Extract bipartite subgraph
+	Graph g_minus_oct = og.subgraph(non_oct_vertices);
+	std::vector<size_t> bipartite_left, bipartite_right;
+
+	for (size_t idx=0; idx< non_oct_vertices.size(); idx++){
+		if (og.get_left().has_vertex(non_oct_vertices[idx])) {
+			bipartite_left.push_back(idx);
+		}
+		else bipartite_right.push_back(idx);
+	}
+	// Compute mcbs on bipartite graph
+	temp.turn_on_relabeling_mode(non_oct_vertices);
+	temp.max_frontier_bytes = results.max_frontier_bytes;
+	maximal_crossing_bicliques_bipartite(temp,
+	                                     g_minus_oct,
+	                                     bipartite_left,
+	                                     bipartite_right);
+	results.peak_frontier_bytes = std::max(results.peak_frontier_bytes, temp.peak_frontier_bytes);
+	return std::move(temp.mibs_computed);
+}
+
+/**
+ * The seeding and closure of octmibii_cc on octmibii_results.num_threads
+ * threads. The MIS seeds of each OCT vertex, the MCBB pass, and extending
+ * each biclique found by the OCT vertices are all tasks on a work-stealing
+ * pool: a task's new tasks go on its own worker's deque, which idle workers
+ * steal from, and the pool's wait returns once no task is queued or running.
+ * Bicliques found are kept in a sharded BicliqueStore, and recorded into a
+ * shard of the results for each worker, merged at the end.
+ */
+void octmibii_closure_parallel(OutputOptions & octmibii_results,
+                               const Graph & g,
+                               const OctGraph & og,
+                               const OrderedVertexSet & oct_set,
+                               const OrderedVertexSet & left_right,
+                               const OrderedVector & non_oct_vertices) {
+
+	WorkStealingPool pool(octmibii_results.num_threads);
+	std::vector<OutputOptions> worker_results(pool.size());
+	for (auto & results : worker_results) octmibii_results.configure_shard(results);
+	BicliqueStore found(0, 4*pool.size());
+
+	std::function<void(BicliqueLite &)> extend;
+
+	// Record b if it is maximal and new, and queue extending it
+	auto visit = [&](BicliqueLite b) {
+		if (!make_maximal(g, b, oct_set, left_right) || !found.insert(b)) return;
+		worker_results[pool.worker_index()].push_back(b);
+		pool.submit([&extend, b]() mutable { extend(b); });
+	};
+
+	extend = [&](BicliqueLite & cur) {
+		for (auto o_itr = oct_set.begin(); o_itr != oct_set.end(); o_itr++) {
+			if (find(cur.get_left().begin(), cur.get_left().end(), *o_itr) == cur.get_left().end() && find(cur.get_right().begin(), cur.get_right().end(), *o_itr) == cur.get_right().end()) {
+				visit(add_to(g, cur, true, *o_itr));
+				visit(add_to(g, cur, false, *o_itr));
+			}
+		}
+	};
+
+	for (auto octitr = oct_set.begin(); octitr != oct_set.end(); octitr++) {
+		size_t v = *octitr;
+		pool.submit([&, v] {
+			std::vector<std::vector<size_t>> mis_list =
+				get_all_mis_near_bipartite(g, g.get_neighbors_vector(v), oct_set, og.get_left(),
+				                           octmibii_results.mis_cache.get());
+			for (auto & mis : mis_list) visit(BicliqueLite(std::vector<size_t>{v}, mis));
+		});
+	}
+	pool.submit([&] {
+		for (auto & b : crossing_bicliques(worker_results[pool.worker_index()], og, non_oct_vertices)) {
+			visit(b);
+		}
+	});
+	pool.wait();
+
+	for (auto & results : worker_results) octmibii_results.merge(results);
+
+}
+
+}
+
 void octmibii_cc(OutputOptions & octmibii_results,
         const Graph & g,
-        const OrderedVertexSet input_oct_set,
-        const OrderedVertexSet input_left_set,
-        const OrderedVertexSet input_right_set) {
-	std::set<BicliqueLite> hash_set;
+        OrderedVertexSet input_oct_set,
+        OrderedVertexSet input_left_set,
+        OrderedVertexSet input_right_set,
+        std::ostream & log) {
+	// If we're missing either OCT or left_partition, compute them
+	if (input_oct_set.size() == 0 || input_left_set.size() == 0) {
+		clock_t begin = std::clock();
+		input_left_set = OrderedVertexSet();
+		input_right_set = OrderedVertexSet();
+		octdecomposition(g, input_oct_set, input_left_set, input_right_set,
+		                 octmibii_results.oct_search, log);
+		clock_t end = std::clock();
+		octmibii_results.time_oct_decomp += double(end - begin) / CLOCKS_PER_SEC;
+	}
+	// If OCT and left_partition are set, then right_partition is determined
+	else if (input_right_set.size() == 0) {
+		for (size_t idx = 0; idx < g.get_num_vertices(); idx++) {
+			if (input_oct_set.has_vertex(idx) || input_left_set.has_vertex(idx)) continue;
+			input_right_set.add_vertex_unsafe(idx);
+		}
+	}
+
+	BicliqueStore hash_set;
 	std::stack<BicliqueLite> stack;
 	// Step (2) - generate Bicliques based on the MIS from the neighborhoods of the OCT set.
 	OrderedVertexSet left_right = input_left_set.set_union(input_right_set);
@@ -90,16 +283,20 @@ void octmibii_cc(OutputOptions & octmibii_results,
     const OrderedVector right_partition_OV(right_partition.get_vertices());
 
     OrderedVector non_oct_vertices(left_partition_OV.set_union(right_partition_OV));
-	
+
+	if (octmibii_results.num_threads > 1) {
+		octmibii_closure_parallel(octmibii_results, g, og, input_oct_set, left_right, non_oct_vertices);
+		return;
+	}
+
 	for (auto octitr = input_oct_set.begin(); octitr != input_oct_set.end(); octitr++) {
 		auto neighbs = g.get_neighbors_vector(*octitr);
-		auto neighborhood = g.subgraph(neighbs);
-		std::vector<std::vector<size_t>> mis_list = get_all_mis(neighborhood);
-		convert_node_labels_vector_inplace(mis_list, neighbs);
+		std::vector<std::vector<size_t>> mis_list = get_all_mis_near_bipartite(g, neighbs, input_oct_set, left_partition,
+		                                                                       octmibii_results.mis_cache.get());
 		for (auto mis_itr = mis_list.begin(); mis_itr != mis_list.end(); mis_itr++) {
 			BicliqueLite b = BicliqueLite(std::vector<size_t>{*octitr}, *mis_itr);
 			if (make_maximal(g, b, input_oct_set, left_right)) {
-				if (hash_set.insert(b).second) {
+				if (hash_set.insert(b)) {
 					stack.push(b);
 					octmibii_results.push_back(b);
 				}
@@ -107,28 +304,12 @@ void octmibii_cc(OutputOptions & octmibii_results,
 		}
 	}
 	// Step (1) - call MCBB on the bipartite portion
-	OutputOptions temp;
-	// Extract bipartite subgraph
-	Graph g_minus_oct = og.subgraph(non_oct_vertices);
-        std::vector<size_t> bipartite_left, bipartite_right;
-
-	for (size_t idx=0; idx< non_oct_vertices.size(); idx++){
-            if (left_partition.has_vertex(non_oct_vertices[idx])) {
-                bipartite_left.push_back(idx);
-            }
-            else bipartite_right.push_back(idx);
-        }
-        // Compute mcbs on bipartite graph
-        temp.turn_on_relabeling_mode(non_oct_vertices);
-	maximal_crossing_bicliques_bipartite(temp,
-                                             g_minus_oct,
-                                             bipartite_left,
-                                             bipartite_right);
-	for (auto b_itr = temp.mibs_computed.begin(); b_itr != temp.mibs_computed.end(); b_itr++) {
+	std::vector<BicliqueLite> crossing = crossing_bicliques(octmibii_results, og, non_oct_vertices);
+	for (auto b_itr = crossing.begin(); b_itr != crossing.end(); b_itr++) {
 		BicliqueLite b = *b_itr;
 		//I think if there was any place we could avoid using left_right it would be here
 		if(make_maximal(g, b, input_oct_set, left_right)) {
-			if (hash_set.insert(b).second) {
+			if (hash_set.insert(b)) {
 				stack.push(b);
 				octmibii_results.push_back(b);
 			}
@@ -143,14 +324,14 @@ void octmibii_cc(OutputOptions & octmibii_results,
 			if (find(cur.get_left().begin(), cur.get_left().end(), *o_itr) == cur.get_left().end() && find(cur.get_right().begin(), cur.get_right().end(), *o_itr) == cur.get_right().end()) {
 				BicliqueLite m1 = add_to(g, cur, true, *o_itr);
 				if(make_maximal(g, m1, input_oct_set, left_right)) {
-					if (hash_set.insert(m1).second) {
+					if (hash_set.insert(m1)) {
 						stack.push(m1);
 						octmibii_results.push_back(m1);
 					}
 				}
 				BicliqueLite m2 = add_to(g, cur, false, *o_itr);
 				if(make_maximal(g, m2, input_oct_set, left_right)) {
-					if (hash_set.insert(m2).second) {
+					if (hash_set.insert(m2)) {
 						stack.push(m2);
 						octmibii_results.push_back(m2);
 					}
@@ -175,9 +356,10 @@ void octmibii(OutputOptions & octmibii_results,
     octmibii_results.n = g.get_num_vertices();
     octmibii_results.m = g.get_num_edges();
 
-    // Determine connected components
+    // Determine connected components (of the core left after size-constraint
+    // peeling, if any size constraints are in place)
     clock_t begint = std::clock();
-    std::vector<std::vector<size_t>> vector_of_ccs = simpleccs(g);
+    std::vector<std::vector<size_t>> vector_of_ccs = simpleccs(g, octmibii_results.size_constraints.min_degree());
     clock_t endt = std::clock();
     octmibii_results.time_ccs += double(endt - begint) / CLOCKS_PER_SEC;
     octmibii_results.num_connected_components = vector_of_ccs.size();
@@ -193,48 +375,52 @@ void octmibii(OutputOptions & octmibii_results,
     }
 
 
-    if (vector_of_ccs.size() > 1) {
-        OrderedVertexSet oct_set_cc, left_set_cc, right_set_cc;
-
-        // run octmib on each CC
-        for (size_t which_cc = 0; which_cc < vector_of_ccs.size(); which_cc++) {
+    // Peeled vertices also force the per-CC path, as the core is a proper subgraph
+    if (vector_of_ccs.size() != 1 || vector_of_ccs.front().size() < g.get_num_vertices()) {
 
-            // Time this CC
-            begint = std::clock();
-
-            std::vector<size_t> vertex_subset = vector_of_ccs[which_cc];
-            octmibii_results.relabeling_mode = false;
-
-            // relabel ground truth using this ordering
-            std::vector<size_t> reverse_ordering(g.get_num_vertices());
+        // Position of each vertex within its CC, for relabeling into the CC
+        std::vector<size_t> reverse_ordering(g.get_num_vertices());
+        for (auto & vertex_subset : vector_of_ccs) {
             for (size_t idx1=0; idx1<vertex_subset.size(); idx1++) {
                 reverse_ordering[vertex_subset[idx1]] = idx1;
             }
+        }
+
+        // run octmibii on each CC, possibly several at once
+        run_components(octmibii_results, vector_of_ccs,
+                       [&](OutputOptions & cc_results, size_t which_cc, std::ostream & log) {
 
-            std::cout << "# CC " << which_cc + 1 << " of ";
-            std::cout << vector_of_ccs.size() << std::endl;
-            std::cout << "#\tsize: " << vertex_subset.size() << "/";
-            std::cout << g.get_num_vertices() << std::endl;
+            // Time this CC
+            clock_t begin_cc = std::clock();
+
+            const std::vector<size_t> & vertex_subset = vector_of_ccs[which_cc];
+            cc_results.relabeling_mode = false;
+
+            log << "# CC " << which_cc + 1 << " of ";
+            log << vector_of_ccs.size() << std::endl;
+            log << "#\tsize: " << vertex_subset.size() << "/";
+            log << g.get_num_vertices() << std::endl;
 
             // Skip Isolated vertices and empty sets
             if (vertex_subset.size() <= 1) {
-                octmibii_results.isolates ++;
-                continue;
+                cc_results.isolates ++;
+                return;
             }
 
             // Isolated edges are MIBs
             if (vertex_subset.size() == 2) {
                 BicliqueLite temp((std::vector<size_t>){vertex_subset.front()},
                                   (std::vector<size_t>){vertex_subset.back()});
-                octmibii_results.push_back_bipartite(temp);
-                octmibii_results.size_left ++;
-                octmibii_results.size_right ++;
-                continue;
+                cc_results.push_back_bipartite(temp);
+                cc_results.size_left ++;
+                cc_results.size_right ++;
+                return;
             }
 
             Graph g_cc = g.subgraph(vertex_subset);
 
             // Restrict OCT decomposition to this subgraph
+            OrderedVertexSet oct_set_cc, left_set_cc, right_set_cc;
             if (input_oct_set.size() > 0) {
                 oct_set_cc = input_oct_set.set_intersection(vertex_subset);
                 left_set_cc = input_left_set.set_intersection(vertex_subset);
@@ -246,15 +432,15 @@ void octmibii(OutputOptions & octmibii_results,
             left_set_cc = convert_node_labels_OVS(left_set_cc, reverse_ordering);
             right_set_cc = convert_node_labels_OVS(right_set_cc, reverse_ordering);
 
-            octmibii_results.turn_on_relabeling_mode(vertex_subset);
-            octmibii_cc(octmibii_results, g_cc, oct_set_cc, left_set_cc, right_set_cc);
+            cc_results.turn_on_relabeling_mode(vertex_subset);
+            octmibii_cc(cc_results, g_cc, oct_set_cc, left_set_cc, right_set_cc, log);
 
-            endt = std::clock();
-            std::cout << "# this CC ran in ";
-            std::cout << double(endt - begint) / CLOCKS_PER_SEC;
-            std::cout << "\n#\n# " << std::endl;
+            clock_t end_cc = std::clock();
+            log << "# this CC ran in ";
+            log << double(end_cc - begin_cc) / CLOCKS_PER_SEC;
+            log << "\n#\n# " << std::endl;
 
-        }
+        });
 
     }
     else {
@@ -29,15 +29,16 @@
  * Then, checks agains expansion_set2 to see if the biclique is maximal wrt set2.
  * Returns true if maximal wrt set2 (and edits the Biclique), false and does not edit otherwise.
  */
-bool make_maximal(const Graph & g, BicliqueLite & b, OrderedVertexSet expansion_set1, OrderedVertexSet expansion_set2);
+bool make_maximal(const Graph & g, BicliqueLite & b, const OrderedVertexSet & expansion_set1, const OrderedVertexSet & expansion_set2);
 
 BicliqueLite add_to(const Graph & g, BicliqueLite & b, bool left, size_t vertex);
 
 void octmibii_cc(OutputOptions & octmibii_results,
         const Graph & g,
-        const OrderedVertexSet input_oct_set,
-        const OrderedVertexSet input_left_set,
-        const OrderedVertexSet input_right_set);
+        OrderedVertexSet input_oct_set,
+        OrderedVertexSet input_left_set,
+        OrderedVertexSet input_right_set,
+        std::ostream & log = std::cout);
 
 /**
  * Wrapper for our OCTMIB algorithm together that first separates out
@@ -11,15 +11,35 @@
 */
 
 #include "OCTMICA.h"
+#include "ComponentScheduler.h"
 #include "SimpleCCs.h"
+#include "../graph/BicliqueStore.h"
 #include "../graph/OrderedVector.h"
 
 void octmica_cc(OutputOptions & octmica_results,
         const Graph & g,
-        const OrderedVertexSet input_oct_set,
-        const OrderedVertexSet input_left_set,
-        const OrderedVertexSet input_right_set) {
-	std::set<BicliqueLite> hash_set;
+        OrderedVertexSet input_oct_set,
+        OrderedVertexSet input_left_set,
+        OrderedVertexSet input_right_set,
+        std::ostream & log) {
+	// If we're missing either OCT or left_partition, compute them
+	if (input_oct_set.size() == 0 || input_left_set.size() == 0) {
+		clock_t begin = std::clock();
+		input_left_set = OrderedVertexSet();
+		input_right_set = OrderedVertexSet();
+		octdecomposition(g, input_oct_set, input_left_set, input_right_set,
+		                 octmica_results.oct_search, log);
+		clock_t end = std::clock();
+		octmica_results.time_oct_decomp += double(end - begin) / CLOCKS_PER_SEC;
+	}
+	// If OCT and left_partition are set, then right_partition is determined
+	else if (input_right_set.size() == 0) {
+		for (size_t idx = 0; idx < g.get_num_vertices(); idx++) {
+			if (input_oct_set.has_vertex(idx) || input_left_set.has_vertex(idx)) continue;
+			input_right_set.add_vertex_unsafe(idx);
+		}
+	}
+
 	std::stack<BicliqueLite> stack;
 	OrderedVertexSet left_right = input_left_set.set_union(input_right_set);
 
@@ -49,31 +69,20 @@ void octmica_cc(OutputOptions & octmica_results,
                                              bipartite_left,
                                              bipartite_right);
 
-	std::set<BicliqueLite> C;
-	for (auto b_itr = temp.mibs_computed.begin(); b_itr != temp.mibs_computed.end(); b_itr++) {
-		BicliqueLite b = *b_itr;
-		std::vector<size_t> left, right, temp;
-		left = b.get_left();
-		right = g.get_neighborhood_intersection(left, false);
-		left = g.get_neighborhood_intersection(right, false);
-		BicliqueLite new_biclique = BicliqueLite(left,right);
-		if(C.insert(new_biclique).second){
-			octmica_results.push_back(new_biclique);
+	// Closures of the crossing bicliques, and stars of the OCT vertices, as seeds
+	BicliqueStore found, seeds_found;
+	std::vector<BicliqueLite> C, C0;
+	for (auto & b : mica_closures(g, temp.mibs_computed, octmica_results.num_threads)) {
+		if(found.insert(b)){
+			C.push_back(b);
+			octmica_results.push_back(b);
 		}
 	}
-	std::set<BicliqueLite> C0;
-	for (auto &v : oct_set) {
-		std::vector<size_t> left, right, temp;
-		left = g.get_neighbors_vector(v);
-		right = g.get_neighborhood_intersection(left, false);
-		//if right does not have the original vertex, add it in (should not be necessary)
-		if (find(right.begin(), right.end(), v) == left.end()) {
-			right.push_back(v);
-		}
-		BicliqueLite new_biclique = BicliqueLite(left,right);
-		auto it = C0.insert(new_biclique);
-		if(C.insert(new_biclique).second) {
-			octmica_results.push_back(new_biclique);
+	for (auto & b : mica_stars(g, oct_set.get_vertices(), octmica_results.num_threads)) {
+		if (seeds_found.insert(b)) C0.push_back(b);
+		if(found.insert(b)) {
+			C.push_back(b);
+			octmica_results.push_back(b);
 		}
 	}
 	mica_initialized(octmica_results, g, C0, C);
@@ -94,9 +103,10 @@ void octmica(OutputOptions & octmica_results,
     octmica_results.n = g.get_num_vertices();
     octmica_results.m = g.get_num_edges();
 
-    // Determine connected components
+    // Determine connected components (of the core left after size-constraint
+    // peeling, if any size constraints are in place)
     clock_t begint = std::clock();
-    std::vector<std::vector<size_t>> vector_of_ccs = simpleccs(g);
+    std::vector<std::vector<size_t>> vector_of_ccs = simpleccs(g, octmica_results.size_constraints.min_degree());
     clock_t endt = std::clock();
     octmica_results.time_ccs += double(endt - begint) / CLOCKS_PER_SEC;
     octmica_results.num_connected_components = vector_of_ccs.size();
@@ -112,48 +122,52 @@ void octmica(OutputOptions & octmica_results,
     }
 
 
-    if (vector_of_ccs.size() > 1) {
-        OrderedVertexSet oct_set_cc, left_set_cc, right_set_cc;
-
-        // run octmib on each CC
-        for (size_t which_cc = 0; which_cc < vector_of_ccs.size(); which_cc++) {
-
-            // Time this CC
-            begint = std::clock();
+    // Peeled vertices also force the per-CC path, as the core is a proper subgraph
+    if (vector_of_ccs.size() != 1 || vector_of_ccs.front().size() < g.get_num_vertices()) {
 
-            std::vector<size_t> vertex_subset = vector_of_ccs[which_cc];
-            octmica_results.relabeling_mode = false;
-
-            // relabel ground truth using this ordering
-            std::vector<size_t> reverse_ordering(g.get_num_vertices());
+        // Position of each vertex within its CC, for relabeling into the CC
+        std::vector<size_t> reverse_ordering(g.get_num_vertices());
+        for (auto & vertex_subset : vector_of_ccs) {
             for (size_t idx1=0; idx1<vertex_subset.size(); idx1++) {
                 reverse_ordering[vertex_subset[idx1]] = idx1;
             }
+        }
 
-            std::cout << "# CC " << which_cc + 1 << " of ";
-            std::cout << vector_of_ccs.size() << std::endl;
-            std::cout << "#\tsize: " << vertex_subset.size() << "/";
-            std::cout << g.get_num_vertices() << std::endl;
+        // run octmica on each CC, possibly several at once
+        run_components(octmica_results, vector_of_ccs,
+                       [&](OutputOptions & cc_results, size_t which_cc, std::ostream & log) {
+
+            // Time this CC
+            clock_t begin_cc = std::clock();
+
+            const std::vector<size_t> & vertex_subset = vector_of_ccs[which_cc];
+            cc_results.relabeling_mode = false;
+
+            log << "# CC " << which_cc + 1 << " of ";
+            log << vector_of_ccs.size() << std::endl;
+            log << "#\tsize: " << vertex_subset.size() << "/";
+            log << g.get_num_vertices() << std::endl;
 
             // Skip Isolated vertices and empty sets
             if (vertex_subset.size() <= 1) {
-                octmica_results.isolates ++;
-                continue;
+                cc_results.isolates ++;
+                return;
             }
 
             // Isolated edges are MIBs
             if (vertex_subset.size() == 2) {
                 BicliqueLite temp((std::vector<size_t>){vertex_subset.front()},
                                   (std::vector<size_t>){vertex_subset.back()});
-                octmica_results.push_back_bipartite(temp);
-                octmica_results.size_left ++;
-                octmica_results.size_right ++;
-                continue;
+                cc_results.push_back_bipartite(temp);
+                cc_results.size_left ++;
+                cc_results.size_right ++;
+                return;
             }
 
             Graph g_cc = g.subgraph(vertex_subset);
 
             // Restrict OCT decomposition to this subgraph
+            OrderedVertexSet oct_set_cc, left_set_cc, right_set_cc;
             if (input_oct_set.size() > 0) {
                 oct_set_cc = input_oct_set.set_intersection(vertex_subset);
                 left_set_cc = input_left_set.set_intersection(vertex_subset);
@@ -165,15 +179,15 @@ void octmica(OutputOptions & octmica_results,
             left_set_cc = convert_node_labels_OVS(left_set_cc, reverse_ordering);
             right_set_cc = convert_node_labels_OVS(right_set_cc, reverse_ordering);
 
-            octmica_results.turn_on_relabeling_mode(vertex_subset);
-            octmica_cc(octmica_results, g_cc, oct_set_cc, left_set_cc, right_set_cc);
+            cc_results.turn_on_relabeling_mode(vertex_subset);
+            octmica_cc(cc_results, g_cc, oct_set_cc, left_set_cc, right_set_cc, log);
 
-            endt = std::clock();
-            std::cout << "# this CC ran in ";
-            std::cout << double(endt - begint) / CLOCKS_PER_SEC;
-            std::cout << "\n#\n# " << std::endl;
+            clock_t end_cc = std::clock();
+            log << "# this CC ran in ";
+            log << double(end_cc - begin_cc) / CLOCKS_PER_SEC;
+            log << "\n#\n# " << std::endl;
 
-        }
+        });
 
     }
     else {
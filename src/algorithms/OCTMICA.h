@@ -32,9 +32,10 @@
  */
 void octmica_cc(OutputOptions & octmica_results,
         const Graph & g,
-        const OrderedVertexSet input_oct_set,
-        const OrderedVertexSet input_left_set,
-        const OrderedVertexSet input_right_set);
+        OrderedVertexSet input_oct_set,
+        OrderedVertexSet input_left_set,
+        OrderedVertexSet input_right_set,
+        std::ostream & log = std::cout);
 
 /**
  * Wrapper for our OCTMIB algorithm together that first separates out
@@ -0,0 +1,157 @@
+/**
+ * octportfolio computes an OCT decomposition by running many starts and
+ * keeping the best. Each is a run of localsearchoct seeded from seed + i for
+ * start i: start 0 from simpleoct's coloring, and the others from BFS
+ * colorings grown from roots in random order, so that the starts try many
+ * BFS roots and vertex orders. Each start searches locally until the time
+ * budget, shared by all starts, is spent; with none, each start is just its
+ * coloring, with OCT vertices that have no neighbors on a side moved there.
+ *
+ * Starts are taken by num_threads threads. The smallest OCT set is kept; of
+ * those, the one with the most edges among its OCT vertices, as OCT-MIB
+ * enumerates the maximal independent sets of the OCT subgraph, and denser
+ * graphs have fewer of them. Remaining ties go to the first start, so the
+ * result does not depend on the number of threads unless the time budget
+ * runs out.
+ *
+ * @authors Eric Horton, Kyle Kloster, Drew van der Poel
+ *
+ * This file is part of MI-bicliques, https://github.com/TheoryInPractice/MI-bicliques,
+ * and is Copyright (C) North Carolina State University, 2018.
+ * It is licensed under the three-clause BSD license; see LICENSE.
+ */
+
+#include <algorithm> // for std::min
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <vector>
+
+#include "OCTPortfolio.h"
+#include "LocalSearchOCT.h"
+#include "WorkStealingPool.h"
+
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+
+// A start's OCT decomposition, and how it ranks
+struct PortfolioStart {
+    size_t start = 0;
+    size_t oct_edges = 0;
+    double finish_time = 0.0;
+    OrderedVertexSet oct_set, left_partition, right_partition;
+
+    // Whether this start is to be kept over other
+    bool is_better_than(const PortfolioStart & other) const {
+        if (oct_set.size() != other.oct_set.size()) return oct_set.size() < other.oct_set.size();
+        if (oct_edges != other.oct_edges) return oct_edges > other.oct_edges;
+        return start < other.start;
+    }
+};
+
+
+// Number of edges among the vertices of s
+size_t count_edges_within(const Graph & g, const OrderedVertexSet & s) {
+    size_t num_edges = 0;
+    for (size_t v : s) {
+        for (size_t u : g.get_neighbors_vector(v)) {
+            if (u < v && s.has_vertex(u)) num_edges++;
+        }
+    }
+    return num_edges;
+}
+
+}
+
+
+/**
+ * Print the number of starts finding each OCT size, and the start kept.
+ */
+void OCTPortfolioReport::print(std::ostream & log) const {
+    size_t num_starts = 0;
+    log << "#\tOCT portfolio sizes:";
+    for (auto & size_count : starts_by_oct_size) {
+        log << " " << size_count.first << " (x" << size_count.second << ")";
+        num_starts += size_count.second;
+    }
+    log << " over " << num_starts << " starts" << std::endl;
+    log << "#\tOCT portfolio kept start " << best_start << ", with ";
+    log << best_oct_edges << " OCT edges, found in " << time_to_best;
+    log << " seconds" << std::endl;
+}
+
+
+/**
+ * Compute an OCT decomposition of g by the best of options.portfolio_starts
+ * starts (see above), on options.num_threads threads, within
+ * options.time_budget seconds.
+ *
+ * @param g               Graph to decompose.
+ * @param oct_set         OCT set found.
+ * @param left_partition  Left partition found, with every isolated vertex.
+ * @param right_partition Right partition found.
+ * @param options         Number of starts and threads, time budget and seed.
+ * @return                The sizes found, and the start kept.
+ */
+OCTPortfolioReport octportfolio(const Graph & g,
+                                OrderedVertexSet & oct_set,
+                                OrderedVertexSet & left_partition,
+                                OrderedVertexSet & right_partition,
+                                const OCTSearchOptions & options) {
+
+    Clock::time_point begin = Clock::now();
+    size_t num_starts = std::max<size_t>(options.portfolio_starts, 1);
+    size_t num_threads = std::max<size_t>(std::min(options.num_threads, num_starts), 1);
+
+    OCTPortfolioReport report;
+    PortfolioStart best;
+    bool have_best = false;
+    std::mutex best_mutex;
+
+    auto run_start = [&](size_t start) {
+        PortfolioStart result;
+        result.start = start;
+        double elapsed = std::chrono::duration<double>(Clock::now() - begin).count();
+        double time_budget = (options.time_budget > elapsed) ? options.time_budget - elapsed : 0;
+
+        localsearchoct_run(g, result.oct_set, result.left_partition, result.right_partition,
+                           start > 0, options.seed + start, time_budget);
+        result.oct_edges = count_edges_within(g, result.oct_set);
+        result.finish_time = std::chrono::duration<double>(Clock::now() - begin).count();
+
+        std::lock_guard<std::mutex> lock(best_mutex);
+        report.starts_by_oct_size[result.oct_set.size()]++;
+        if (!have_best || result.is_better_than(best)) {
+            best = std::move(result);
+            have_best = true;
+        }
+    };
+
+    if (num_threads <= 1) {
+        for (size_t start = 0; start < num_starts; start++) run_start(start);
+    }
+    else {
+        std::atomic<size_t> next_start(0);
+        WorkStealingPool pool(num_threads);
+        for (size_t worker = 0; worker < pool.size(); worker++) {
+            pool.submit([&] {
+                for (size_t start = next_start++; start < num_starts; start = next_start++) {
+                    run_start(start);
+                }
+            });
+        }
+        pool.wait();
+    }
+
+    oct_set = std::move(best.oct_set);
+    left_partition = std::move(best.left_partition);
+    right_partition = std::move(best.right_partition);
+    report.best_start = best.start;
+    report.best_oct_edges = best.oct_edges;
+    report.time_to_best = best.finish_time;
+    return report;
+
+}
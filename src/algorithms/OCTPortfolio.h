@@ -0,0 +1,44 @@
+/**
+ * octportfolio runs many randomized OCT decompositions in parallel and keeps
+ * the best. See OCTPortfolio.cpp for full documentation.
+ *
+ * @authors Eric Horton, Kyle Kloster, Drew van der Poel
+ *
+ * This file is part of MI-bicliques, https://github.com/TheoryInPractice/MI-bicliques,
+ * and is Copyright (C) North Carolina State University, 2018.
+ * It is licensed under the three-clause BSD license; see LICENSE.
+ */
+
+#ifndef BICLIQUES_OCTPORTFOLIO_H
+#define BICLIQUES_OCTPORTFOLIO_H
+
+#include <iostream>
+#include <map>
+#include "../graph/OrderedVertexSet.h"
+#include "../graph/Graph.h"
+#include "OCTDecomposition.h"
+
+
+/**
+ * What the starts of a portfolio found: how many found an OCT set of each
+ * size, and which was kept, with the edges among its OCT vertices and the
+ * seconds from the start of the portfolio until it finished.
+ */
+struct OCTPortfolioReport {
+    std::map<size_t, size_t> starts_by_oct_size;
+    size_t best_start = 0;
+    size_t best_oct_edges = 0;
+    double time_to_best = 0.0;
+
+    void print(std::ostream & log) const;
+};
+
+
+OCTPortfolioReport octportfolio(const Graph & g,
+                                OrderedVertexSet & oct_set,
+                                OrderedVertexSet & left_partition,
+                                OrderedVertexSet & right_partition,
+                                const OCTSearchOptions & options);
+
+
+#endif //BICLIQUES_OCTPORTFOLIO_H
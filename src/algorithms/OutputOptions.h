@@ -11,13 +11,18 @@
 
 #include "../graph/BicliqueLite.h"
 #include "../graph/OrderedVertexSet.h"
+#include "../graph/SizeConstraints.h"
 
 #include "stddef.h"  // apparently required for size_t
+#include <algorithm>  // for std::max
 #include <memory>  // for std::shared_ptr
+#include <csignal>  // for raise
 #include <fstream>
 #include <vector>
 
 #include "../graph/Graph.h"
+#include "OCTDecomposition.h"
+#include "MISCache.h"
 
 
 /**
@@ -32,7 +37,6 @@ public:
     std::vector<size_t> relabeling_vector;
     std::ofstream output_file;
 
-    std::shared_ptr<std::unordered_map<std::string, bool>> external_duplicates_table_ptr;
     std::shared_ptr<const Graph> external_graph_ptr;
     OrderedVertexSet external_oct_set;
 
@@ -42,9 +46,36 @@ public:
     bool relabeling_mode = false;
     bool check_maximality_mode = false;
 
+    // Number of worker threads the algorithm may use, and whether parallel
+    // runs must output MIBs in the same order as serial ones
+    size_t num_threads = 1;
+    bool deterministic_mode = false;
+
+    // Maximal independent sets of induced subgraphs shared by every search
+    // of the run; no caching if null
+    std::shared_ptr<MISCache> mis_cache;
+
+    // Once the bag being expanded and those waiting in its search tree hold
+    // more than this many bytes, bags are expanded one child at a time; no
+    // bound if 0. The most held at once is recorded in peak_frontier_bytes.
+    size_t max_frontier_bytes = 0;
+    size_t peak_frontier_bytes = 0;
+
+    // Run on a pool, OCT-MIB builds initial bags from at least this many
+    // blueprint seeds, and expands bags needing at least this many blueprint
+    // expansions, in subtasks so that idle workers share them.
+    size_t min_pool_work = 1 << 14;
+
+    // OCT decompositions not given are found by octdecomposition with these
+    // options, for each connected component
+    OCTSearchOptions oct_search;
+
     long mib_limit_value = -2;
     bool mib_limit_flag = false;
 
+    // Only bicliques satisfying these bounds are counted and recorded
+    SizeConstraints size_constraints;
+
 
     double time_oct_decomp = 0.0;
     double time_bipartite_mcb = 0.0;
@@ -80,6 +111,10 @@ public:
 
     size_t isolates = 0;
 
+    // Lookups into each tier of the global duplicates table (see DuplicatesTable)
+    size_t num_dup_filter_lookups = 0;
+    size_t num_dup_table_lookups = 0;
+
     size_t num_connected_components = 0;
 
 
@@ -129,11 +164,9 @@ public:
         external_oct_set = OrderedVertexSet();
     }
 
-    void turn_on_max_check_mode(const std::unordered_map<std::string, bool> & duplicates_table,
-                                const OrderedVertexSet & external_oct) {
+    void turn_on_max_check_mode(const OrderedVertexSet & external_oct) {
 
         check_maximality_mode = true;
-        external_duplicates_table_ptr = std::make_shared<std::unordered_map<std::string, bool>> (duplicates_table);
 
         if (relabeling_mode){
             std::vector<size_t> temp;
@@ -158,29 +191,114 @@ public:
         if (relabeling_mode) convert_node_labels_biclique(this_mib, relabeling_vector);
 
         if (print_mode) output_file << this_mib.to_string() << std::endl;
-        else mibs_computed.push_back(this_mib);
+        else mibs_computed.push_back(std::move(this_mib));
 
     }
 
     inline void push_back_bipartite(const BicliqueLite & this_mib) {
+        if (!size_constraints.is_satisfied_by(this_mib)) return;
         // increment number of mibs regardless of mode
         bipartite_num_mibs++;
         if (!count_only_mode) record_biclique(this_mib);
     }
 
     inline void push_back(const BicliqueLite & this_mib) {
+        if (!size_constraints.is_satisfied_by(this_mib)) return;
         // increment number of mibs regardless of mode
         total_num_mibs++;
         if (!count_only_mode) record_biclique(this_mib);
     }
 
+    /**
+     * Set up `shard` to record part of this run on a worker thread: same
+     * constraints and modes, but single-threaded and without printing.
+     */
+    void configure_shard(OutputOptions & shard) const {
+        shard.size_constraints = size_constraints;
+        shard.count_only_mode = count_only_mode;
+        shard.external_graph_ptr = external_graph_ptr;
+        shard.mis_cache = mis_cache;
+        shard.max_frontier_bytes = max_frontier_bytes;
+        shard.min_pool_work = min_pool_work;
+        shard.oct_search = oct_search;
+    }
+
+    /**
+     * Fold the output and statistics of `shard`, an OutputOptions that a
+     * worker recorded into without printing, into this one. The bicliques of
+     * `shard` are moved out and recorded here.
+     */
+    void merge(OutputOptions & shard) {
+
+        total_num_mibs += shard.total_num_mibs;
+        bipartite_num_mibs += shard.bipartite_num_mibs;
+        for (auto & this_mib : shard.mibs_computed) record_biclique(std::move(this_mib));
+        shard.mibs_computed.clear();
+
+        time_oct_decomp += shard.time_oct_decomp;
+        time_bipartite_mcb += shard.time_bipartite_mcb;
+        time_bipartite_mcb_check += shard.time_bipartite_mcb_check;
+        time_oct_MIS += shard.time_oct_MIS;
+        time_blueprint_init += shard.time_blueprint_init;
+        time_iter_mis += shard.time_iter_mis;
+        time_mcbs += shard.time_mcbs;
+        time_mcb_checking += shard.time_mcb_checking;
+        time_search_tree_expand += shard.time_search_tree_expand;
+
+        num_oct_mis += shard.num_oct_mis;
+        num_oct_mis_completed += shard.num_oct_mis_completed;
+        num_oct_iter_mis += shard.num_oct_iter_mis;
+        num_oct_iter_mis_completed += shard.num_oct_iter_mis_completed;
+        num_oct_vertices += shard.num_oct_vertices;
+        num_oct_edges += shard.num_oct_edges;
+        size_left += shard.size_left;
+        size_right += shard.size_right;
+        isolates += shard.isolates;
+        num_dup_filter_lookups += shard.num_dup_filter_lookups;
+        num_dup_table_lookups += shard.num_dup_table_lookups;
+        peak_frontier_bytes = std::max(peak_frontier_bytes, shard.peak_frontier_bytes);
+
+    }
+
+    /**
+     * Whether a MIB limit is in place and num_mibs passes it.
+     */
+    bool passes_mib_limit(size_t num_mibs) const {
+        return mib_limit_flag && mib_limit_value >= 0 &&
+               num_mibs > static_cast<size_t>(mib_limit_value);
+    }
+
+    /**
+     * Stop the run if a MIB limit is in place and has been passed.
+     */
+    void check_mib_limit() const {
+        if (passes_mib_limit(total_num_mibs)) raise(SIGINT);
+    }
+
+    /**
+     * Count-only counterparts of push_back_bipartite and push_back, for
+     * engines that know the side sizes of a biclique without building it.
+     */
+    inline void count_bipartite(size_t size_a, size_t size_b) {
+        if (size_constraints.is_satisfied_by(size_a, size_b)) bipartite_num_mibs++;
+    }
+
+    inline void count(size_t size_a, size_t size_b) {
+        if (size_constraints.is_satisfied_by(size_a, size_b)) total_num_mibs++;
+    }
+
+    /**
+     * Record a biclique found by MCBB, after checking it is maximal with
+     * respect to external_oct_set when check_maximality_mode is on.
+     * MCBB finds each biclique of the bipartite graph exactly once, so no
+     * duplicate check is needed.
+     */
     void push_back_with_maximality_check(const BicliqueLite & this_mib) {
 
         if (!check_maximality_mode) push_back_bipartite(this_mib);
 
-        else {
+        else if (size_constraints.is_satisfied_by(this_mib)) {
 
-            bool maximality_indicator = true;
             BicliqueLite temp_biclique = this_mib;
 
             if (relabeling_mode) {
@@ -190,25 +308,15 @@ public:
             for (auto oct_node: external_oct_set) {
 
                 if (external_graph_ptr->can_be_added_to_biclique(oct_node, temp_biclique)) {
-                    maximality_indicator = false;
                     return;
                 }
             }
 
-            if (maximality_indicator) {
-                std::string this_biclique_string = temp_biclique.to_string();
-
-                if (external_duplicates_table_ptr->find(this_biclique_string) == external_duplicates_table_ptr->end()) {
+            bipartite_num_mibs++;
 
-                    (*external_duplicates_table_ptr)[this_biclique_string] = true;
-
-                    bipartite_num_mibs++;
-
-                    if (!count_only_mode) {
-                        if (print_mode) output_file << this_biclique_string << std::endl;
-                        else mibs_computed.push_back(temp_biclique);
-                    }
-                }
+            if (!count_only_mode) {
+                if (print_mode) output_file << temp_biclique.to_string() << std::endl;
+                else mibs_computed.push_back(std::move(temp_biclique));
             }
         }
     }
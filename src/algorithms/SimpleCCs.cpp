@@ -17,10 +17,62 @@
 
 std::vector<std::vector<size_t>> simpleccs(const Graph & g){
 
+return simpleccs(g, 0);
+
+}
+
+
+/**
+ * Compute the min_degree-core of g by repeatedly peeling vertices of degree
+ * less than min_degree. Returns an indicator vector of the surviving vertices.
+ */
+std::vector<bool> degree_core(const Graph & g, size_t min_degree){
+
+size_t num_vertices = g.get_num_vertices();
+std::vector<bool> in_core(num_vertices, true);
+if (min_degree == 0) return in_core;
+
+std::vector<size_t> degree(num_vertices);
+std::queue<size_t> peel_queue;
+for (size_t idx = 0; idx < num_vertices; idx++) {
+    degree[idx] = g.get_neighbors_vector(idx).size();
+    if (degree[idx] < min_degree) {
+        in_core[idx] = false;
+        peel_queue.push(idx);
+    }
+}
+
+while (peel_queue.size() > 0) {
+    size_t this_node = peel_queue.front();
+    peel_queue.pop();
+
+    for (size_t neighbor : g.get_neighbors_vector(this_node)) {
+        if (!in_core[neighbor]) continue;
+        degree[neighbor]--;
+        if (degree[neighbor] < min_degree) {
+            in_core[neighbor] = false;
+            peel_queue.push(neighbor);
+        }
+    }
+}
+
+return in_core;
+
+}
+
+
+/**
+ * Same as simpleccs(g), but first restricts g to its min_degree-core.
+ * Vertices outside the core belong to no component in the output.
+ */
+std::vector<std::vector<size_t>> simpleccs(const Graph & g, size_t min_degree){
+
 std::vector<std::vector<size_t>> res;
-// Data structures for tracking node visitation
+// Data structures for tracking node visitation; vertices outside the core
+// are treated as already visited so they are never explored.
 size_t num_vertices = g.get_num_vertices();
-std::vector<bool> already_visited(num_vertices);
+std::vector<bool> already_visited = degree_core(g, min_degree);
+already_visited.flip();
 std::queue<size_t> vertex_queue;
 
 // Iterate the BFS over all vertices
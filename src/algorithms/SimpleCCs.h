@@ -14,5 +14,9 @@
 
 std::vector<std::vector<size_t>> simpleccs(const Graph & g);
 
+std::vector<bool> degree_core(const Graph & g, size_t min_degree);
+
+std::vector<std::vector<size_t>> simpleccs(const Graph & g, size_t min_degree);
+
 
 #endif //BICLIQUES_SIMPLECCS_H
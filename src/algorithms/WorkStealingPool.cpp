@@ -0,0 +1,197 @@
+/**
+* @authors Eric Horton, Kyle Kloster, Drew van der Poel
+*
+* This file is part of MI-bicliques, https://github.com/TheoryInPractice/MI-bicliques,
+* and is Copyright (C) North Carolina State University, 2018.
+* It is licensed under the three-clause BSD license; see LICENSE.
+*/
+
+#include "WorkStealingPool.h"
+
+
+namespace {
+
+// The pool and worker index of the calling thread, if it is a worker
+thread_local const WorkStealingPool * current_pool = nullptr;
+thread_local size_t current_worker = 0;
+
+}
+
+
+/**
+ * Start `num_threads` workers (at least one).
+ */
+WorkStealingPool::WorkStealingPool(size_t num_threads) :
+    num_queued(0), num_pending(0), next_worker(0) {
+
+    if (num_threads == 0) num_threads = 1;
+
+    for (size_t index = 0; index < num_threads; index++) {
+        workers.push_back(std::unique_ptr<Worker>(new Worker()));
+    }
+    for (size_t index = 0; index < num_threads; index++) {
+        threads.emplace_back(&WorkStealingPool::run, this, index);
+    }
+
+}
+
+
+/**
+ * Finish every submitted task, then stop the workers.
+ */
+WorkStealingPool::~WorkStealingPool() {
+
+    wait();
+    {
+        std::lock_guard<std::mutex> lock(idle_mutex);
+        stopping = true;
+    }
+    work_available.notify_all();
+    for (auto & thread : threads) thread.join();
+
+}
+
+
+size_t WorkStealingPool::size() const {
+
+    return workers.size();
+
+}
+
+
+/**
+ * Queue a task. A task submitted from a worker of this pool goes on that
+ * worker's own deque; other submissions are spread over the workers in turn.
+ */
+void WorkStealingPool::submit(Task task) {
+
+    size_t index;
+    if (current_pool == this) index = current_worker;
+    else index = next_worker++ % workers.size();
+
+    num_pending++;
+    {
+        std::lock_guard<std::mutex> lock(workers[index]->mutex);
+        workers[index]->tasks.push_back(std::move(task));
+        num_queued++;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(idle_mutex);
+    }
+    work_available.notify_one();
+
+}
+
+
+/**
+ * Block until every submitted task, including those submitted by other
+ * tasks, has finished. Must not be called from a worker.
+ */
+void WorkStealingPool::wait() {
+
+    std::unique_lock<std::mutex> lock(idle_mutex);
+    all_done.wait(lock, [this] { return num_pending == 0; });
+
+}
+
+
+/**
+ * Called from a task running on a worker of this pool: run queued tasks, the
+ * worker's own first and then stolen ones, until `num_unfinished` is zero.
+ * The task counts its subtasks in `num_unfinished` and each subtask
+ * decrements it when done; as the newest tasks on the worker's deque, its
+ * subtasks are run before anything else that is queued there.
+ */
+void WorkStealingPool::wait(const std::atomic<size_t> & num_unfinished) {
+
+    Task task;
+    while (num_unfinished > 0) {
+        if (take_task(current_worker, task)) run_task(task);
+        else std::this_thread::yield();
+    }
+
+}
+
+
+/**
+ * Index in [0, size()) of the calling worker thread, so that tasks can keep
+ * per-worker state. Returns size() when not called from a worker.
+ */
+size_t WorkStealingPool::worker_index() const {
+
+    if (current_pool == this) return current_worker;
+    return workers.size();
+
+}
+
+
+/**
+ * Take the newest task of worker `index`, or else the oldest task of the
+ * first other worker that has one.
+ */
+bool WorkStealingPool::take_task(size_t index, Task & task) {
+
+    {
+        Worker & own = *workers[index];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty()) {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+            num_queued--;
+            return true;
+        }
+    }
+
+    for (size_t offset = 1; offset < workers.size(); offset++) {
+        Worker & victim = *workers[(index + offset) % workers.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            num_queued--;
+            return true;
+        }
+    }
+
+    return false;
+
+}
+
+
+/**
+ * Run a task taken from a deque, then count it as finished.
+ */
+void WorkStealingPool::run_task(Task & task) {
+
+    task();
+    task = nullptr;
+
+    if (--num_pending == 0) {
+        std::lock_guard<std::mutex> lock(idle_mutex);
+        all_done.notify_all();
+    }
+
+}
+
+
+void WorkStealingPool::run(size_t index) {
+
+    current_pool = this;
+    current_worker = index;
+
+    Task task;
+    while (true) {
+
+        if (take_task(index, task)) {
+            run_task(task);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(idle_mutex);
+        work_available.wait(lock, [this] { return stopping || num_queued > 0; });
+        if (stopping && num_queued == 0) return;
+
+    }
+
+}
@@ -0,0 +1,72 @@
+/**
+* @authors Eric Horton, Kyle Kloster, Drew van der Poel
+*
+* This file is part of MI-bicliques, https://github.com/TheoryInPractice/MI-bicliques,
+* and is Copyright (C) North Carolina State University, 2018.
+* It is licensed under the three-clause BSD license; see LICENSE.
+*/
+
+#ifndef BICLIQUES_WORKSTEALINGPOOL_H
+#define BICLIQUES_WORKSTEALINGPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "stddef.h"  // apparently required for size_t
+
+
+/**
+ * A fixed set of worker threads, each with its own deque of tasks. A worker
+ * runs the newest task of its own deque first and, when that is empty, steals
+ * the oldest task of another worker. Tasks may submit further tasks; these go
+ * on the submitting worker's deque, and a task may wait for its subtasks by
+ * running queued tasks meanwhile. See WorkStealingPool.cpp.
+ */
+class WorkStealingPool {
+
+public:
+    typedef std::function<void()> Task;
+
+    WorkStealingPool(size_t num_threads);
+    ~WorkStealingPool();
+
+    size_t size() const;
+
+    void submit(Task task);
+    void wait();
+    void wait(const std::atomic<size_t> & num_unfinished);
+
+    size_t worker_index() const;
+
+private:
+    struct Worker {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::vector<std::thread> threads;
+
+    // Tasks queued but not yet taken, and tasks submitted but not yet finished
+    std::atomic<size_t> num_queued;
+    std::atomic<size_t> num_pending;
+    std::atomic<size_t> next_worker;
+
+    std::mutex idle_mutex;
+    std::condition_variable work_available;
+    std::condition_variable all_done;
+    bool stopping = false;
+
+    bool take_task(size_t index, Task & task);
+    void run_task(Task & task);
+    void run(size_t index);
+
+};
+
+
+#endif //BICLIQUES_WORKSTEALINGPOOL_H
@@ -9,18 +9,22 @@
 
 // Includes
 #include <unistd.h> // for getopt
-#include <ctime> // for timing
+#include <getopt.h> // for getopt_long
+#include <chrono> // for timing
 #include <csignal> //for printing after timeout/interrupt
 #include <iostream>
 #include <fstream>
 #include "graph/Graph.h"
 #include "algorithms/OCTMIB.h"
+#include "algorithms/MIBSampling.h"
 #include "algorithms/OCTMIBII.h"
 #include "algorithms/LexMIB.h"
 #include "algorithms/MICA.h"
 #include "algorithms/OCTMICA.h"
 #include "algorithms/EnumMIB.h"
 #include "algorithms/SimpleCCs.h"
+#include "algorithms/OCTCache.h"
+#include "algorithms/OCTDecomposition.h"
 #include "algorithms/SimpleOCT.h"
 
 
@@ -98,7 +102,9 @@ struct OutputHandler {
 
     char alg_char;
 
-    clock_t begin = std::clock(), end = std::clock();
+    // Wall-clock time, as parallel runs use CPU time on several threads
+    std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+    std::chrono::steady_clock::time_point end = begin;
     double elapsed_time = -1.0;
 
     size_t num_vertices = 0;
@@ -106,6 +112,7 @@ struct OutputHandler {
     size_t num_connected_components = 0;
 
     bool is_it_bipartite = false;
+    bool sampling_mode = false;
 
     OutputOptions octmib_results;
     OutputOptions mica_results;
@@ -113,11 +120,75 @@ struct OutputHandler {
     OutputOptions octmibii_results;
     LexMIBResults lexmib_results;
     NonLexMIBResults nonlexmib_results;
+    MIBSampleResults sample_results;
 
-    void start_timer() { this->begin = std::clock(); }
+    // Shared by the algorithms that enumerate MISs of neighborhoods
+    std::shared_ptr<MISCache> mis_cache;
+
+    void start_timer() { this->begin = std::chrono::steady_clock::now(); }
     void stop_timer() {
-        this->end = std::clock();
-        this->elapsed_time = double(this->end - this->begin) / CLOCKS_PER_SEC;
+        this->end = std::chrono::steady_clock::now();
+        this->elapsed_time = std::chrono::duration<double>(this->end - this->begin).count();
+    }
+
+    /**
+     * Number of MIBs found by the enumeration algorithm that was run,
+     * or 0 for the non-enumerating options.
+     */
+    size_t num_mibs_found() const {
+        switch (this->alg_char) {
+            case 'o': return octmib_results.total_num_mibs;
+            case 'i': return octmibii_results.total_num_mibs;
+            case 'm': return mica_results.total_num_mibs;
+            case 't': return octmica_results.total_num_mibs;
+            case 'l': return lexmib_results.total_num_mibs;
+            case 'n': return nonlexmib_results.total_num_mibs;
+        }
+        return 0;
+    }
+
+    void print_throughput() const {
+        if (this->alg_char == 'c' || this->alg_char == 'b') return;
+        if (this->sampling_mode) {
+            std::cout << "# Drew " << sample_results.total_num_output;
+            std::cout << " weighted MIBs from " << sample_results.num_samples;
+            std::cout << " samples in " << this->elapsed_time << " seconds" << std::endl;
+            std::cout << "# Estimated number of MIBs: ";
+            std::cout << sample_results.estimated_num_mibs << std::endl;
+            return;
+        }
+        size_t num_mibs = num_mibs_found();
+        std::cout << "# Found " << num_mibs << " MIBs in " << this->elapsed_time;
+        if (this->elapsed_time > 0) {
+            std::cout << " seconds (" << num_mibs / this->elapsed_time << " MIBs/s)";
+        }
+        else std::cout << " seconds";
+        std::cout << std::endl;
+    }
+
+    void print_mis_cache_stats() const {
+        if (!mis_cache || mis_cache->get_num_lookups() == 0) return;
+        std::cout << "# MIS cache: " << mis_cache->get_num_hits() << " hits in ";
+        std::cout << mis_cache->get_num_lookups() << " lookups (";
+        std::cout << 100.0*mis_cache->get_num_hits()/mis_cache->get_num_lookups() << "%), ";
+        std::cout << mis_cache->size() << " entries in " << mis_cache->get_memory_usage();
+        std::cout << " bytes, " << mis_cache->get_num_evictions() << " evicted" << std::endl;
+    }
+
+    void print_frontier_stats() const {
+        const OutputOptions & results = (alg_char == 'i') ? octmibii_results : octmib_results;
+        if ((alg_char != 'o' && alg_char != 'i') || sampling_mode ||
+            results.peak_frontier_bytes == 0) return;
+        std::cout << "# Peak search tree frontier: " << results.peak_frontier_bytes;
+        std::cout << " bytes" << std::endl;
+    }
+
+    size_t num_mis_cache_lookups() const {
+        return mis_cache ? mis_cache->get_num_lookups() : 0;
+    }
+
+    size_t num_mis_cache_hits() const {
+        return mis_cache ? mis_cache->get_num_hits() : 0;
     }
 
     void write_to_log_file() {
@@ -141,6 +212,26 @@ struct OutputHandler {
                 output_file << std::endl;
                 break;
             case 'o':
+                if (this->sampling_mode) {
+                    output_file << "OCT-MIB-SAMPLE " << this->input_file_path;
+                    output_file << " " << this->successful_termination;
+                    output_file << " " << sample_results.num_samples;
+                    output_file << " " << sample_results.total_num_output;
+                    // std::fixed prevents scientific notation
+                    output_file << std::fixed << " " << sample_results.estimated_num_mibs;
+                    output_file << " " << this->elapsed_time;
+                    output_file << " " << sample_results.time_ccs;
+                    output_file << " " << sample_results.time_roots;
+                    output_file << " " << sample_results.num_roots;
+                    output_file << " " << sample_results.num_roots_built;
+                    output_file << " " << this->num_edges;
+                    output_file << " " << this->num_vertices;
+                    output_file << " " << this->time_out_value;
+                    output_file << " " << sample_results.seed;
+                    output_file << std::endl;
+                    break;
+                }
+
                 // Ensure we output stats from prescribed decomposition,
                 // if it was provided.
                 if (octmib_results.size_left_given > 0) {
@@ -180,6 +271,10 @@ struct OutputHandler {
                 output_file << " " << this->num_vertices << std::flush;
                 output_file << " " << this->time_out_value << std::flush;
                 output_file << " " << octmib_results.mib_limit_value  << std::flush;
+                output_file << " " << octmib_results.num_dup_filter_lookups << std::flush;
+                output_file << " " << octmib_results.num_dup_table_lookups << std::flush;
+                output_file << " " << num_mis_cache_lookups() << std::flush;
+                output_file << " " << num_mis_cache_hits() << std::flush;
                 output_file << std::endl;
                 break;
             case 't':
@@ -307,6 +402,8 @@ struct OutputHandler {
                 output_file << " " << this->num_vertices << std::flush;
                 output_file << " " << this->time_out_value << std::flush;
                 output_file << " " << octmibii_results.mib_limit_value  << std::flush;
+                output_file << " " << num_mis_cache_lookups() << std::flush;
+                output_file << " " << num_mis_cache_hits() << std::flush;
                 output_file << std::endl;
                 break;
             case 'l':
@@ -369,11 +466,113 @@ int main(int argc, char ** argv) {
     std::string oct_file_path;
     bool help_flag = false;
     bool count_only_mode = false;
+    size_t num_threads = 1;
+    bool deterministic_mode = false;
+    size_t mis_cache_mb = 64;
+    size_t max_frontier_mb = 0;
+    SizeConstraints size_constraints;
+    OCTSearchOptions oct_search;
+    std::string oct_cache_path;
+    bool oct_cache_flag = true;
+
+    // Long-only options are given codes outside the range of short options
+    enum { MIN_LEFT_OPT = 256, MIN_RIGHT_OPT, MAX_LEFT_OPT, MAX_RIGHT_OPT,
+           SAMPLES_OPT, SEED_OPT, DETERMINISTIC_OPT, MIS_CACHE_OPT,
+           MAX_FRONTIER_OPT, OCT_SEARCH_OPT, OCT_RESTARTS_OPT, OCT_EXACT_OPT,
+           OCT_PORTFOLIO_OPT, OCT_CACHE_OPT, NO_OCT_CACHE_OPT };
+    static struct option long_options[] = {
+        {"min-left", required_argument, nullptr, MIN_LEFT_OPT},
+        {"min-right", required_argument, nullptr, MIN_RIGHT_OPT},
+        {"max-left", required_argument, nullptr, MAX_LEFT_OPT},
+        {"max-right", required_argument, nullptr, MAX_RIGHT_OPT},
+        {"samples", required_argument, nullptr, SAMPLES_OPT},
+        {"seed", required_argument, nullptr, SEED_OPT},
+        {"deterministic", no_argument, nullptr, DETERMINISTIC_OPT},
+        {"mis-cache-mb", required_argument, nullptr, MIS_CACHE_OPT},
+        {"max-frontier-mb", required_argument, nullptr, MAX_FRONTIER_OPT},
+        {"oct-search", required_argument, nullptr, OCT_SEARCH_OPT},
+        {"oct-restarts", required_argument, nullptr, OCT_RESTARTS_OPT},
+        {"oct-exact", required_argument, nullptr, OCT_EXACT_OPT},
+        {"oct-portfolio", required_argument, nullptr, OCT_PORTFOLIO_OPT},
+        {"oct-cache", required_argument, nullptr, OCT_CACHE_OPT},
+        {"no-oct-cache", no_argument, nullptr, NO_OCT_CACHE_OPT},
+        {nullptr, 0, nullptr, 0}
+    };
+
     int arg_counter;
-    while( ( arg_counter = getopt (argc, argv, "a:i:o:l:hp:ct:m:") ) != -1 )
+    while( ( arg_counter = getopt_long (argc, argv, "a:i:o:l:hp:ct:m:j:", long_options, nullptr) ) != -1 )
     {
         switch(arg_counter)
         {
+            case MIN_LEFT_OPT:
+                if(optarg) size_constraints.min_left = atol(optarg);
+                std::cout << "# Requiring at least " << size_constraints.min_left;
+                std::cout << " vertices on one side." << std::endl;
+                break;
+            case MIN_RIGHT_OPT:
+                if(optarg) size_constraints.min_right = atol(optarg);
+                std::cout << "# Requiring at least " << size_constraints.min_right;
+                std::cout << " vertices on the other side." << std::endl;
+                break;
+            case MAX_LEFT_OPT:
+                if(optarg) size_constraints.max_left = atol(optarg);
+                std::cout << "# Requiring at most " << size_constraints.max_left;
+                std::cout << " vertices on one side." << std::endl;
+                break;
+            case MAX_RIGHT_OPT:
+                if(optarg) size_constraints.max_right = atol(optarg);
+                std::cout << "# Requiring at most " << size_constraints.max_right;
+                std::cout << " vertices on the other side." << std::endl;
+                break;
+            case SAMPLES_OPT:
+                if(optarg) output_tracker.sample_results.num_samples = atol(optarg);
+                output_tracker.sampling_mode = true;
+                std::cout << "# Sampling MIBs with " << output_tracker.sample_results.num_samples;
+                std::cout << " random descents." << std::endl;
+                break;
+            case SEED_OPT:
+                if(optarg) output_tracker.sample_results.seed = strtoul(optarg, nullptr, 10);
+                oct_search.seed = output_tracker.sample_results.seed;
+                std::cout << "# Random seed: " << output_tracker.sample_results.seed << std::endl;
+                break;
+            case DETERMINISTIC_OPT:
+                deterministic_mode = true;
+                std::cout << "# Deterministic output order." << std::endl;
+                break;
+            case MIS_CACHE_OPT:
+                if(optarg) mis_cache_mb = atol(optarg);
+                std::cout << "# MIS cache budget: " << mis_cache_mb << " MB." << std::endl;
+                break;
+            case MAX_FRONTIER_OPT:
+                if(optarg) max_frontier_mb = atol(optarg);
+                std::cout << "# Search tree frontier bound: " << max_frontier_mb << " MB." << std::endl;
+                break;
+            case OCT_SEARCH_OPT:
+                if(optarg) oct_search.time_budget = atof(optarg);
+                std::cout << "# OCT local search budget: " << oct_search.time_budget;
+                std::cout << " seconds." << std::endl;
+                break;
+            case OCT_RESTARTS_OPT:
+                if(optarg) oct_search.num_restarts = atol(optarg);
+                std::cout << "# OCT local search restarts: " << oct_search.num_restarts << std::endl;
+                break;
+            case OCT_EXACT_OPT:
+                if(optarg) oct_search.exact_time_cap = atof(optarg);
+                std::cout << "# Exact OCT time cap: " << oct_search.exact_time_cap;
+                std::cout << " seconds." << std::endl;
+                break;
+            case OCT_PORTFOLIO_OPT:
+                if(optarg) oct_search.portfolio_starts = atol(optarg);
+                std::cout << "# OCT portfolio starts: " << oct_search.portfolio_starts << std::endl;
+                break;
+            case OCT_CACHE_OPT:
+                if(optarg) oct_cache_path = optarg;
+                std::cout << "# OCT decomposition cache: " << oct_cache_path << std::endl;
+                break;
+            case NO_OCT_CACHE_OPT:
+                oct_cache_flag = false;
+                std::cout << "# No OCT decomposition cache." << std::endl;
+                break;
             case 'h':
                 help_flag = true;
                 break;
@@ -406,6 +605,11 @@ int main(int argc, char ** argv) {
                 std::cout <<  "# Running with timeout: " << output_tracker.time_out_value << " seconds.";
                 std::cout << std::endl;
                 break;
+            case 'j':
+                if(optarg) num_threads = atol(optarg);
+                std::cout << "# Running with " << num_threads;
+                std::cout << " threads." << std::endl;
+                break;
             case 'm':
                 if(optarg) {
                     output_tracker.octmib_results.mib_limit_value = atol(optarg);
@@ -423,7 +627,13 @@ int main(int argc, char ** argv) {
         std::cout << "[-o PATH_TO_OCT_FILE] ";
         std::cout << "[-l PATH_TO_LOG_FILE] [-h] [-c] ";
         std::cout << "[-p PATH_TO_MIBS_FILE] ";
-        std::cout << "[-t TIME_OUT_VALUE]" << std::endl;
+        std::cout << "[-t TIME_OUT_VALUE] [-j NUM_THREADS] ";
+        std::cout << "[--min-left S] [--min-right T] ";
+        std::cout << "[--max-left S] [--max-right T] ";
+        std::cout << "[--samples N] [--seed S] [--deterministic] ";
+        std::cout << "[--mis-cache-mb M] [--max-frontier-mb M] ";
+        std::cout << "[--oct-search S] [--oct-restarts N] [--oct-exact S] ";
+        std::cout << "[--oct-portfolio N] [--oct-cache PATH] [--no-oct-cache]" << std::endl;
 
         std::cout << "Bicliques algorithms suite.\n\n";
         std::cout << "required arguments:\n";
@@ -439,7 +649,40 @@ int main(int argc, char ** argv) {
         std::cout << "\t                      Note: this option leaves the internal array of MIBs empty.\n";
         std::cout << "\t-c                    count only mode; MIBs not stored or written to file.\n";
         std::cout << "\t-t                    timeout in seconds to allow program to run.\n";
-        std::cout << "\t-m                    terminate if this many MIBs are found.";
+        std::cout << "\t-m                    terminate if this many MIBs are found.\n";
+        std::cout << "\t-j                    number of threads to use (default 1); connected\n";
+        std::cout << "\t                      components run concurrently, and OCT-MIB also\n";
+        std::cout << "\t                      splits a single component over the threads.\n";
+        std::cout << "\t--min-left, --min-right\n";
+        std::cout << "\t                      only report MIBs with at least this many vertices\n";
+        std::cout << "\t                      on one side (resp. the other side); prunes the search.\n";
+        std::cout << "\t--max-left, --max-right\n";
+        std::cout << "\t                      only report MIBs with at most this many vertices\n";
+        std::cout << "\t                      on one side (resp. the other side).\n";
+        std::cout << "\t--samples             with -a o, draw this many random descents through the\n";
+        std::cout << "\t                      OCT-MIB search forest instead of enumerating; MIBs are\n";
+        std::cout << "\t                      reported with weights summing to an estimate of the count.\n";
+        std::cout << "\t--seed                seed for --samples and --oct-search (default 0).\n";
+        std::cout << "\t--deterministic       with -j, output MIBs in the same order as one thread.\n";
+        std::cout << "\t--mis-cache-mb        memory budget in MB for reusing the maximal independent\n";
+        std::cout << "\t                      sets of neighborhoods (default 64; 0 disables).\n";
+        std::cout << "\t--max-frontier-mb     once the bags waiting in a search tree hold more than\n";
+        std::cout << "\t                      this many MB, expand bags one child at a time\n";
+        std::cout << "\t                      (default 0, no bound).\n";
+        std::cout << "\t--oct-search          with -a o, i or t and no -o, shrink the OCT set of each\n";
+        std::cout << "\t                      component by local search for up to this many\n";
+        std::cout << "\t                      seconds (default 0, the greedy coloring only).\n";
+        std::cout << "\t--oct-restarts        number of starting colorings for --oct-search (default 16).\n";
+        std::cout << "\t--oct-exact           then search for a minimum OCT set of each component\n";
+        std::cout << "\t                      for up to this many seconds, keeping the one found\n";
+        std::cout << "\t                      so far if time runs out (default 0, no exact search).\n";
+        std::cout << "\t--oct-portfolio       instead of --oct-restarts, keep the best of this many\n";
+        std::cout << "\t                      randomized colorings, each searched locally within\n";
+        std::cout << "\t                      --oct-search, run on the -j threads (default 0, off).\n";
+        std::cout << "\t--oct-cache           with -a o, i or t and no -o, reuse the OCT decomposition\n";
+        std::cout << "\t                      kept in this file for the same graph and --oct-* options,\n";
+        std::cout << "\t                      or write it there (default PATH_TO_INPUT_FILE.octcache).\n";
+        std::cout << "\t--no-oct-cache        neither read nor write an OCT decomposition cache.";
         std::cout << std::endl;
         return 1;
     }
@@ -465,6 +708,14 @@ int main(int argc, char ** argv) {
         return error;
     }
 
+    // Sampling walks the OCT-MIB search forest, so only OCT-MIB samples
+    if (output_tracker.sampling_mode && output_tracker.which_algorithm != "o") {
+        std::cout << "ERROR::BICLIQUES --samples requires -a o, not -a ";
+        std::cout << output_tracker.which_algorithm << std::endl;
+        error = 0;
+        return error;
+    }
+
     // Check for input graph
     Graph input_g(0);
     if (output_tracker.input_file_path==std::string("")) {
@@ -508,6 +759,56 @@ int main(int argc, char ** argv) {
         }
     }
 
+    // Size constraints are honored by every enumeration algorithm
+    output_tracker.octmib_results.size_constraints = size_constraints;
+    output_tracker.octmibii_results.size_constraints = size_constraints;
+    output_tracker.mica_results.size_constraints = size_constraints;
+    output_tracker.octmica_results.size_constraints = size_constraints;
+    output_tracker.lexmib_results.size_constraints = size_constraints;
+    output_tracker.nonlexmib_results.size_constraints = size_constraints;
+    output_tracker.sample_results.size_constraints = size_constraints;
+
+    // Count-only mode applies whether or not results are printed
+    output_tracker.octmib_results.count_only_mode = count_only_mode;
+    output_tracker.octmibii_results.count_only_mode = count_only_mode;
+    output_tracker.mica_results.count_only_mode = count_only_mode;
+    output_tracker.octmica_results.count_only_mode = count_only_mode;
+    output_tracker.lexmib_results.count_only_mode = count_only_mode;
+    output_tracker.nonlexmib_results.count_only_mode = count_only_mode;
+
+    // Threading applies to every enumeration algorithm
+    output_tracker.octmib_results.num_threads = num_threads;
+    output_tracker.octmibii_results.num_threads = num_threads;
+    output_tracker.mica_results.num_threads = num_threads;
+    output_tracker.octmica_results.num_threads = num_threads;
+    output_tracker.lexmib_results.num_threads = num_threads;
+    output_tracker.nonlexmib_results.num_threads = num_threads;
+
+    output_tracker.octmib_results.deterministic_mode = deterministic_mode;
+    output_tracker.octmibii_results.deterministic_mode = deterministic_mode;
+    output_tracker.mica_results.deterministic_mode = deterministic_mode;
+    output_tracker.octmica_results.deterministic_mode = deterministic_mode;
+    output_tracker.lexmib_results.deterministic_mode = deterministic_mode;
+    output_tracker.nonlexmib_results.deterministic_mode = deterministic_mode;
+
+    // MIS of neighborhoods are cached across the whole run
+    if (mis_cache_mb > 0) {
+        output_tracker.mis_cache = std::make_shared<MISCache>(input_g, mis_cache_mb << 20);
+        output_tracker.octmib_results.mis_cache = output_tracker.mis_cache;
+        output_tracker.octmibii_results.mis_cache = output_tracker.mis_cache;
+        output_tracker.sample_results.mis_cache = output_tracker.mis_cache;
+    }
+
+    // Bound on the bags waiting in each OCT-MIB search tree
+    output_tracker.octmib_results.max_frontier_bytes = max_frontier_mb << 20;
+    output_tracker.octmibii_results.max_frontier_bytes = max_frontier_mb << 20;
+
+    // OCT decompositions computed when none is given
+    oct_search.num_threads = num_threads;
+    output_tracker.octmib_results.oct_search = oct_search;
+    output_tracker.octmibii_results.oct_search = oct_search;
+    output_tracker.octmica_results.oct_search = oct_search;
+
     // Run algorithm
     output_tracker.start_timer();
 
@@ -516,12 +817,60 @@ int main(int argc, char ** argv) {
       alarm(output_tracker.time_out_value);
     }
     output_tracker.alg_char = output_tracker.which_algorithm[0];
+
+    // With no OCT file, OCT-MIB, OCT-MIB-II and OCT-MICA decompose each
+    // component; reuse the decomposition cached for this graph, or cache it
+    std::string oct_algorithms("oit");
+    if (oct_file_path == std::string("") && oct_cache_flag &&
+        oct_algorithms.find(output_tracker.alg_char) != std::string::npos) {
+
+        if (oct_cache_path == std::string("")) {
+            oct_cache_path = output_tracker.input_file_path + ".octcache";
+        }
+        clock_t begin = std::clock();
+        std::string options_key = oct_options_key(oct_search);
+        OrderedVertexSet right_partition;
+        if (read_oct_cache(oct_cache_path, input_g, options_key, oct_set, left_partition, right_partition)) {
+            std::cout << "# Read oct decomposition from cache " << oct_cache_path << std::endl;
+        }
+        else {
+            auto vector_of_ccs = simpleccs(input_g);
+            octdecomposition_by_component(input_g, vector_of_ccs, oct_set, left_partition,
+                                          right_partition, oct_search);
+            if (!may_overwrite_oct_cache(oct_cache_path)) {
+                std::cout << "# WARNING: " << oct_cache_path << " exists and is not an oct";
+                std::cout << " decomposition cache; not overwriting it" << std::endl;
+            }
+            else if (write_oct_cache(oct_cache_path, input_g, options_key, vector_of_ccs,
+                                     oct_set, left_partition)) {
+                std::cout << "# Wrote oct decomposition to cache " << oct_cache_path << std::endl;
+            }
+            else {
+                std::cout << "# Could not write oct decomposition cache " << oct_cache_path << std::endl;
+            }
+        }
+        std::cout << "#   size " << oct_set.size() << std::endl;
+        clock_t end = std::clock();
+
+        double time_oct_decomp = double(end - begin) / CLOCKS_PER_SEC;
+        if (output_tracker.alg_char == 'o') output_tracker.octmib_results.time_oct_decomp += time_oct_decomp;
+        else if (output_tracker.alg_char == 'i') output_tracker.octmibii_results.time_oct_decomp += time_oct_decomp;
+        else output_tracker.octmica_results.time_oct_decomp += time_oct_decomp;
+    }
+
     switch (output_tracker.alg_char) {
         case 'o':  // run OCTMIB
+            if (output_tracker.sampling_mode) {
+                std::cout << "# Starting OCT-MIB sampling" << std::endl;
+                if (print_results_path!=std::string("")) {
+                    output_tracker.sample_results.turn_on_print_mode(print_results_path);
+                }
+                sample_mibs(output_tracker.sample_results, input_g, oct_set, left_partition);
+                break;
+            }
             std::cout << "# Starting algorithm OCT-MIB" << std::endl;
             if (print_results_path!=std::string("")) {
                 output_tracker.octmib_results.turn_on_print_mode(print_results_path);
-                output_tracker.octmib_results.count_only_mode = count_only_mode;
             }
             octmib(output_tracker.octmib_results, input_g, oct_set, left_partition);
             break;
@@ -530,7 +879,6 @@ int main(int argc, char ** argv) {
 		    std::cout << "# Starting algorithm OCT-MIB-II" << std::endl;
 	            if (print_results_path!=std::string("")) {
 	                output_tracker.octmibii_results.turn_on_print_mode(print_results_path);
-	                output_tracker.octmibii_results.count_only_mode = count_only_mode;
 	            }
 	            std::vector<size_t> right_nodes;
 	            auto oct_itr = oct_set.begin();
@@ -553,7 +901,6 @@ int main(int argc, char ** argv) {
             std::cout << "# Starting algorithm LexMIB" << std::endl;
             if (print_results_path!=std::string("")) {
                 output_tracker.lexmib_results.turn_on_print_mode(print_results_path);
-                output_tracker.lexmib_results.count_only_mode = count_only_mode;
             }
             lexmib(output_tracker.lexmib_results, input_g);
             break;
@@ -561,7 +908,6 @@ int main(int argc, char ** argv) {
             std::cout << "# Starting algorithm EnumMIB" << std::endl;
             if (print_results_path!=std::string("")) {
                 output_tracker.nonlexmib_results.turn_on_print_mode(print_results_path);
-                output_tracker.nonlexmib_results.count_only_mode = count_only_mode;
             }
             enummib(output_tracker.nonlexmib_results, input_g);
             break;
@@ -584,7 +930,6 @@ int main(int argc, char ** argv) {
 	        	std::cout << "# Starting algorithm MICA" << std::endl;
 	        	if (print_results_path!=std::string("")) {
 	        		output_tracker.mica_results.turn_on_print_mode(print_results_path);
-	        	    output_tracker.mica_results.count_only_mode = count_only_mode;
 	        	}
 	        	mica(output_tracker.mica_results, input_g);
 		}
@@ -594,7 +939,6 @@ int main(int argc, char ** argv) {
             std::cout << "# Starting algorithm OCT-MICA" << std::endl;
             if (print_results_path!=std::string("")) {
                 output_tracker.octmica_results.turn_on_print_mode(print_results_path);
-                output_tracker.octmica_results.count_only_mode = count_only_mode;
             }
             std::vector<size_t> right_nodes;
             auto oct_itr = oct_set.begin();
@@ -618,6 +962,10 @@ int main(int argc, char ** argv) {
     output_tracker.successful_termination = true;
     output_tracker.stop_timer();  // time saved in output_tracker.elapsed_time
 
+    output_tracker.print_throughput();
+    output_tracker.print_mis_cache_stats();
+    output_tracker.print_frontier_stats();
+
 
 
     // OUTPUT STATS
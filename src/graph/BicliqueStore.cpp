@@ -0,0 +1,236 @@
+/**
+ * BicliqueStore records bicliques, so that the closure-based algorithms
+ * (MICA, OCT-MICA and OCT-MIB-II) can tell whether one has been found before.
+ *
+ * A biclique is the same whichever way round its sides are, so it is kept
+ * with the lexicographically smaller side first, as BicliqueLite::operator<
+ * compares them; a lookup needs only one probe for both orientations. Each
+ * biclique is hashed to 32 bits over its sides in that order. The table is
+ * open-addressing with linear probing, and each slot holds only the hash and
+ * the index of an entry; the vertices of every entry are copied into one
+ * array of 32-bit labels. A probe compares vertices only when the hash of a
+ * slot matches. The table is kept at most half full, doubling as needed.
+ *
+ * contains does not modify the store, so several threads may call it at
+ * once, provided none is inserting. A store built with more than one shard
+ * may be used from several threads at once: bicliques are split over the
+ * shards by hash, and each shard has its own table and lock.
+ *
+ * @authors Eric Horton, Kyle Kloster, Drew van der Poel
+ *
+ * This file is part of MI-bicliques, https://github.com/TheoryInPractice/MI-bicliques,
+ * and is Copyright (C) North Carolina State University, 2018.
+ * It is licensed under the three-clause BSD license; see LICENSE.
+ */
+
+#include <algorithm> // for std::equal
+#include "BicliqueStore.h"
+
+
+namespace {
+
+const size_t MIN_SLOTS = 16;
+
+// Sides of b, the lexicographically smaller first
+void canonical_sides(const BicliqueLite & b,
+                     const std::vector<size_t> * & first,
+                     const std::vector<size_t> * & second) {
+    first = &b.get_left();
+    second = &b.get_right();
+    if (*second < *first) std::swap(first, second);
+}
+
+uint64_t mix(uint64_t hash) {
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+uint32_t hash_sides(const std::vector<size_t> & first, const std::vector<size_t> & second) {
+    uint64_t hash = mix(first.size() * 0x9e3779b97f4a7c15ULL + second.size());
+    for (size_t v : first) hash = (hash ^ v) * 0x100000001b3ULL;
+    hash = mix(hash);
+    for (size_t v : second) hash = (hash ^ v) * 0x100000001b3ULL;
+    hash = mix(hash);
+    return uint32_t(hash ^ (hash >> 32));
+}
+
+}
+
+
+/**
+ * Construct an empty store with room for `expected_num_entries`. With
+ * `num_shards` > 1 the store is safe to use from several threads.
+ */
+BicliqueStore::BicliqueStore(size_t expected_num_entries, size_t num_shards) {
+
+    if (num_shards == 0) num_shards = 1;
+
+    for (size_t idx = 0; idx < num_shards; idx++) {
+        shards.push_back(std::unique_ptr<Shard>(new Shard()));
+        shards.back()->rehash(MIN_SLOTS);
+        shards.back()->reserve(expected_num_entries/num_shards);
+    }
+
+}
+
+
+/**
+ * Make room for `expected_num_entries` without growing the table. Not safe
+ * to call while other threads use the store.
+ */
+void BicliqueStore::reserve(size_t expected_num_entries) {
+    for (auto & shard : shards) shard->reserve(expected_num_entries/shards.size());
+}
+
+
+/**
+ * Add b to the store.
+ *
+ * @return True if b was not already in the store, either way round.
+ */
+bool BicliqueStore::insert(const BicliqueLite & b) {
+
+    const std::vector<size_t> * first, * second;
+    canonical_sides(b, first, second);
+    uint32_t tag = hash_sides(*first, *second);
+    Shard & shard = get_shard(tag);
+
+    std::unique_lock<std::mutex> lock(shard.mutex, std::defer_lock);
+    if (shards.size() > 1) lock.lock();
+
+    size_t slot = shard.find_slot(tag, *first, *second);
+    if (shard.slots[slot].entry_plus_one != 0) return false;
+
+    Entry entry;
+    entry.offset = shard.vertices.size();
+    entry.first_size = uint32_t(first->size());
+    entry.second_size = uint32_t(second->size());
+    shard.vertices.insert(shard.vertices.end(), first->begin(), first->end());
+    shard.vertices.insert(shard.vertices.end(), second->begin(), second->end());
+    shard.entries.push_back(entry);
+
+    shard.slots[slot].tag = tag;
+    shard.slots[slot].entry_plus_one = uint32_t(shard.entries.size());
+    if (2*shard.entries.size() > shard.slots.size()) shard.rehash(2*shard.slots.size());
+    return true;
+
+}
+
+
+/**
+ * Check whether b is in the store, either way round.
+ */
+bool BicliqueStore::contains(const BicliqueLite & b) const {
+
+    const std::vector<size_t> * first, * second;
+    canonical_sides(b, first, second);
+    uint32_t tag = hash_sides(*first, *second);
+    const Shard & shard = get_shard(tag);
+
+    std::unique_lock<std::mutex> lock(shard.mutex, std::defer_lock);
+    if (shards.size() > 1) lock.lock();
+
+    size_t slot = shard.find_slot(tag, *first, *second);
+    return shard.slots[slot].entry_plus_one != 0;
+
+}
+
+
+size_t BicliqueStore::size() const {
+
+    size_t total = 0;
+    for (auto & shard : shards) total += shard->entries.size();
+    return total;
+
+}
+
+
+/**
+ * Approximate number of bytes held by the tables, entries and vertices.
+ */
+size_t BicliqueStore::get_memory_usage() const {
+
+    size_t bytes = 0;
+    for (auto & shard : shards) {
+        bytes += shard->slots.capacity()*sizeof(Slot) + shard->entries.capacity()*sizeof(Entry) +
+                 shard->vertices.capacity()*sizeof(uint32_t);
+    }
+    return bytes;
+
+}
+
+
+/**
+ * Shards are chosen by the high bits of the hash, and slots within a shard
+ * by its low bits.
+ */
+BicliqueStore::Shard & BicliqueStore::get_shard(uint32_t tag) const {
+
+    if (shards.size() == 1) return *shards.front();
+    return *shards[(uint64_t(tag)*shards.size()) >> 32];
+
+}
+
+
+/**
+ * The slot holding the biclique with these sides, or the empty slot where it
+ * would go.
+ */
+size_t BicliqueStore::Shard::find_slot(uint32_t tag,
+                                       const std::vector<size_t> & first,
+                                       const std::vector<size_t> & second) const {
+
+    size_t mask = slots.size() - 1;
+    for (size_t slot = tag & mask; ; slot = (slot + 1) & mask) {
+        const Slot & s = slots[slot];
+        if (s.entry_plus_one == 0) return slot;
+        if (s.tag == tag && entry_equals(entries[s.entry_plus_one - 1], first, second)) {
+            return slot;
+        }
+    }
+
+}
+
+
+bool BicliqueStore::Shard::entry_equals(const Entry & entry,
+                                        const std::vector<size_t> & first,
+                                        const std::vector<size_t> & second) const {
+
+    if (entry.first_size != first.size() || entry.second_size != second.size()) return false;
+    const uint32_t * stored = vertices.data() + entry.offset;
+    return std::equal(first.begin(), first.end(), stored) &&
+           std::equal(second.begin(), second.end(), stored + entry.first_size);
+
+}
+
+
+void BicliqueStore::Shard::reserve(size_t expected_num_entries) {
+    size_t num_slots = slots.size();
+    while (num_slots < 2*expected_num_entries) num_slots *= 2;
+    if (num_slots > slots.size()) rehash(num_slots);
+    entries.reserve(expected_num_entries);
+}
+
+
+/**
+ * Move every entry into a table of num_slots slots, a power of two. Slots
+ * keep the whole hash, so no biclique is hashed again.
+ */
+void BicliqueStore::Shard::rehash(size_t num_slots) {
+
+    std::vector<Slot> old_slots(num_slots);
+    old_slots.swap(slots);
+
+    size_t mask = num_slots - 1;
+    for (const Slot & s : old_slots) {
+        if (s.entry_plus_one == 0) continue;
+        size_t slot = s.tag & mask;
+        while (slots[slot].entry_plus_one != 0) slot = (slot + 1) & mask;
+        slots[slot] = s;
+    }
+
+}
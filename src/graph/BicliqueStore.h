@@ -0,0 +1,72 @@
+/**
+ * BicliqueStore is a set of bicliques, kept in an open-addressing hash table
+ * over a compact copy of their vertices, and optionally split into locked
+ * shards. See BicliqueStore.cpp for full documentation.
+ *
+ * @authors Eric Horton, Kyle Kloster, Drew van der Poel
+ *
+ * This file is part of MI-bicliques, https://github.com/TheoryInPractice/MI-bicliques,
+ * and is Copyright (C) North Carolina State University, 2018.
+ * It is licensed under the three-clause BSD license; see LICENSE.
+ */
+
+#ifndef BICLIQUES_BICLIQUESTORE_H
+#define BICLIQUES_BICLIQUESTORE_H
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "BicliqueLite.h"
+#include "stddef.h"  // apparently required for size_t
+
+class BicliqueStore {
+
+public:
+    BicliqueStore(size_t expected_num_entries = 0, size_t num_shards = 1);
+
+    void reserve(size_t expected_num_entries);
+    bool insert(const BicliqueLite & b);
+    bool contains(const BicliqueLite & b) const;
+
+    size_t size() const;
+    size_t get_memory_usage() const;
+
+private:
+    // A slot is empty if entry_plus_one is 0; tag is the biclique's hash
+    struct Slot {
+        uint32_t tag = 0;
+        uint32_t entry_plus_one = 0;
+    };
+
+    // A biclique's sides, first the lexicographically smaller, in vertices
+    struct Entry {
+        uint64_t offset;
+        uint32_t first_size;
+        uint32_t second_size;
+    };
+
+    struct Shard {
+        mutable std::mutex mutex;
+        std::vector<Slot> slots;
+        std::vector<Entry> entries;
+        std::vector<uint32_t> vertices;
+
+        size_t find_slot(uint32_t tag,
+                         const std::vector<size_t> & first,
+                         const std::vector<size_t> & second) const;
+        bool entry_equals(const Entry & entry,
+                          const std::vector<size_t> & first,
+                          const std::vector<size_t> & second) const;
+        void reserve(size_t expected_num_entries);
+        void rehash(size_t num_slots);
+    };
+
+    std::vector<std::unique_ptr<Shard>> shards;
+
+    Shard & get_shard(uint32_t tag) const;
+
+};
+
+
+#endif //BICLIQUES_BICLIQUESTORE_H
@@ -4,6 +4,20 @@
  * maximality of its underlying Biclique. When ready, the Biclique may be built
  * from the blueprint.
  *
+ * The search trees expand every blueprint of a bag on every vertex of its
+ * iterative_wait, and most expansions fail. Expanding into a separate
+ * blueprint (see expand) leaves the original untouched, so it need not be
+ * copied first; the caller keeps one blueprint to expand into, whose storage
+ * is reused from one expansion to the next, and copies it into a bag only on
+ * success. Bans are kept as a bitset over the positions of iterative_wait,
+ * which the search trees ban and test by position; a blueprint expanded on v
+ * keeps the bits of the vertices of iterative_wait after v, which form the
+ * iterative_wait of its bag.
+ *
+ * The iterative sets are the same for every blueprint of a bag, so the bag
+ * holds them (see IterativeSets) and passes them to the methods that need
+ * them; a blueprint moved into another bag need not be updated.
+ *
  * @authors Eric Horton, Kyle Kloster, Drew van der Poel
  *
  * This file is part of MI-bicliques, https://github.com/TheoryInPractice/MI-bicliques,
@@ -12,45 +26,108 @@
  */
 
 // Include BlueprintLite header
+#include <algorithm> // for std::lower_bound, std::find
 #include "BlueprintLite.h"
 
 
 
+/**
+ * Construct an empty blueprint, to be filled in by expand.
+ */
+BlueprintLite::BlueprintLite() : next_future_maximal(0), id(0) {
+
+}
+
+
+/**
+ * Construct an empty blueprint whose sets are allocated with alloc.
+ */
+BlueprintLite::BlueprintLite(const allocator_type & alloc) :
+                             next_future_maximal(0),
+                             id(0),
+                             completely_connected_in(alloc),
+                             completely_connected_out(alloc),
+                             independent_from_in(alloc),
+                             independent_from_out(alloc),
+                             oct_auxiliary_independent_set(alloc),
+                             ban_bits(alloc),
+                             other_bans(alloc) {
+
+}
+
+
+/**
+ * Copy other into a blueprint whose sets are allocated with alloc.
+ */
+BlueprintLite::BlueprintLite(const BlueprintLite & other, const allocator_type & alloc) :
+                             next_future_maximal(other.next_future_maximal),
+                             id(other.id),
+                             graph(other.graph),
+                             completely_connected_in(other.completely_connected_in, alloc),
+                             completely_connected_out(other.completely_connected_out, alloc),
+                             independent_from_in(other.independent_from_in, alloc),
+                             independent_from_out(other.independent_from_out, alloc),
+                             oct_auxiliary_independent_set(other.oct_auxiliary_independent_set, alloc),
+                             ban_bits(other.ban_bits, alloc),
+                             other_bans(other.other_bans, alloc) {
+
+}
+
+
+/**
+ * Move other into a blueprint whose sets are allocated with alloc; the sets
+ * are copied if other's were allocated elsewhere.
+ */
+BlueprintLite::BlueprintLite(BlueprintLite && other, const allocator_type & alloc) :
+                             next_future_maximal(other.next_future_maximal),
+                             id(other.id),
+                             graph(std::move(other.graph)),
+                             completely_connected_in(std::move(other.completely_connected_in), alloc),
+                             completely_connected_out(std::move(other.completely_connected_out), alloc),
+                             independent_from_in(std::move(other.independent_from_in), alloc),
+                             independent_from_out(std::move(other.independent_from_out), alloc),
+                             oct_auxiliary_independent_set(std::move(other.oct_auxiliary_independent_set), alloc),
+                             ban_bits(std::move(other.ban_bits), alloc),
+                             other_bans(std::move(other.other_bans), alloc) {
+
+}
+
+
 /**
  * Construct a new BicliqueBlueprint.
  *
  * @param id                            An identifier for the BicliqueBlueprint used for tracking related blueprints.
  * @param graph                         Pointer to the graph instance Bicliques live in.
- * @param iterative_in                  Vertices which are currently in the Biclique.
- * @param iterative_past                Vertices which have already been under consideration for being in the Biclique.
- * @param iterative_wait                Vertices which have not yet been expanded upon.
  * @param completely_connected_in       Vertices in the Biclique which are completely connected to iterative_in.
  * @param completely_connected_out      Vertices not in the Biclique which are completely connected to iterative_in.
  * @param independent_from_in           Vertices in the Biclique which are completely independent from iterative_in.
  * @param independent_from_out          Vertices not in the Biclique which are completely independent from iterative_in.
  * @param oct_auxiliary_independent_set
+ * @param alloc                         Allocator for the sets of the blueprint.
  */
 BlueprintLite::BlueprintLite(size_t id,
                              std::shared_ptr<Graph> graph,
-                             std::shared_ptr<std::vector<size_t>> iterative_wait,
-                             std::shared_ptr<OrderedVertexSet> iterative_in,
-                             std::shared_ptr<std::vector<size_t>> iterative_past,
                              std::vector<size_t> completely_connected_in,
                              std::vector<size_t> completely_connected_out,
                              std::vector<size_t> independent_from_in,
                              std::vector<size_t> independent_from_out,
-                             std::vector<size_t> oct_auxiliary_independent_set
+                             std::vector<size_t> oct_auxiliary_independent_set,
+                             const allocator_type & alloc
                              ) :
                              id(id),
                              graph(graph),
-                             iter_wait(iterative_wait),
-                             iter_in(iterative_in),
-                             iter_past(iterative_past),
-                             completely_connected_in(completely_connected_in),
-                             completely_connected_out(completely_connected_out),
-                             independent_from_in(independent_from_in),
-                             independent_from_out(independent_from_out),
-                             oct_auxiliary_independent_set(oct_auxiliary_independent_set){
+                             completely_connected_in(completely_connected_in.begin(),
+                                                     completely_connected_in.end(), alloc),
+                             completely_connected_out(completely_connected_out.begin(),
+                                                      completely_connected_out.end(), alloc),
+                             independent_from_in(independent_from_in.begin(),
+                                                 independent_from_in.end(), alloc),
+                             independent_from_out(independent_from_out.begin(),
+                                                  independent_from_out.end(), alloc),
+                             oct_auxiliary_independent_set(oct_auxiliary_independent_set.begin(),
+                                                           oct_auxiliary_independent_set.end(), alloc),
+                             ban_bits(alloc),
+                             other_bans(alloc) {
 
     this->next_future_maximal = this->get_last_vertex();
 
@@ -63,11 +140,14 @@ BlueprintLite::BlueprintLite(size_t id,
  * of `iterative_in` and `independent_from_in`. The right side of the Biclique
  * is formed from `completely_connected_in`.
  *
+ * @param  iterative Iterative sets of the bag holding the blueprint.
  * @return Biclique built from the current state of the BicliqueBlueprint.
  */
-BicliqueLite BlueprintLite::get_biclique() {
+BicliqueLite BlueprintLite::get_biclique(const IterativeSets & iterative) const {
 
-    return BicliqueLite( vector_union(iter_in->get_vertices(), independent_from_in), completely_connected_in);
+    return BicliqueLite(vector_union(iterative.get_in(), independent_from_in),
+                        std::vector<size_t>(completely_connected_in.begin(),
+                                            completely_connected_in.end()));
 
 }
 
@@ -78,9 +158,9 @@ BicliqueLite BlueprintLite::get_biclique() {
  *
  * @return Current Biclique's string representation.
  */
-std::string BlueprintLite::get_biclique_string() {
+std::string BlueprintLite::get_biclique_string(const IterativeSets & iterative) const {
 
-    std::vector<size_t> temp = vector_union(iter_in->get_vertices(), independent_from_in);
+    std::vector<size_t> temp = vector_union(iterative.get_in(), independent_from_in);
     std::vector<size_t> dummy = vector_union(temp, completely_connected_in);
     return vector_to_string(dummy);
 
@@ -98,7 +178,10 @@ std::string BlueprintLite::get_biclique_string() {
  */
 BicliqueLite BlueprintLite::get_partial_biclique() {
 
-    return BicliqueLite(independent_from_in, completely_connected_in);
+    return BicliqueLite(std::vector<size_t>(independent_from_in.begin(),
+                                            independent_from_in.end()),
+                        std::vector<size_t>(completely_connected_in.begin(),
+                                            completely_connected_in.end()));
 
 }
 
@@ -154,49 +237,66 @@ bool BlueprintLite::can_be_added_right(const T &s) const {
  *
  * @return True if the Biclique is currently maximal.
  */
-bool BlueprintLite::is_currently_maximal() {
+bool BlueprintLite::is_currently_maximal(const IterativeSets & iterative) const {
 
-    return (!can_be_added_left(*iter_wait) && !can_be_added_left(oct_auxiliary_independent_set));
+    return (!can_be_added_left(iterative.get_wait()) && !can_be_added_left(oct_auxiliary_independent_set));
 
 }
 /**
  * Overload funtion is_currently_maximal() so that we can get next future
  * maximal vertex in the case that is_currently_maximal outputs false.
  */
-bool BlueprintLite::is_currently_maximal(size_t & next_future_max_vert) {
+bool BlueprintLite::is_currently_maximal(const IterativeSets & iterative,
+                                         size_t & next_future_max_vert) const {
+
+    return (!can_be_added_left(iterative.get_wait(), next_future_max_vert) &&
+            !can_be_added_left(oct_auxiliary_independent_set));
+
+}
+
+
+/**
+ * Position of v in iterative_wait, or iterative_wait's size if v is not in it.
+ */
+size_t BlueprintLite::wait_position(const IterativeSets & iterative, const size_t v) const {
 
-    return (!can_be_added_left(*iter_wait, next_future_max_vert) && !can_be_added_left(oct_auxiliary_independent_set));
+    IterativeSets::Slice wait = iterative.get_wait();
+    auto itr = std::lower_bound(wait.begin(), wait.end(), v);
+    if (itr != wait.end() && *itr == v) return itr - wait.begin();
+    return wait.size();
 
 }
 
 
 /**
  * Check to see if a vertex has been banned in the BicliqueBlueprint.
- * This defaults to false if not in the map of banned vertices.
- * If there is a status for v in the map, it is returned.
  *
- * @param  v Vertex to return a banned status for.
- * @return   True if `v` is currently banned, false if not.
+ * @param  iterative Iterative sets of the bag holding the blueprint.
+ * @param  v         Vertex to return a banned status for.
+ * @return           True if `v` is currently banned, false if not.
  */
-bool BlueprintLite::is_banned(const size_t v) const {
+bool BlueprintLite::is_banned(const IterativeSets & iterative, const size_t v) const {
 
-    if (ban_list.find(v) != ban_list.end()) {
-        return true;  // assumes ban_list[v] is true iff v in ban_list
-    }
-    return false;
+    size_t position = wait_position(iterative, v);
+    if (position < iterative.get_wait().size()) return is_banned_at(position);
+    return std::find(other_bans.begin(), other_bans.end(), v) != other_bans.end();
 
 }
 
 
 /**
- * Add a vertex to a BicliqueBlueprint's ban_list. This returns false if
- * the vertex is already in the ban_list.
- * @param  v Vertex to add to the ban_list.
- * @return   True if `v` was not already banned, false if it was.
+ * Ban a vertex in this BicliqueBlueprint.
+ * @param  iterative Iterative sets of the bag holding the blueprint.
+ * @param  v         Vertex to ban.
+ * @return           True.
  */
-bool BlueprintLite::ban_vertex(const size_t v) {
-    ban_list[v] = true;
+bool BlueprintLite::ban_vertex(const IterativeSets & iterative, const size_t v) {
+
+    size_t position = wait_position(iterative, v);
+    if (position < iterative.get_wait().size()) ban_at(position);
+    else if (!is_banned(iterative, v)) other_bans.push_back(v);
     return true;
+
 }
 
 
@@ -204,7 +304,8 @@ bool BlueprintLite::ban_vertex(const size_t v) {
  * Expand accepts a vertex v and a previously generated Biclique_Blueprint.
  * V is added to iterative_in, and the remaining sets are updated to remain
  * consistent with the change to iterative_in.
- * WARNING: changes to the iterative sets happen externally, in SearchTreeBag
+ * WARNING: changes to the iterative sets happen externally, in SearchTreeBag;
+ * `iterative` holds the sets of the bag being expanded, before v is added.
  *
  *
  * Expansion Procedure
@@ -255,156 +356,227 @@ bool BlueprintLite::ban_vertex(const size_t v) {
  * - If a vertex u from independent_from_out passes the check can_be_added_left or a vertex w
  * from completely_connected_from_out passes the check can_be_added_right,
  * then discontinue the expansion.
+ *
+ * Size-constraint conditions (only when size_constraints is active):
+ * - completely_connected_in only shrinks, both in descendants of the "expanded-to" blueprint
+ * and in blueprints expanded from wait_front first. If it is smaller than either side's lower
+ * bound, ban v exactly as for an empty completely_connected_in.
+ * - The left side of any descendant lies within iterative_in, v, independent_from_in and the
+ * nodes of iterative_wait after v. If those bounds cannot meet the constraints, discontinue.
  */
-ExpansionResult BlueprintLite::expand(const size_t expanded_vertex,
-                                      const std::unordered_map<std::string, bool> & duplicates_list
+ExpansionResult BlueprintLite::expand(const IterativeSets & iterative,
+                                      const size_t expanded_vertex,
+                                      const std::unordered_map<std::string, bool> & duplicates_list,
+                                      const SizeConstraints & size_constraints
                                   ) {
 
+    BlueprintLite expanded;
+    ExpansionResult expand_result = expand(iterative, expanded_vertex, duplicates_list,
+                                           size_constraints, expanded);
+    if (expand_result.get_return_type() == ExpansionResult::RETURN_TYPE::SUCCESS) {
+        *this = std::move(expanded);
+    }
+    return expand_result;
+
+}
+
+
+/**
+ * Expand this blueprint on expanded_vertex into `expanded`, leaving this
+ * blueprint unchanged; see above for the procedure and return values. The
+ * id of `expanded` is always set, so that bans can be handled; its other
+ * contents are only meaningful on SUCCESS. The sets of `expanded` are
+ * overwritten in place, so a blueprint reused for many expansions allocates
+ * no memory once its vectors are large enough. Results returned after the
+ * duplicate check are marked with ExpansionResult::set_checked_duplicates.
+ */
+ExpansionResult BlueprintLite::expand(const IterativeSets & iterative,
+                                      const size_t expanded_vertex,
+                                      const std::unordered_map<std::string, bool> & duplicates_list,
+                                      const SizeConstraints & size_constraints,
+                                      BlueprintLite & expanded) const {
+
     //WARNING: the updates to the iterative sets happen externally, in
     // searchtreebag. This is called *before* the iterative sets are udpated.
 
+    expanded.id = id;
+
     // If expanded_vertex is banned, discontinue
-    if (is_banned(expanded_vertex)) {
+    IterativeSets::Slice iter_wait = iterative.get_wait();
+    size_t position = wait_position(iterative, expanded_vertex);
+    bool in_wait = position < iter_wait.size();
+    if (in_wait ? is_banned_at(position) : is_banned(iterative, expanded_vertex)) {
         return ExpansionResult(ExpansionResult::RETURN_TYPE::DISCONTINUE);
     }
 
-    // Intersect neighborhood of expanded_vertex with blueprint sets
-    const OrderedVertexSet & neighbors = graph->get_neighbors(expanded_vertex);
-    vector_intersect_neighborhood(completely_connected_in, expanded_vertex);
-    vector_intersect_neighborhood(completely_connected_out, expanded_vertex);
-    vector_minus_neighborhood(independent_from_in, expanded_vertex);
-    vector_minus_neighborhood(independent_from_out, expanded_vertex);
+    if (expanded.graph != graph) expanded.graph = graph;
+
+    // Intersect neighborhood of expanded_vertex with blueprint sets, computing
+    // each set only once the checks before it have passed
+    vector_intersect_neighborhood(completely_connected_in, expanded_vertex,
+                                  expanded.completely_connected_in);
 
     // Start checking for failure conditions
-    if (completely_connected_in.size()==0) {
+    if (expanded.completely_connected_in.size()==0 ||
+        expanded.completely_connected_in.size() < size_constraints.min_degree()) {
         return ExpansionResult(ExpansionResult::RETURN_TYPE::BAN, expanded_vertex);
     }
 
+    vector_minus_neighborhood(independent_from_in, expanded_vertex,
+                              expanded.independent_from_in);
+
+    if (size_constraints.is_active()) {
+        size_t left_lower = iterative.get_in_size() + 1;
+        size_t left_upper = left_lower + expanded.independent_from_in.size() +
+                            (iter_wait.end() - std::upper_bound(iter_wait.begin(),
+                                                                iter_wait.end(),
+                                                                expanded_vertex));
+        if (!size_constraints.can_satisfy(left_lower, left_upper,
+                                          1, expanded.completely_connected_in.size())) {
+            return ExpansionResult(ExpansionResult::RETURN_TYPE::DISCONTINUE);
+        }
+    }
+
     // Check for duplication
-    if (duplicates_list.find(get_partial_biclique_string()) != duplicates_list.end()) {
+    if (duplicates_list.find(expanded.get_partial_biclique_string()) != duplicates_list.end()) {
         return ExpansionResult(ExpansionResult::RETURN_TYPE::DISCONTINUE);
     }
 
+    vector_intersect_neighborhood(completely_connected_out, expanded_vertex,
+                                  expanded.completely_connected_out);
+    vector_minus_neighborhood(independent_from_out, expanded_vertex,
+                              expanded.independent_from_out);
+
     // Non-relevancy check
-    if (can_be_added_left(independent_from_out) || can_be_added_right(completely_connected_out)) {
-        return ExpansionResult(ExpansionResult::RETURN_TYPE::DISCONTINUE);
+    if (expanded.can_be_added_left(expanded.independent_from_out) ||
+        expanded.can_be_added_right(expanded.completely_connected_out)) {
+        return ExpansionResult(ExpansionResult::RETURN_TYPE::DISCONTINUE).set_checked_duplicates();
     }
 
     // Future maximal check
-    if (can_be_added_left(*iter_past)) {
-        return ExpansionResult(ExpansionResult::RETURN_TYPE::BAN, expanded_vertex);
+    if (expanded.can_be_added_left(iterative.get_past())) {
+        return ExpansionResult(ExpansionResult::RETURN_TYPE::BAN, expanded_vertex).set_checked_duplicates();
     }
 
     // If node in iter wait can be added, then not future maximal
-    for (size_t u : *iter_wait) {
+    for (size_t u : iter_wait) {
         if (u < expanded_vertex &&
-            graph->is_completely_connect_to(u, completely_connected_in) &&
-            graph->is_completely_independent_from(u, independent_from_in)) {
+            graph->is_completely_connect_to(u, expanded.completely_connected_in) &&
+            graph->is_completely_independent_from(u, expanded.independent_from_in)) {
 
-            return ExpansionResult(ExpansionResult::RETURN_TYPE::DISCONTINUE);
+            return ExpansionResult(ExpansionResult::RETURN_TYPE::DISCONTINUE).set_checked_duplicates();
         }
         if (u >= expanded_vertex) break;
     }
 
-    vector_minus_neighborhood(oct_auxiliary_independent_set, expanded_vertex);
+    vector_minus_neighborhood(oct_auxiliary_independent_set, expanded_vertex,
+                              expanded.oct_auxiliary_independent_set);
 
-    return ExpansionResult(ExpansionResult::RETURN_TYPE::SUCCESS);
+    expanded.next_future_maximal = next_future_maximal;
+
+    // The bag of `expanded` waits on the vertices after expanded_vertex, so
+    // its ban bits are ours shifted down past expanded_vertex
+    size_t first = in_wait ? position + 1 : position;
+    size_t word_shift = first >> 6, bit_shift = first & 63;
+    expanded.ban_bits.clear();
+    for (size_t word = word_shift; word < ban_bits.size(); word++) {
+        uint64_t bits = ban_bits[word] >> bit_shift;
+        if (bit_shift > 0 && word + 1 < ban_bits.size()) {
+            bits |= ban_bits[word + 1] << (64 - bit_shift);
+        }
+        expanded.ban_bits.push_back(bits);
+    }
+    while (!expanded.ban_bits.empty() && expanded.ban_bits.back() == 0) {
+        expanded.ban_bits.pop_back();
+    }
+    expanded.other_bans = other_bans;
+
+    return ExpansionResult(ExpansionResult::RETURN_TYPE::SUCCESS).set_checked_duplicates();
 
 }
 
 
-bool BlueprintLite::skip_expanding_vertex(const size_t u) const {
+/**
+ * Check whether some biclique built from this blueprint by further expansion
+ * could meet the given size constraints. The left side always contains
+ * iterative_in and lies within iterative_in, independent_from_in and
+ * iterative_wait; the right side lies within completely_connected_in.
+ *
+ * @param  iterative        Iterative sets of the bag holding the blueprint.
+ * @param  size_constraints Bounds on the sides of the bicliques of interest.
+ * @return                  False if no descendant can meet the constraints.
+ */
+bool BlueprintLite::can_satisfy(const IterativeSets & iterative,
+                                const SizeConstraints & size_constraints) const {
+
+    if (!size_constraints.is_active()) return true;
+
+    size_t left_lower = iterative.get_in_size();
+    size_t left_upper = left_lower + independent_from_in.size() + iterative.get_wait().size();
+    return size_constraints.can_satisfy(left_lower, left_upper,
+                                        1, completely_connected_in.size());
+
+}
+
+
+bool BlueprintLite::skip_expanding_vertex(const IterativeSets & iterative, const size_t u) const {
     // If u is beyond the next node needed for maximality, skip
     if (u > get_next_future_maximal()) {
         return true;
     }
     // If u is banned in blueprint, skip
-    if (is_banned(u)) {
+    if (is_banned(iterative, u)) {
         return true;
     }
     return false;
 }
 
 
-void BlueprintLite::update_iterative_ptrs(std::shared_ptr<std::vector<size_t>> iter_wait,
-                                           std::shared_ptr<OrderedVertexSet> iter_in,
-                                           std::shared_ptr<std::vector<size_t>> iter_past) {
-
-    this->iter_wait = iter_wait;
-    this->iter_in = iter_in;
-    this->iter_past = iter_past;
-}
-
-
 /**
+ * Set result to the vertices of vector adjacent to vertex.
  * NOTE: as long as vector is sorted when input,
  * this operation will preserve ordering.
  */
-void BlueprintLite::vector_intersect_neighborhood(std::vector<size_t> & vector, size_t vertex) {
+void BlueprintLite::vector_intersect_neighborhood(const std::pmr::vector<size_t> & vector,
+                                                  size_t vertex,
+                                                  std::pmr::vector<size_t> & result) const {
 
-    size_t idx_front = 0;
+    result.clear();
     const std::vector<size_t> & neighbors = graph->get_neighbors_vector(vertex);
 
-    if (neighbors.size() == 0) {
-        vector.clear();
-        return;
-    }
+    if (neighbors.size() == 0) return;
     size_t last_neighbor = neighbors.back();
 
-    for (size_t idx=0; idx < vector.size(); idx++) {
-        size_t u = vector[idx];
-        if (graph->has_edge(vertex, u)) {
-            vector[idx_front]=u;
-            idx_front++;
-        }
+    for (size_t u : vector) {
         if (u > last_neighbor) break;
+        if (graph->has_edge(vertex, u)) result.push_back(u);
     }
-    vector.resize(idx_front);
 }
 
 
 /**
+ * Set result to the vertices of vector not adjacent to vertex.
  * NOTE: as long as vector is sorted when input,
  * this operation will preserve ordering.
  */
-void BlueprintLite::vector_minus_neighborhood(std::vector<size_t> & vector, size_t vertex) {
-    size_t idx_front = 0;
+void BlueprintLite::vector_minus_neighborhood(const std::pmr::vector<size_t> & vector,
+                                              size_t vertex,
+                                              std::pmr::vector<size_t> & result) const {
+
     const std::vector<size_t> & neighbors = graph->get_neighbors_vector(vertex);
 
-    if (neighbors.size() == 0) return;
+    if (neighbors.size() == 0) {
+        result.assign(vector.begin(), vector.end());
+        return;
+    }
     size_t last_neighbor = neighbors.back();
 
-    size_t idx = 0;
-    for (; idx < vector.size(); idx++) {
-        size_t u = vector[idx];
-        if (!graph->has_edge(vertex, u)) {
-            vector[idx_front]=u;
-            idx_front++;
-        }
-        if (u > last_neighbor) break;
+    result.clear();
+    auto itr = vector.begin();
+    for (; itr != vector.end() && *itr <= last_neighbor; itr++) {
+        if (!graph->has_edge(vertex, *itr)) result.push_back(*itr);
     }
-    idx++;
-    for (; idx < vector.size(); idx++) {
-        vector[idx_front] = vector[idx];
-        idx_front++;
-    }
-    vector.resize(idx_front);
+    result.insert(result.end(), itr, vector.end());
 
 }
 
-
-/**
- * NOTE: as long as vector is sorted when input,
- * this operation will preserve ordering.
- */
-std::vector<size_t> BlueprintLite::vector_union(const std::vector<size_t> & vector1, const std::vector<size_t> & vector2) const {
-
-    std::vector<size_t> dummy(vector1.size() + vector2.size());
-
-    auto it = std::set_union (vector1.begin(), vector1.end(), vector2.begin(), vector2.end(), dummy.begin());
-
-    dummy.resize(it-dummy.begin());
-
-    return dummy;
-
-}
@@ -14,12 +14,16 @@
 
 
 #include <memory> // for std::shared_ptr
+#include <memory_resource>
 #include <cstddef>
+#include <cstdint>
 #include <string>
 #include <tuple>
 #include "BicliqueLite.h"
 #include "ExpansionResult.h"
 #include "Graph.h"
+#include "IterativeSets.h"
+#include "SizeConstraints.h"
 
 
 class BlueprintLite {
@@ -28,50 +32,77 @@ private:
     size_t next_future_maximal;
     size_t id;
     std::shared_ptr<Graph> graph;
-    std::shared_ptr<OrderedVertexSet> iter_in;
-    std::shared_ptr<std::vector<size_t>> iter_wait, iter_past;
-    std::vector<size_t>
+    // The sets are allocated from the arena of the search tree holding the
+    // blueprint, if any (see SearchTreeArena)
+    std::pmr::vector<size_t>
             completely_connected_in,
             completely_connected_out,
             independent_from_in,
             independent_from_out;
 
-    std::vector<size_t> oct_auxiliary_independent_set;
+    std::pmr::vector<size_t> oct_auxiliary_independent_set;
 
-    std::unordered_map<size_t, bool> ban_list;
+    // Bit i is set if iterative_wait[i] is banned; trailing zero words are
+    // dropped, so a blueprint without bans holds no storage. Vertices banned
+    // outside iterative_wait (only possible through ban_vertex) are listed apart.
+    std::pmr::vector<uint64_t> ban_bits;
+    std::pmr::vector<size_t> other_bans;
 
-    void vector_intersect_neighborhood(std::vector<size_t> & , size_t );
-    void vector_minus_neighborhood(std::vector<size_t> & , size_t );
-    std::vector<size_t> vector_union(const std::vector<size_t> &,
-                                     const std::vector<size_t> & ) const;
+    size_t wait_position(const IterativeSets & iterative, const size_t v) const;
+
+    void vector_intersect_neighborhood(const std::pmr::vector<size_t> & , size_t ,
+                                       std::pmr::vector<size_t> & ) const;
+    void vector_minus_neighborhood(const std::pmr::vector<size_t> & , size_t ,
+                                   std::pmr::vector<size_t> & ) const;
+
+    /**
+     * NOTE: as long as both vectors are sorted when input,
+     * this operation will preserve ordering.
+     */
+    template<class T1, class T2>
+    std::vector<size_t> vector_union(const T1 & vector1, const T2 & vector2) const {
+        std::vector<size_t> dummy(vector1.size() + vector2.size());
+        auto it = std::set_union(vector1.begin(), vector1.end(),
+                                 vector2.begin(), vector2.end(), dummy.begin());
+        dummy.resize(it - dummy.begin());
+        return dummy;
+    }
 
 public:
 
+    using allocator_type = std::pmr::polymorphic_allocator<size_t>;
+
+    BlueprintLite();
+    explicit BlueprintLite(const allocator_type & alloc);
+    BlueprintLite(const BlueprintLite & other) = default;
+    BlueprintLite(BlueprintLite && other) = default;
+    BlueprintLite(const BlueprintLite & other, const allocator_type & alloc);
+    BlueprintLite(BlueprintLite && other, const allocator_type & alloc);
+    BlueprintLite & operator=(const BlueprintLite & other) = default;
+    BlueprintLite & operator=(BlueprintLite && other) = default;
     BlueprintLite(size_t id,
                   std::shared_ptr<Graph> graph,
-                  std::shared_ptr<std::vector<size_t>> iterative_wait,
-                  std::shared_ptr<OrderedVertexSet> iterative_in,
-                  std::shared_ptr<std::vector<size_t>> iterative_past,
                   std::vector<size_t> completely_connected_in,
                   std::vector<size_t> completely_connected_out,
                   std::vector<size_t> independent_from_in,
                   std::vector<size_t> independent_from_out,
-                  std::vector<size_t> oct_auxiliary_independent_set
+                  std::vector<size_t> oct_auxiliary_independent_set,
+                  const allocator_type & alloc = allocator_type()
                  );
 
-    ExpansionResult expand(const size_t v,
-                           const std::unordered_map<std::string,bool> & duplicates_list);
+    ExpansionResult expand(const IterativeSets & iterative,
+                           const size_t v,
+                           const std::unordered_map<std::string,bool> & duplicates_list,
+                           const SizeConstraints & size_constraints = SizeConstraints());
 
-    void update_iterative_ptrs(std::shared_ptr<std::vector<size_t>> iter_wait,
-                               std::shared_ptr<OrderedVertexSet> iter_in,
-                               std::shared_ptr<std::vector<size_t>> iter_past);
+    ExpansionResult expand(const IterativeSets & iterative,
+                           const size_t v,
+                           const std::unordered_map<std::string,bool> & duplicates_list,
+                           const SizeConstraints & size_constraints,
+                           BlueprintLite & expanded) const;
 
-    void print_iteratives() {
-        std::cout << "\tInside BlueprintLite" << std::endl;
-        std::cout << "\t iterative_wait is " << vector_to_string(*iter_wait) << std::endl;
-        std::cout << "\t iterative_in is " << iter_in->to_string() << std::endl;
-        std::cout << "\t iterative_past is " << vector_to_string(*iter_past) << std::endl;
-    };
+    bool can_satisfy(const IterativeSets & iterative,
+                     const SizeConstraints & size_constraints) const;
 
     void print_non_iteratives() const {
         std::cout << "\tInside BlueprintLite" << std::endl;
@@ -81,8 +112,8 @@ public:
         std::cout << "\t if_out is " << vector_to_string(independent_from_out) << std::endl;
     };
 
-    BicliqueLite get_biclique();
-    std::string get_biclique_string();
+    BicliqueLite get_biclique(const IterativeSets & iterative) const;
+    std::string get_biclique_string(const IterativeSets & iterative) const;
     BicliqueLite get_partial_biclique();
     std::string get_partial_biclique_string();
 
@@ -90,15 +121,50 @@ public:
         return completely_connected_in;
     };
 
-    bool is_banned(const size_t v) const;
-    bool ban_vertex(const size_t v);
+    // Side sizes of get_biclique(), without building it
+    inline size_t get_left_size(const IterativeSets & iterative) const {
+        return iterative.get_in_size() + independent_from_in.size();
+    }
+    inline size_t get_right_size() const {
+        return completely_connected_in.size();
+    }
 
-    bool is_currently_maximal();
-    bool is_currently_maximal(size_t & next_future_max_vert);
+    // Bytes held by this blueprint, not counting the sets it shares
+    inline size_t memory_usage() const {
+        return sizeof(BlueprintLite) +
+               sizeof(size_t)*(completely_connected_in.size() +
+                               completely_connected_out.size() +
+                               independent_from_in.size() +
+                               independent_from_out.size() +
+                               oct_auxiliary_independent_set.size() +
+                               other_bans.size()) +
+               sizeof(uint64_t)*ban_bits.size();
+    }
 
-    inline size_t get_id() {
+    bool is_banned(const IterativeSets & iterative, const size_t v) const;
+    bool ban_vertex(const IterativeSets & iterative, const size_t v);
+
+    /**
+     * Ban status of iterative_wait[position], and banning it, without a search
+     */
+    inline bool is_banned_at(const size_t position) const {
+        return (position >> 6) < ban_bits.size() &&
+               (ban_bits[position >> 6] >> (position & 63)) & 1;
+    }
+    inline void ban_at(const size_t position) {
+        if ((position >> 6) >= ban_bits.size()) ban_bits.resize((position >> 6) + 1, 0);
+        ban_bits[position >> 6] |= uint64_t(1) << (position & 63);
+    }
+
+    bool is_currently_maximal(const IterativeSets & iterative) const;
+    bool is_currently_maximal(const IterativeSets & iterative, size_t & next_future_max_vert) const;
+
+    inline size_t get_id() const {
         return id;
     }
+    inline void set_id(const size_t new_id) {
+        id = new_id;
+    }
 
     /**
      * Check to see if some set of vertices can be added to the left side of the current Biclique. This is true if and only
@@ -147,11 +213,16 @@ public:
         return false;
     }
 
-    inline size_t get_last_vertex() {
+    inline size_t get_last_vertex() const {
         return graph->get_num_vertices();
     }
 
-    bool skip_expanding_vertex(const size_t u) const;
+    bool skip_expanding_vertex(const IterativeSets & iterative, const size_t u) const;
+
+    // Same as skip_expanding_vertex(iterative, u), where u is iterative_wait[position]
+    inline bool skip_expanding_vertex(const size_t u, const size_t position) const {
+        return u > get_next_future_maximal() || is_banned_at(position);
+    }
 };
 
 #endif //BICLIQUES_BLUEPRINTLITE_H
@@ -0,0 +1,295 @@
+/**
+ * DuplicatesTable records the string of every biclique output so far, so that
+ * a biclique found more than once is only output the first time.
+ *
+ * Most lookups are for bicliques that have not been seen, so the exact set is
+ * fronted by a blocked Bloom filter: each string hashes to one 512-bit block
+ * (a single cache line) and sets one bit in each of its eight words. The
+ * filter is sized from the expected number of entries and rebuilt at twice
+ * the size whenever that estimate is exceeded.
+ *
+ * The exact set is open-addressing with linear probing; each slot holds the
+ * whole hash of a string and its index in an array of strings. A string
+ * whose filter bits are not all set is certainly new, so it goes into the
+ * first free slot from its home without being compared to any stored string.
+ * Only filter hits search the exact set, and they compare strings only when
+ * the hash of a slot matches. The set is kept at most half full, doubling as
+ * needed, and neither growing it nor rebuilding the filter hashes any string
+ * again.
+ *
+ * A table built with more than one shard may be used from several threads at
+ * once. Strings are split over the shards by hash, and each shard has its own
+ * filter, exact set and lock.
+ *
+ * @authors Eric Horton, Kyle Kloster, Drew van der Poel
+ *
+ * This file is part of MI-bicliques, https://github.com/TheoryInPractice/MI-bicliques,
+ * and is Copyright (C) North Carolina State University, 2018.
+ * It is licensed under the three-clause BSD license; see LICENSE.
+ */
+
+#include <algorithm> // for std::max
+#include <functional> // for std::hash
+#include "DuplicatesTable.h"
+
+
+namespace {
+
+// Filter bits per expected entry; with 8 bits set per entry this gives a
+// false positive rate of roughly 0.1%.
+const size_t BITS_PER_ENTRY = 16;
+const size_t MIN_CAPACITY = 64;
+const size_t MIN_SLOTS = 16;
+
+// Odd multipliers used to derive the bit set in each word of a block
+const uint32_t SALT[8] = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+                          0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+size_t home_slot(uint64_t hash, size_t mask) {
+    return size_t((hash*0xc4ceb9fe1a85ec53ULL) >> 32) & mask;
+}
+
+}
+
+
+/**
+ * Construct an empty table whose filter is sized for `expected_num_entries`.
+ * With `num_shards` > 1 the table is safe to use from several threads.
+ */
+DuplicatesTable::DuplicatesTable(size_t expected_num_entries, size_t num_shards) {
+
+    if (num_shards == 0) num_shards = 1;
+
+    for (size_t idx = 0; idx < num_shards; idx++) {
+        shards.push_back(std::unique_ptr<Shard>(new Shard()));
+        shards.back()->rehash(MIN_SLOTS);
+        shards.back()->rebuild_filter(expected_num_entries/num_shards);
+    }
+
+}
+
+
+/**
+ * Resize the filter for `expected_num_entries`, if that is more than it is
+ * currently sized for. Not safe to call while other threads use the table.
+ */
+void DuplicatesTable::reserve(size_t expected_num_entries) {
+
+    for (auto & shard : shards) {
+        if (expected_num_entries/shards.size() > shard->capacity) {
+            shard->rebuild_filter(expected_num_entries/shards.size());
+        }
+    }
+
+}
+
+
+/**
+ * Add `key` to the table.
+ *
+ * @return True if `key` was not already in the table.
+ */
+bool DuplicatesTable::insert(const std::string & key) {
+
+    uint64_t hash = std::hash<std::string>()(key);
+    Shard & shard = get_shard(hash);
+
+    std::unique_lock<std::mutex> lock(shard.mutex, std::defer_lock);
+    if (shards.size() > 1) lock.lock();
+
+    size_t slot;
+    shard.num_filter_lookups++;
+    if (shard.filter_contains(hash)) {
+        shard.num_table_lookups++;
+        slot = shard.find_slot(hash, key);
+        if (shard.slots[slot].key_plus_one != 0) return false;
+    }
+    else {
+        slot = shard.free_slot(hash);
+    }
+
+    shard.add_key(slot, hash, key);
+    shard.filter_add(hash);
+    if (shard.keys.size() > shard.capacity) shard.rebuild_filter(2*shard.capacity);
+    return true;
+
+}
+
+
+/**
+ * Check whether `key` is in the table.
+ */
+bool DuplicatesTable::contains(const std::string & key) {
+
+    uint64_t hash = std::hash<std::string>()(key);
+    Shard & shard = get_shard(hash);
+
+    std::unique_lock<std::mutex> lock(shard.mutex, std::defer_lock);
+    if (shards.size() > 1) lock.lock();
+
+    shard.num_filter_lookups++;
+    if (!shard.filter_contains(hash)) return false;
+
+    shard.num_table_lookups++;
+    return shard.slots[shard.find_slot(hash, key)].key_plus_one != 0;
+
+}
+
+
+size_t DuplicatesTable::size() const {
+
+    size_t total = 0;
+    for (auto & shard : shards) total += shard->keys.size();
+    return total;
+
+}
+
+
+/**
+ * Approximate number of bytes held by the filters and the exact sets.
+ */
+size_t DuplicatesTable::get_memory_usage() const {
+
+    size_t bytes = 0;
+    for (auto & shard : shards) {
+        bytes += shard->filter.size()*sizeof(Block) + shard->slots.capacity()*sizeof(Slot) +
+                 shard->keys.capacity()*sizeof(std::string);
+        for (const std::string & key : shard->keys) {
+            if (key.capacity() >= sizeof(std::string)) bytes += key.capacity() + 1;
+        }
+    }
+    return bytes;
+
+}
+
+
+size_t DuplicatesTable::get_num_filter_lookups() const {
+
+    size_t total = 0;
+    for (auto & shard : shards) total += shard->num_filter_lookups;
+    return total;
+
+}
+
+
+size_t DuplicatesTable::get_num_table_lookups() const {
+
+    size_t total = 0;
+    for (auto & shard : shards) total += shard->num_table_lookups;
+    return total;
+
+}
+
+
+/**
+ * Shards are chosen by a multiplicative hash of the string hash, so that the
+ * choice is independent of the bits used inside each filter.
+ */
+DuplicatesTable::Shard & DuplicatesTable::get_shard(uint64_t hash) {
+
+    if (shards.size() == 1) return *shards.front();
+    uint64_t mixed = (hash*0x9e3779b97f4a7c15ULL) >> 32;
+    return *shards[(mixed*shards.size()) >> 32];
+
+}
+
+
+bool DuplicatesTable::Shard::filter_contains(uint64_t hash) const {
+
+    const Block & block = filter[((hash >> 32)*filter.size()) >> 32];
+    uint32_t low_bits = uint32_t(hash);
+    for (size_t word = 0; word < 8; word++) {
+        uint64_t bit = uint64_t(1) << ((low_bits*SALT[word]) >> 26);
+        if ((block[word] & bit) == 0) return false;
+    }
+    return true;
+
+}
+
+
+void DuplicatesTable::Shard::filter_add(uint64_t hash) {
+
+    Block & block = filter[((hash >> 32)*filter.size()) >> 32];
+    uint32_t low_bits = uint32_t(hash);
+    for (size_t word = 0; word < 8; word++) {
+        block[word] |= uint64_t(1) << ((low_bits*SALT[word]) >> 26);
+    }
+
+}
+
+
+/**
+ * Reallocate the filter for `expected_num_entries` and re-add the stored
+ * hash of every string already in the exact set.
+ */
+void DuplicatesTable::Shard::rebuild_filter(size_t expected_num_entries) {
+
+    capacity = std::max(expected_num_entries, MIN_CAPACITY);
+    size_t num_blocks = (capacity*BITS_PER_ENTRY + 511)/512;
+
+    filter.assign(num_blocks, Block());
+    for (const Slot & s : slots) {
+        if (s.key_plus_one != 0) filter_add(s.hash);
+    }
+
+}
+
+
+/**
+ * The slot holding `key`, or the empty slot where it would go. Slots are
+ * chosen by a second multiplicative hash, independent of the shard and of
+ * the filter block.
+ */
+size_t DuplicatesTable::Shard::find_slot(uint64_t hash, const std::string & key) const {
+
+    size_t mask = slots.size() - 1;
+    for (size_t slot = home_slot(hash, mask); ; slot = (slot + 1) & mask) {
+        const Slot & s = slots[slot];
+        if (s.key_plus_one == 0) return slot;
+        if (s.hash == hash && keys[s.key_plus_one - 1] == key) return slot;
+    }
+
+}
+
+
+/**
+ * The first empty slot from the home of `hash`, for a string known to be new.
+ */
+size_t DuplicatesTable::Shard::free_slot(uint64_t hash) const {
+
+    size_t mask = slots.size() - 1;
+    size_t slot = home_slot(hash, mask);
+    while (slots[slot].key_plus_one != 0) slot = (slot + 1) & mask;
+    return slot;
+
+}
+
+
+/**
+ * Store `key` in the empty `slot`, doubling the slots once more than half
+ * are used.
+ */
+void DuplicatesTable::Shard::add_key(size_t slot, uint64_t hash, const std::string & key) {
+
+    keys.push_back(key);
+    slots[slot].hash = hash;
+    slots[slot].key_plus_one = keys.size();
+    if (2*keys.size() > slots.size()) rehash(2*slots.size());
+
+}
+
+
+/**
+ * Move every string into a table of num_slots slots, a power of two. Slots
+ * keep the whole hash, so no string is hashed again.
+ */
+void DuplicatesTable::Shard::rehash(size_t num_slots) {
+
+    std::vector<Slot> old_slots(num_slots);
+    old_slots.swap(slots);
+
+    for (const Slot & s : old_slots) {
+        if (s.key_plus_one != 0) slots[free_slot(s.hash)] = s;
+    }
+
+}
@@ -0,0 +1,76 @@
+/**
+ * DuplicatesTable is a set of biclique strings with a blocked Bloom filter in
+ * front of the exact set. See DuplicatesTable.cpp for full documentation.
+ *
+ * @authors Eric Horton, Kyle Kloster, Drew van der Poel
+ *
+ * This file is part of MI-bicliques, https://github.com/TheoryInPractice/MI-bicliques,
+ * and is Copyright (C) North Carolina State University, 2018.
+ * It is licensed under the three-clause BSD license; see LICENSE.
+ */
+
+#ifndef BICLIQUES_DUPLICATESTABLE_H
+#define BICLIQUES_DUPLICATESTABLE_H
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "stddef.h"  // apparently required for size_t
+
+class DuplicatesTable {
+
+public:
+    DuplicatesTable(size_t expected_num_entries = 0, size_t num_shards = 1);
+
+    void reserve(size_t expected_num_entries);
+    bool insert(const std::string & key);
+    bool contains(const std::string & key);
+
+    size_t size() const;
+    size_t get_memory_usage() const;
+
+    // Number of lookups answered by each tier
+    size_t get_num_filter_lookups() const;
+    size_t get_num_table_lookups() const;
+
+private:
+    // One block is a cache line of 512 bits
+    typedef std::array<uint64_t, 8> Block;
+
+    // A slot is empty if key_plus_one is 0; hash is the key's whole hash
+    struct Slot {
+        uint64_t hash = 0;
+        uint64_t key_plus_one = 0;
+    };
+
+    struct Shard {
+        std::mutex mutex;
+        std::vector<Block> filter;
+        size_t capacity = 0;
+        std::vector<Slot> slots;
+        std::vector<std::string> keys;
+
+        size_t num_filter_lookups = 0;
+        size_t num_table_lookups = 0;
+
+        bool filter_contains(uint64_t hash) const;
+        void filter_add(uint64_t hash);
+        void rebuild_filter(size_t expected_num_entries);
+
+        size_t find_slot(uint64_t hash, const std::string & key) const;
+        size_t free_slot(uint64_t hash) const;
+        void add_key(size_t slot, uint64_t hash, const std::string & key);
+        void rehash(size_t num_slots);
+    };
+
+    std::vector<std::unique_ptr<Shard>> shards;
+
+    Shard & get_shard(uint64_t hash);
+
+};
+
+
+#endif //BICLIQUES_DUPLICATESTABLE_H
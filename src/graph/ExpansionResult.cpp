@@ -62,3 +62,27 @@ const ExpansionResult::RETURN_TYPE & ExpansionResult::get_return_type() const {
 size_t ExpansionResult::get_vertex() const {
     return vertex;
 }
+
+
+/**
+ * Whether this result was returned after the duplicate check of
+ * BlueprintLite::expand, so that the expanded blueprint's partial biclique
+ * was looked up in the duplicates list. Earlier results do not depend on
+ * that list.
+ *
+ * @return checked_duplicates
+ */
+bool ExpansionResult::get_checked_duplicates() const {
+    return checked_duplicates;
+}
+
+
+/**
+ * Mark this result as returned after the duplicate check.
+ *
+ * @return this ExpansionResult
+ */
+ExpansionResult & ExpansionResult::set_checked_duplicates() {
+    checked_duplicates = true;
+    return *this;
+}
@@ -24,9 +24,14 @@ public:
     const RETURN_TYPE & get_return_type() const;
     size_t get_vertex() const;
 
+    // Whether BlueprintLite::expand returned this after its duplicate check
+    bool get_checked_duplicates() const;
+    ExpansionResult & set_checked_duplicates();
+
 private:
     RETURN_TYPE return_type;
     size_t vertex;
+    bool checked_duplicates = false;
 
 };
 
@@ -387,10 +387,11 @@ size_t Graph::get_num_edges() const {
  * internal_vertex_label to that vertex's internal (size_t) label
  * and return true. Else return false.
  */
-bool Graph::get_internal_vertex_label(const std::string & external_vertex_label, size_t& internal_vertex_label) {
+bool Graph::get_internal_vertex_label(const std::string & external_vertex_label, size_t& internal_vertex_label) const {
 
-    if (reverse_node_labels.find(external_vertex_label) != reverse_node_labels.end()) {
-        internal_vertex_label = reverse_node_labels[external_vertex_label];
+    auto label_itr = reverse_node_labels.find(external_vertex_label);
+    if (label_itr != reverse_node_labels.end()) {
+        internal_vertex_label = label_itr->second;
         return true;
     }
 
@@ -399,11 +400,14 @@ bool Graph::get_internal_vertex_label(const std::string & external_vertex_label,
 }
 
 /*
- * Return external string label of vertex with internal (size_t) label internal_vertex_label
+ * Return external string label of vertex with internal (size_t) label
+ * internal_vertex_label, or the empty string if it has none.
  */
-std::string Graph::get_external_vertex_label(size_t internal_vertex_label) {
+std::string Graph::get_external_vertex_label(size_t internal_vertex_label) const {
 
-    return node_labels[internal_vertex_label];
+    auto label_itr = node_labels.find(internal_vertex_label);
+    if (label_itr == node_labels.end()) return std::string();
+    return label_itr->second;
 
 }
 
@@ -547,25 +551,25 @@ bool Graph::is_biclique(const BicliqueLite & this_biclique) const {
  * std::vector<size_t> if sorted in ascending order.
  */
 bool Graph::is_completely_connect_to(const size_t v,
-                                     const std::vector<size_t> &s) const {
+                                     const size_t * s, const size_t s_size) const {
     // If s is empty, return TRUE -- note, this is a design choice;
     // in this case the set s being empty means it can not prevent
     // nodes from being added to the biclique in our larger algorithm.
 
-    if ( s.size() == 0 ) return true;
+    if ( s_size == 0 ) return true;
 
     const std::vector<size_t> & v_neighborhood = get_neighbors_vector(v);
 
     // If v's neighborhood too small, can't contain all of s
-    if ( v_neighborhood.size() < s.size() ) return false;
+    if ( v_neighborhood.size() < s_size ) return false;
 
     // if range of v's neighborhood does not contain range of s, return false
-    if ((s.front() < v_neighborhood.front()) || (s.back() > v_neighborhood.back())) {
+    if ((s[0] < v_neighborhood.front()) || (s[s_size - 1] > v_neighborhood.back())) {
         return false;
     }
 
     // for each j in s check if j is adjacent to v
-    for (auto j : s) if (!has_edge(v,j)) return false;
+    for (size_t idx = 0; idx < s_size; idx++) if (!has_edge(v, s[idx])) return false;
 
     return true;
 
@@ -578,10 +582,9 @@ bool Graph::is_completely_connect_to(const size_t v,
  * WARNING: this assumes that v is not contained in s
  */
 bool Graph::is_completely_independent_from(const size_t v,
-                                           const std::vector<size_t> & s) const {
+                                           const size_t * s, const size_t s_size) const {
     // If s is empty, return TRUE -- note, this is a design choice:
     // we want this function to reflect whether there are no edges from v to s.
-    size_t s_size = s.size();
     if ( s_size == 0 ) return true;
 
     const std::vector<size_t> & v_neighborhood = get_neighbors_vector(v);
@@ -593,7 +596,7 @@ bool Graph::is_completely_independent_from(const size_t v,
     if ( v_size > this->num_vertices - s_size ) return false;
 
     // if range of v's neighbs totally outside range of s, return true
-    if ((v_neighborhood.back() < s.front()) || (v_neighborhood.front() > s.back())){
+    if ((v_neighborhood.back() < s[0]) || (v_neighborhood.front() > s[s_size - 1])){
         return true;
     }
 
@@ -603,9 +606,9 @@ bool Graph::is_completely_independent_from(const size_t v,
     // But only bother to do this if the set sizes are large,
     // otherwise it isn't worth the extra flops.
     if ( std::min(s_size, v_size) > 10 ) {
-        int s_lower = (int) s.front();
+        int s_lower = (int) s[0];
         int v_lower = (int) v_neighborhood.front();
-        int s_upper = (int) s.back();
+        int s_upper = (int) s[s_size - 1];
         int v_upper = (int) v_neighborhood.back();
         int common_range_lower_bound = std::max( s_lower, v_lower );
         int common_range_upper_bound = std::min( s_upper, v_upper );
@@ -621,8 +624,8 @@ bool Graph::is_completely_independent_from(const size_t v,
     }
 
     // ranges of s and v_neighborhood intersect, must inspect for edges.
-    for (size_t j : s) {
-        if (has_edge(v,j)) return false;
+    for (size_t idx = 0; idx < s_size; idx++) {
+        if (has_edge(v, s[idx])) return false;
     }
 
     return true;
@@ -18,6 +18,7 @@
 #include <vector>
 #include <algorithm>
 #include <fstream>
+#include <memory_resource>
 #include <string>
 #include <iostream>
 #include <sstream>
@@ -85,8 +86,16 @@ public:
         return is_completely_connect_to( v, s.get_vertices() );
     }
     // WARNING: assumes input vector is sorted.
+    inline bool is_completely_connect_to(const size_t v,
+                                         const std::vector<size_t> &s) const {
+        return is_completely_connect_to(v, s.data(), s.size());
+    }
+    inline bool is_completely_connect_to(const size_t v,
+                                         const std::pmr::vector<size_t> &s) const {
+        return is_completely_connect_to(v, s.data(), s.size());
+    }
     bool is_completely_connect_to(const size_t v,
-                                  const std::vector<size_t> &s) const;
+                                  const size_t * s, const size_t s_size) const;
 
     // Template allows function to work on OVS and OrderedVector
     template<class T>
@@ -96,14 +105,22 @@ public:
         return is_completely_independent_from( v, s.get_vertices() );
     }
     // WARNING: assumes input vector is sorted.
+    inline bool is_completely_independent_from(const size_t v,
+                                               const std::vector<size_t> &s) const {
+        return is_completely_independent_from(v, s.data(), s.size());
+    }
+    inline bool is_completely_independent_from(const size_t v,
+                                               const std::pmr::vector<size_t> &s) const {
+        return is_completely_independent_from(v, s.data(), s.size());
+    }
     bool is_completely_independent_from(const size_t v,
-                                        const std::vector<size_t> &s) const;
+                                        const size_t * s, const size_t s_size) const;
 
     size_t get_num_vertices() const;
     size_t get_num_edges() const;
 
-    bool get_internal_vertex_label(const std::string & external_vertex_label, size_t& internal_vertex_label);
-    std::string get_external_vertex_label(size_t internal_vertex_label);
+    bool get_internal_vertex_label(const std::string & external_vertex_label, size_t& internal_vertex_label) const;
+    std::string get_external_vertex_label(size_t internal_vertex_label) const;
 
     // For recording bicliques for comparing to ground truth
     std::string biclique_string(const BicliqueLite &b) const;
@@ -0,0 +1,110 @@
+/**
+ * IterativeSets holds the iterative sets shared by the blueprints of a search
+ * tree bag. Every bag of a search tree takes its vertices from the same
+ * independent set, which is stored once per tree (`order`) and shared by all
+ * of its bags. Expanding a bag on a vertex v of iterative_wait
+ *
+ * - adds v to iterative_in,
+ * - adds the vertices of iterative_wait before v to iterative_past, and
+ * - leaves the vertices of iterative_wait after v as the new iterative_wait,
+ *
+ * so iterative_wait is always a suffix of `order`, and iterative_past is
+ * everything before it that is not in iterative_in. The sets of a child are
+ * thus an offset into `order` and one more node on the list of iterative_in,
+ * built without copying anything; the sets are never changed once built, so
+ * bags and blueprints can share them freely, across threads too.
+ *
+ * @authors Eric Horton, Kyle Kloster, Drew van der Poel
+ *
+ * This file is part of MI-bicliques, https://github.com/TheoryInPractice/MI-bicliques,
+ * and is Copyright (C) North Carolina State University, 2018.
+ * It is licensed under the three-clause BSD license; see LICENSE.
+ */
+
+#include <algorithm> // for std::lower_bound, std::reverse, std::sort
+#include "IterativeSets.h"
+
+
+/**
+ * Construct empty iterative sets.
+ */
+IterativeSets::IterativeSets() {
+
+}
+
+
+/**
+ * Construct the iterative sets of the root of the search tree grown from
+ * `vertex` of independent_set, which is sorted: iterative_in is {vertex},
+ * iterative_past the vertices before it and iterative_wait those after.
+ */
+IterativeSets::IterativeSets(const std::vector<size_t> & independent_set, size_t vertex) :
+                             order(std::make_shared<const std::vector<size_t>>(independent_set)) {
+
+    size_t position = std::lower_bound(order->begin(), order->end(), vertex) - order->begin();
+    wait_begin = position + 1;
+    in = std::make_shared<const InNode>(InNode{position, 1, nullptr});
+
+}
+
+
+/**
+ * Construct iterative sets holding the given sets, each sorted.
+ */
+IterativeSets::IterativeSets(const std::vector<size_t> & iterative_wait,
+                             const OrderedVertexSet & iterative_in,
+                             const std::vector<size_t> & iterative_past) {
+
+    const std::vector<size_t> & in_vertices = iterative_in.get_vertices();
+
+    std::vector<size_t> all;
+    all.reserve(iterative_past.size() + in_vertices.size() + iterative_wait.size());
+    all.insert(all.end(), iterative_past.begin(), iterative_past.end());
+    all.insert(all.end(), in_vertices.begin(), in_vertices.end());
+    all.insert(all.end(), iterative_wait.begin(), iterative_wait.end());
+    order = std::make_shared<const std::vector<size_t>>(std::move(all));
+
+    for (size_t idx = 0; idx < in_vertices.size(); idx++) {
+        in = std::make_shared<const InNode>(InNode{iterative_past.size() + idx, idx + 1, in});
+    }
+    wait_begin = iterative_past.size() + in_vertices.size();
+
+}
+
+
+/**
+ * The iterative sets of the child of a bag with these sets expanded on
+ * expanded_vertex, which must be in iterative_wait.
+ */
+IterativeSets IterativeSets::child(size_t expanded_vertex) const {
+
+    Slice wait = get_wait();
+    size_t position = wait_begin +
+                      (std::lower_bound(wait.begin(), wait.end(), expanded_vertex) - wait.begin());
+
+    IterativeSets result;
+    result.order = order;
+    result.wait_begin = position + 1;
+    result.in = std::make_shared<const InNode>(InNode{position, get_in_size() + 1, in});
+    return result;
+
+}
+
+
+/**
+ * The vertices of iterative_in, sorted.
+ */
+std::vector<size_t> IterativeSets::get_in() const {
+
+    std::vector<size_t> vertices;
+    vertices.reserve(get_in_size());
+    for (const InNode * node = in.get(); node != nullptr; node = node->previous.get()) {
+        vertices.push_back((*order)[node->position]);
+    }
+    std::reverse(vertices.begin(), vertices.end());
+    if (!std::is_sorted(vertices.begin(), vertices.end())) {
+        std::sort(vertices.begin(), vertices.end());
+    }
+    return vertices;
+
+}
@@ -0,0 +1,135 @@
+/**
+ * IterativeSets holds the iterative sets of a search tree bag: iterative_in,
+ * the vertices of the independent set taken into the biclique so far;
+ * iterative_wait, those that may still be expanded on; and iterative_past,
+ * those passed over. See IterativeSets.cpp for full documentation.
+ *
+ * @authors Eric Horton, Kyle Kloster, Drew van der Poel
+ *
+ * This file is part of MI-bicliques, https://github.com/TheoryInPractice/MI-bicliques,
+ * and is Copyright (C) North Carolina State University, 2018.
+ * It is licensed under the three-clause BSD license; see LICENSE.
+ */
+
+#ifndef BICLIQUES_ITERATIVESETS_H
+#define BICLIQUES_ITERATIVESETS_H
+
+#include <iterator>
+#include <memory> // for std::shared_ptr
+#include <vector>
+#include "OrderedVertexSet.h"
+#include "stddef.h"  // apparently required for size_t
+
+
+class IterativeSets {
+
+private:
+    // A vertex of iterative_in, by its position in `order`, and the vertices
+    // added to iterative_in before it
+    struct InNode {
+        size_t position;
+        size_t size;
+        std::shared_ptr<const InNode> previous;
+    };
+
+public:
+
+    // A contiguous run of vertices, such as iterative_wait
+    class Slice {
+    public:
+        Slice(const size_t * first, const size_t * last) : first(first), last(last) {}
+        inline const size_t * begin() const { return first; }
+        inline const size_t * end() const { return last; }
+        inline size_t size() const { return last - first; }
+        inline bool empty() const { return first == last; }
+        inline const size_t & operator[](size_t idx) const { return first[idx]; }
+    private:
+        const size_t * first;
+        const size_t * last;
+    };
+
+    /**
+     * The vertices of iterative_past, most recently passed over first: the
+     * positions of `order` before iterative_wait, skipping those of
+     * iterative_in.
+     */
+    class PastRange {
+    public:
+        class iterator {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = size_t;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const size_t *;
+            using reference = const size_t &;
+
+            iterator(const size_t * order, size_t remaining, const InNode * in) :
+                     order(order), remaining(remaining), in(in) { skip_in(); }
+            inline reference operator*() const { return order[remaining - 1]; }
+            inline iterator & operator++() { remaining--; skip_in(); return *this; }
+            inline iterator operator++(int) { iterator old = *this; ++(*this); return old; }
+            inline bool operator==(const iterator & other) const { return remaining == other.remaining; }
+            inline bool operator!=(const iterator & other) const { return remaining != other.remaining; }
+        private:
+            // Positions of iterative_in come in decreasing order, as do ours
+            inline void skip_in() {
+                while (remaining > 0 && in != nullptr && in->position == remaining - 1) {
+                    remaining--;
+                    in = in->previous.get();
+                }
+            }
+            const size_t * order;
+            size_t remaining;
+            const InNode * in;
+        };
+
+        PastRange(const size_t * order, size_t end, const InNode * in, size_t in_size) :
+                  order(order), past_end(end), in(in), in_size(in_size) {}
+        inline iterator begin() const { return iterator(order, past_end, in); }
+        inline iterator end() const { return iterator(order, 0, nullptr); }
+        inline size_t size() const { return past_end - in_size; }
+        inline bool empty() const { return size() == 0; }
+    private:
+        const size_t * order;
+        size_t past_end;
+        const InNode * in;
+        size_t in_size;
+    };
+
+    IterativeSets();
+    IterativeSets(const std::vector<size_t> & independent_set, size_t vertex);
+    IterativeSets(const std::vector<size_t> & iterative_wait,
+                  const OrderedVertexSet & iterative_in,
+                  const std::vector<size_t> & iterative_past);
+
+    IterativeSets child(size_t expanded_vertex) const;
+
+    inline Slice get_wait() const {
+        const size_t * data = order ? order->data() : nullptr;
+        return Slice(data + wait_begin, data + (order ? order->size() : 0));
+    }
+
+    inline PastRange get_past() const {
+        return PastRange(order ? order->data() : nullptr, wait_begin, in.get(), get_in_size());
+    }
+
+    inline size_t get_in_size() const { return in ? in->size : 0; }
+    inline size_t get_last_in() const { return (*order)[in->position]; }
+    std::vector<size_t> get_in() const;
+
+    // Bytes held by these sets alone, not counting what they share
+    inline size_t memory_usage() const { return sizeof(IterativeSets) + sizeof(InNode); }
+
+private:
+    // The independent set the search tree grows from, in the order its
+    // vertices are considered; shared by every bag of the tree
+    std::shared_ptr<const std::vector<size_t>> order;
+    // iterative_wait is order[wait_begin:]
+    size_t wait_begin = 0;
+    // Last vertex added to iterative_in
+    std::shared_ptr<const InNode> in;
+
+};
+
+
+#endif //BICLIQUES_ITERATIVESETS_H
@@ -19,7 +19,8 @@
 #include <sstream>
 
 
-inline std::string vector_to_string(const std::vector<size_t> & vec) {
+template <class Alloc>
+inline std::string vector_to_string(const std::vector<size_t, Alloc> & vec) {
     std::stringstream s;
 
     if (vec.size() == 0) return std::string("");
@@ -0,0 +1,94 @@
+/**
+ * SearchTreeArena is the memory resource that the bags and blueprints of one
+ * search tree allocate from. Every search tree stack owns one, so each root
+ * (or, in parallel mode, each task expanding part of a tree) has its own.
+ *
+ * The many small, short-lived vectors of a search tree are served from pools
+ * of fixed-size blocks rather than by the global heap: a block freed by one
+ * bag is handed to the next that asks for one of that size, and when the
+ * tree is done every block is returned at once. An arena is used from a
+ * single thread only, so it takes no locks.
+ *
+ * The arena counts the bytes in use and the bytes it holds from the heap, so
+ * that the memory lost to unused blocks can be measured.
+ *
+ * @authors Eric Horton, Kyle Kloster, Drew van der Poel
+ *
+ * This file is part of MI-bicliques, https://github.com/TheoryInPractice/MI-bicliques,
+ * and is Copyright (C) North Carolina State University, 2018.
+ * It is licensed under the three-clause BSD license; see LICENSE.
+ */
+
+#ifndef BICLIQUES_SEARCHTREEARENA_H
+#define BICLIQUES_SEARCHTREEARENA_H
+
+#include <algorithm> // for std::max
+#include <memory_resource>
+#include "stddef.h"  // apparently required for size_t
+
+
+class SearchTreeArena : public std::pmr::memory_resource {
+
+public:
+    // Small chunks, and large vectors straight from the heap, keep a small
+    // tree from holding much more than it uses
+    SearchTreeArena() : pool(std::pmr::pool_options{16, 1024}, &upstream) {}
+
+    SearchTreeArena(const SearchTreeArena &) = delete;
+    SearchTreeArena & operator=(const SearchTreeArena &) = delete;
+
+    // Bytes handed out to the search tree, now and at most so far
+    inline size_t get_bytes_in_use() const { return bytes_in_use; }
+    inline size_t get_peak_bytes_in_use() const { return peak_bytes_in_use; }
+
+    // Bytes taken from the heap, now and at most so far
+    inline size_t get_bytes_reserved() const { return upstream.bytes_reserved; }
+    inline size_t get_peak_bytes_reserved() const { return upstream.peak_bytes_reserved; }
+
+private:
+
+    // The heap, counting what the pools take from it
+    class Upstream : public std::pmr::memory_resource {
+    public:
+        size_t bytes_reserved = 0;
+        size_t peak_bytes_reserved = 0;
+    private:
+        void * do_allocate(size_t bytes, size_t alignment) override {
+            void * block = std::pmr::new_delete_resource()->allocate(bytes, alignment);
+            bytes_reserved += bytes;
+            peak_bytes_reserved = std::max(peak_bytes_reserved, bytes_reserved);
+            return block;
+        }
+        void do_deallocate(void * block, size_t bytes, size_t alignment) override {
+            std::pmr::new_delete_resource()->deallocate(block, bytes, alignment);
+            bytes_reserved -= bytes;
+        }
+        bool do_is_equal(const std::pmr::memory_resource & other) const noexcept override {
+            return this == &other;
+        }
+    };
+
+    void * do_allocate(size_t bytes, size_t alignment) override {
+        void * block = pool.allocate(bytes, alignment);
+        bytes_in_use += bytes;
+        peak_bytes_in_use = std::max(peak_bytes_in_use, bytes_in_use);
+        return block;
+    }
+    void do_deallocate(void * block, size_t bytes, size_t alignment) override {
+        pool.deallocate(block, bytes, alignment);
+        bytes_in_use -= bytes;
+    }
+    bool do_is_equal(const std::pmr::memory_resource & other) const noexcept override {
+        return this == &other;
+    }
+
+    Upstream upstream;
+    std::pmr::unsynchronized_pool_resource pool;
+
+    size_t bytes_in_use = 0;
+    size_t peak_bytes_in_use = 0;
+
+};
+
+
+#endif //BICLIQUES_SEARCHTREEARENA_H
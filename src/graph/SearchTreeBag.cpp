@@ -25,95 +25,248 @@ bool SearchTreeBag::ban_vertex_in_blueprints(const size_t & vertex_to_ban,
                                              const size_t & blueprint_ID) {
 
     // if the ID isn't present, skip
-    if (blueprint_ID_to_bag_index.find(blueprint_ID) == blueprint_ID_to_bag_index.end()) {
+    if (blueprint_ID >= id_to_bag_index.size() ||
+        id_to_bag_index[blueprint_ID] == NO_BLUEPRINT) {
         return false;
     }
-    // else, the ID is present, so ban
-    bag[blueprint_ID_to_bag_index[blueprint_ID]].ban_vertex(vertex_to_ban);
+    // else, the ID is present, so ban it
+    bag[id_to_bag_index[blueprint_ID]].ban_vertex(iterative, vertex_to_ban);
     return true;
 }
 
 
 /**
  * Add input `blueprint` to this SearchTreeBag object, and update
- * the ID-to-blueprint-index map accordingly.
+ * the ID-to-blueprint-index map accordingly. The copy in the bag takes its
+ * index as id, so that ids stay small and dense down the search tree.
  *
  * @param blueprint         A blueprint to add to the bag.
  */
-void SearchTreeBag::add_blueprint(BlueprintLite & blueprint) {
+void SearchTreeBag::add_blueprint(const BlueprintLite & blueprint) {
 
-    blueprint_ID_to_bag_index[blueprint.get_id()] = bag.size();
-    bag.push_back(blueprint);
+    size_t blueprint_ID = blueprint.get_id();
+    if (blueprint_ID >= id_to_bag_index.size()) {
+        id_to_bag_index.resize(blueprint_ID + 1, NO_BLUEPRINT);
+    }
+    id_to_bag_index[blueprint_ID] = num_blueprints;
+
+    // Overwrite a blueprint left over from an earlier use of this bag, if any
+    if (num_blueprints < bag.size()) bag[num_blueprints] = blueprint;
+    else bag.push_back(blueprint);
+    bag[num_blueprints].set_id(num_blueprints);
+    num_blueprints++;
+}
+
+
+/**
+ * Apply the bans recorded while expanding this bag to its children, which
+ * were pushed onto `children` from position first_child on, in the order
+ * they were expanded on.
+ */
+void SearchTreeBag::apply_child_bans(SearchTreeStack<SearchTreeBag> & children,
+                                     size_t first_child) const {
+
+    for (auto & ban : child_bans) {
+        for (size_t position = first_child; position < children.size(); position++) {
+
+            // No need to update any bag produced by expanding on a node
+            // that comes *after* the vertex getting banned
+            if (children[position].get_expanded_vertex() >= ban.second) break;
+
+            children[position].ban_vertex_in_blueprints(ban.second, ban.first);
+        }
+    }
+}
+
+
+/**
+ * Record `child`, a child of this bag, so that it can be rebuilt later by
+ * build_planned_child instead of being kept. Children must be planned in the
+ * order they were expanded on, and after all of them have been expanded,
+ * the bans recorded with record_child_ban are final.
+ */
+void SearchTreeBag::plan_child(const SearchTreeBag & child) {
+
+    planned_vertices.push_back(child.expanded_vertex);
+    planned_offsets.push_back(planned_blueprints.size());
+
+    // The child's blueprints were added in the order of the IDs they had
+    // here, which are their indices in this bag
+    for (size_t blueprint_ID = 0; blueprint_ID < child.id_to_bag_index.size(); blueprint_ID++) {
+        if (child.id_to_bag_index[blueprint_ID] != NO_BLUEPRINT) {
+            planned_blueprints.push_back(blueprint_ID);
+        }
+    }
+}
+
+
+/**
+ * Build the next planned child of this bag into `child`: expand the planned
+ * blueprints on its vertex again, and apply the bans the other children
+ * found. Bicliques were recorded when the child was first expanded, so are
+ * not recorded again.
+ */
+void SearchTreeBag::build_planned_child(SearchTreeBag & child,
+                                        const SizeConstraints & size_constraints) {
+
+    size_t which = next_planned_child++;
+    size_t vertex = planned_vertices[which];
+    size_t end = (which + 1 < planned_vertices.size()) ? planned_offsets[which + 1]
+                                                       : planned_blueprints.size();
+
+    child.assign_child(*this, vertex);
+
+    // Every planned expansion succeeded before, so no duplicates can occur
+    const std::unordered_map<std::string,bool> no_duplicates;
+    BlueprintLite expanded(child.get_allocator());
+    for (size_t idx = planned_offsets[which]; idx < end; idx++) {
+        bag[planned_blueprints[idx]].expand(iterative, vertex, no_duplicates,
+                                            size_constraints, expanded);
+
+        size_t next_future_maximal_vertex = expanded.get_last_vertex();
+        expanded.is_currently_maximal(child.iterative, next_future_maximal_vertex);
+        expanded.set_next_future_maximal(next_future_maximal_vertex);
+
+        child.add_blueprint(expanded);
+    }
+
+    for (auto & ban : child_bans) {
+        if (vertex < ban.second) child.ban_vertex_in_blueprints(ban.second, ban.first);
+    }
 }
 
 
 /**
- * Construct a new empty SearchTreeBag with empty `bag` and `blueprint_ID_to_bag_index`.
+ * Make this bag the child of `parent` expanded on expanded_vertex, with no
+ * blueprints yet. The storage of this bag's earlier contents is reused.
+ */
+void SearchTreeBag::assign_child(const SearchTreeBag & parent, size_t expanded_vertex) {
+
+    clear();
+    iterative = parent.iterative.child(expanded_vertex);
+    this->expanded_vertex = expanded_vertex;
+}
+
+
+/**
+ * Approximate number of bytes held by this bag, counting the blueprints in
+ * it but not the storage kept for reuse.
+ */
+size_t SearchTreeBag::memory_usage() const {
+
+    size_t bytes = sizeof(SearchTreeBag) + iterative.memory_usage() +
+                   sizeof(size_t)*(id_to_bag_index.size() + planned_vertices.size() +
+                                   planned_offsets.size() + planned_blueprints.size()) +
+                   sizeof(std::pair<size_t,size_t>)*child_bans.size();
+    for (auto & blueprint : *this) bytes += blueprint.memory_usage();
+    return bytes;
+}
+
+
+/**
+ * Construct a new empty SearchTreeBag with empty `bag` and `id_to_bag_index`.
  */
 SearchTreeBag::SearchTreeBag() {
 
 }
 
 
+/**
+ * Construct a new empty SearchTreeBag whose blueprints and bookkeeping are
+ * allocated with alloc.
+ */
+SearchTreeBag::SearchTreeBag(const allocator_type & alloc) :
+                             bag(alloc),
+                             id_to_bag_index(alloc),
+                             child_bans(alloc),
+                             planned_vertices(alloc),
+                             planned_offsets(alloc),
+                             planned_blueprints(alloc) {
+
+}
+
+
 /**
  * Construct a new empty SearchTreeBag with expanded_vertex specified.
  */
 SearchTreeBag::SearchTreeBag(size_t expanded_vertex) : SearchTreeBag() {
 
-    this->bag = (std::vector<BlueprintLite>) {};
-    this->blueprint_ID_to_bag_index = (std::unordered_map<size_t,size_t>) {};
     this->expanded_vertex = expanded_vertex;
 
 }
 
 
 /**
- * Construct a new empty SearchTreeBag with expanded_vertex specified.
+ * Construct a new empty SearchTreeBag with the given iterative sets and
+ * expanded_vertex.
  */
-SearchTreeBag::SearchTreeBag(std::vector<size_t> I_wait,
-                             OrderedVertexSet I_in,
-                             std::vector<size_t> I_past,
-                             size_t expanded_vertex) : SearchTreeBag(expanded_vertex) {
+SearchTreeBag::SearchTreeBag(const std::vector<size_t> & I_wait,
+                             const OrderedVertexSet & I_in,
+                             const std::vector<size_t> & I_past,
+                             size_t expanded_vertex,
+                             const allocator_type & alloc) :
+                             SearchTreeBag(IterativeSets(I_wait, I_in, I_past),
+                                           expanded_vertex, alloc) {
+
+}
 
-    this->iterative_in = I_in;
-    this->iterative_past = I_past;
-    this->iterative_wait = I_wait;
 
-    this->iterative_wait_ptr = std::make_shared<std::vector<size_t>>(iterative_wait);
-    this->iterative_in_ptr = std::make_shared<OrderedVertexSet>(iterative_in);
-    this->iterative_past_ptr = std::make_shared<std::vector<size_t>>(iterative_past);
+/**
+ * Construct a new empty SearchTreeBag with the given iterative sets and
+ * expanded_vertex.
+ */
+SearchTreeBag::SearchTreeBag(const IterativeSets & iterative,
+                             size_t expanded_vertex,
+                             const allocator_type & alloc) : SearchTreeBag(alloc) {
+
+    this->iterative = iterative;
+    this->expanded_vertex = expanded_vertex;
 }
 
 
-void SearchTreeBag::expand_on_vertex(size_t expanded_vertex) {
-    // Add v to iterative in, update iterative_past and iterative_wait
-    iterative_in.add_vertex_unsafe(expanded_vertex);
-    for (auto u : iterative_wait) {
-        if (u < expanded_vertex ) {
-            if (!iterative_in.has_vertex(u)) iterative_past.push_back(u);
-            // It's safe to use push_back here because iterative_wait
-            // vertices must all be greater than iterative_past.
-        }
-        if (u >= expanded_vertex) break;
-    }
+/**
+ * Copy other into a bag allocated with alloc.
+ */
+SearchTreeBag::SearchTreeBag(const SearchTreeBag & other, const allocator_type & alloc) :
+                             iterative(other.iterative),
+                             bag(other.bag, alloc),
+                             num_blueprints(other.num_blueprints),
+                             id_to_bag_index(other.id_to_bag_index, alloc),
+                             expanded_vertex(other.expanded_vertex),
+                             child_bans(other.child_bans, alloc),
+                             planned_vertices(other.planned_vertices, alloc),
+                             planned_offsets(other.planned_offsets, alloc),
+                             planned_blueprints(other.planned_blueprints, alloc),
+                             next_planned_child(other.next_planned_child) {
+
+}
 
-    // Erase everything in iterative_wait up to and including expanded vertex
-    size_t index_of_v;
-    for (auto idx=0; idx < iterative_wait.size(); idx++) {
-        if (iterative_wait[idx] == expanded_vertex) {
-            index_of_v = idx;
-            break;
-        }
-        if (iterative_wait[idx] > expanded_vertex) {
-            index_of_v = iterative_wait.size();
-            break;
-        }
-    }
-    iterative_wait.erase(iterative_wait.begin(), iterative_wait.begin() + index_of_v + 1);
 
-    iterative_wait_ptr = std::make_shared<std::vector<size_t>>(iterative_wait);
-    iterative_in_ptr = std::make_shared<OrderedVertexSet>(iterative_in);
-    iterative_past_ptr = std::make_shared<std::vector<size_t>>(iterative_past);
+/**
+ * Move other into a bag allocated with alloc; its contents are copied if
+ * they were allocated elsewhere.
+ */
+SearchTreeBag::SearchTreeBag(SearchTreeBag && other, const allocator_type & alloc) :
+                             iterative(std::move(other.iterative)),
+                             bag(std::move(other.bag), alloc),
+                             num_blueprints(other.num_blueprints),
+                             id_to_bag_index(std::move(other.id_to_bag_index), alloc),
+                             expanded_vertex(other.expanded_vertex),
+                             child_bans(std::move(other.child_bans), alloc),
+                             planned_vertices(std::move(other.planned_vertices), alloc),
+                             planned_offsets(std::move(other.planned_offsets), alloc),
+                             planned_blueprints(std::move(other.planned_blueprints), alloc),
+                             next_planned_child(other.next_planned_child) {
+
+}
+
+
+/**
+ * Make this bag's iterative sets those of its child expanded on
+ * expanded_vertex, which must be in iterative_wait.
+ */
+void SearchTreeBag::expand_on_vertex(size_t expanded_vertex) {
 
+    iterative = iterative.child(expanded_vertex);
     this->expanded_vertex = expanded_vertex;
 }
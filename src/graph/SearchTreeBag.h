@@ -12,91 +12,130 @@
 #ifndef BICLIQUES_SEARCHTREEBAG_H
 #define BICLIQUES_SEARCHTREEBAG_H
 
+#include <algorithm> // for std::lower_bound
+#include <memory_resource>
+#include <utility> // for std::pair
 #include <vector>
 #include "BlueprintLite.h"
+#include "IterativeSets.h"
 #include "OrderedVertexSet.h"
+#include "SearchTreeStack.h"
 
 
 class SearchTreeBag {
 
 public:
+    // The blueprints and bookkeeping of a bag are allocated with this; see
+    // SearchTreeStack::get_allocator
+    using allocator_type = std::pmr::polymorphic_allocator<size_t>;
+
     SearchTreeBag();
+    explicit SearchTreeBag(const allocator_type & alloc);
     SearchTreeBag(size_t expanded_vertex);
-    SearchTreeBag(std::vector<size_t> I_wait,
-                  OrderedVertexSet I_in,
-                  std::vector<size_t> I_past,
-                  size_t expanded_vertex);
-
-    void add_blueprint(BlueprintLite & blueprint);
+    SearchTreeBag(const std::vector<size_t> & I_wait,
+                  const OrderedVertexSet & I_in,
+                  const std::vector<size_t> & I_past,
+                  size_t expanded_vertex,
+                  const allocator_type & alloc = allocator_type());
+    SearchTreeBag(const IterativeSets & iterative,
+                  size_t expanded_vertex,
+                  const allocator_type & alloc = allocator_type());
+    SearchTreeBag(const SearchTreeBag & other) = default;
+    SearchTreeBag(SearchTreeBag && other) = default;
+    SearchTreeBag(const SearchTreeBag & other, const allocator_type & alloc);
+    SearchTreeBag(SearchTreeBag && other, const allocator_type & alloc);
+    SearchTreeBag & operator=(const SearchTreeBag & other) = default;
+    SearchTreeBag & operator=(SearchTreeBag && other) = default;
+
+    inline allocator_type get_allocator() const { return bag.get_allocator(); }
+
+    void add_blueprint(const BlueprintLite & blueprint);
     void expand_on_vertex(size_t expanded_vertex);
+    void assign_child(const SearchTreeBag & parent, size_t expanded_vertex);
 
     bool ban_vertex_in_blueprints(const size_t & vertex_to_ban,
                                   const size_t & blueprint_ID);
 
-    inline size_t size() const { return bag.size(); }
+    // Bans found while expanding this bag, to be passed to its children
+    inline void record_child_ban(size_t blueprint_ID, size_t vertex_to_ban) {
+        child_bans.emplace_back(blueprint_ID, vertex_to_ban);
+    }
+    void apply_child_bans(SearchTreeStack<SearchTreeBag> & children, size_t first_child) const;
 
-    inline const BlueprintLite & front() const { return bag.front(); }
-    inline const BlueprintLite & back() const { return bag.back(); }
-    inline BlueprintLite & back() { return bag.back(); }
-    inline void pop_back() { bag.pop_back(); }
+    // Expanding this bag one child at a time
+    void plan_child(const SearchTreeBag & child);
+    inline bool has_planned_child() const {
+        return next_planned_child < planned_vertices.size();
+    }
+    void build_planned_child(SearchTreeBag & child, const SizeConstraints & size_constraints);
 
+    size_t memory_usage() const;
+
+    inline size_t size() const { return num_blueprints; }
+
+    inline const BlueprintLite & front() const { return bag.front(); }
+    inline const BlueprintLite & back() const { return bag[num_blueprints - 1]; }
+    inline BlueprintLite & back() { return bag[num_blueprints - 1]; }
+    inline void pop_back() { num_blueprints--; }
+
+    /**
+     * Empty the bag. Blueprints past size() are kept so that the storage of
+     * their sets is reused by the blueprints added next.
+     */
     inline void clear() {
-        iterative_in.clear();
-        iterative_wait.clear();
-        iterative_past.clear();
-        bag.clear();
-        blueprint_ID_to_bag_index.clear();
+        iterative = IterativeSets();
+        num_blueprints = 0;
+        id_to_bag_index.clear();
+        child_bans.clear();
+        planned_vertices.clear();
+        planned_offsets.clear();
+        planned_blueprints.clear();
+        next_planned_child = 0;
     }
 
     // define pieces for iterator
-    inline std::vector<BlueprintLite>::iterator begin() {return bag.begin();}
-    inline std::vector<BlueprintLite>::iterator end() {return bag.end();}
+    inline std::pmr::vector<BlueprintLite>::iterator begin() {return bag.begin();}
+    inline std::pmr::vector<BlueprintLite>::iterator end() {return bag.begin() + num_blueprints;}
 
-    inline std::vector<BlueprintLite>::const_iterator begin() const {return bag.begin();};
-    inline std::vector<BlueprintLite>::const_iterator end() const {return bag.end();};
+    inline std::pmr::vector<BlueprintLite>::const_iterator begin() const {return bag.begin();};
+    inline std::pmr::vector<BlueprintLite>::const_iterator end() const {return bag.begin() + num_blueprints;};
 
     inline size_t get_expanded_vertex() const {
         return this->expanded_vertex;
     }
 
-    inline OrderedVertexSet& get_iterative_in() {
-        return this->iterative_in;
-    }
-
-    inline std::vector<size_t>& get_iterative_wait() {
-        return this->iterative_wait;
-    }
-
-    inline std::vector<size_t>& get_iterative_past() {
-        return this->iterative_past;
-    }
-
-    inline std::shared_ptr<std::vector<size_t>> & get_iterative_wait_ptr() {
-        return iterative_wait_ptr;
+    // The iterative sets shared by the blueprints of this bag
+    inline const IterativeSets & get_iterative() const {
+        return iterative;
     }
 
-    inline std::shared_ptr<OrderedVertexSet> & get_iterative_in_ptr() {
-        return iterative_in_ptr;
-    }
-
-    inline std::shared_ptr<std::vector<size_t>> & get_iterative_past_ptr() {
-        return iterative_past_ptr;
+    inline IterativeSets::Slice get_iterative_wait() const {
+        return iterative.get_wait();
     }
 
     inline size_t get_last_iter_in_node() const {
-        return iterative_in.back();
+        return iterative.get_last_in();
     }
 
 private:
-    std::shared_ptr<OrderedVertexSet> iterative_in_ptr;
-    std::shared_ptr<std::vector<size_t>> iterative_wait_ptr, iterative_past_ptr;
+    IterativeSets iterative;
+
+    std::pmr::vector<BlueprintLite> bag;
+    size_t num_blueprints = 0;
+    // Bag index of each blueprint by the id it had when added, which is its
+    // index in the bag it was expanded from; NO_BLUEPRINT if none
+    static constexpr size_t NO_BLUEPRINT = size_t(-1);
+    std::pmr::vector<size_t> id_to_bag_index;
+    size_t expanded_vertex;
 
-    OrderedVertexSet iterative_in;
-    std::vector<size_t> iterative_wait, iterative_past;
+    // Bans among the children of this bag: (blueprint ID, vertex) pairs, each
+    // applying to the children expanded on vertices before the banned one
+    std::pmr::vector<std::pair<size_t,size_t>> child_bans;
 
-    std::vector<BlueprintLite> bag;
-    std::unordered_map<size_t,size_t> blueprint_ID_to_bag_index;
-    size_t expanded_vertex;
+    // Children to build one at a time: for each, the vertex it is expanded
+    // on and, from planned_offsets[i], the blueprints that expand into it
+    std::pmr::vector<size_t> planned_vertices, planned_offsets, planned_blueprints;
+    size_t next_planned_child = 0;
 
 };
 
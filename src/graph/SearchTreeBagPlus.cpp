@@ -19,6 +19,53 @@ SearchTreeBagPlus::SearchTreeBagPlus() {
 }
 
 
+/**
+ * Construct a new empty SearchTreeBagPlus whose sets are allocated with alloc.
+ */
+SearchTreeBagPlus::SearchTreeBagPlus(const allocator_type & alloc) :
+                                     iterative_in(alloc),
+                                     iterative_wait(alloc),
+                                     iterative_past(alloc),
+                                     completely_connected_in(alloc) {
+
+}
+
+
+/**
+ * Copy other into a bag whose sets are allocated with alloc.
+ */
+SearchTreeBagPlus::SearchTreeBagPlus(const SearchTreeBagPlus & other,
+                                     const allocator_type & alloc) :
+                                     iterative_in(other.iterative_in, alloc),
+                                     iterative_wait(other.iterative_wait, alloc),
+                                     iterative_past(other.iterative_past, alloc),
+                                     completely_connected_in(other.completely_connected_in, alloc),
+                                     graph_ptr(other.graph_ptr),
+                                     expanded_vertex(other.expanded_vertex),
+                                     children_one_at_a_time(other.children_one_at_a_time),
+                                     next_child(other.next_child) {
+
+}
+
+
+/**
+ * Move other into a bag whose sets are allocated with alloc; the sets are
+ * copied if other's were allocated elsewhere.
+ */
+SearchTreeBagPlus::SearchTreeBagPlus(SearchTreeBagPlus && other,
+                                     const allocator_type & alloc) :
+                                     iterative_in(std::move(other.iterative_in), alloc),
+                                     iterative_wait(std::move(other.iterative_wait), alloc),
+                                     iterative_past(std::move(other.iterative_past), alloc),
+                                     completely_connected_in(std::move(other.completely_connected_in), alloc),
+                                     graph_ptr(std::move(other.graph_ptr)),
+                                     expanded_vertex(other.expanded_vertex),
+                                     children_one_at_a_time(other.children_one_at_a_time),
+                                     next_child(other.next_child) {
+
+}
+
+
 /**
  * Construct a new empty SearchTreeBagPlus with expanded_vertex specified.
  */
@@ -37,13 +84,14 @@ SearchTreeBagPlus::SearchTreeBagPlus(std::shared_ptr<Graph> graph_ptr,
                                      std::vector<size_t> I_wait,
                                      std::vector<size_t> I_in,
                                      std::vector<size_t> I_past,
-                                     size_t expanded_vertex)
+                                     size_t expanded_vertex,
+                                     const allocator_type & alloc)
                                      :
+                                     iterative_in(I_in.begin(), I_in.end(), alloc),
+                                     iterative_wait(I_wait.begin(), I_wait.end(), alloc),
+                                     iterative_past(I_past.begin(), I_past.end(), alloc),
+                                     completely_connected_in(CC_in.begin(), CC_in.end(), alloc),
                                      graph_ptr(graph_ptr),
-                                     completely_connected_in(CC_in),
-                                     iterative_wait(I_wait),
-                                     iterative_in(I_in),
-                                     iterative_past(I_past),
                                      expanded_vertex(expanded_vertex){
     // do nothing else
 
@@ -55,9 +103,15 @@ SearchTreeBagPlus::SearchTreeBagPlus(std::shared_ptr<Graph> graph_ptr,
  * the remaining sets are updated to remain consistent with the change to
  * iterative_in, and the updated object is checked to see if it's a maximal
  * induced biclique. See BlueprintLite::expand() for a more detailed
- * explanation of a very similar function.
+ * explanation of a very similar function, including the pruning performed
+ * when size_constraints is active.
  */
-bool SearchTreeBagPlus::expand(const size_t expanded_vertex) {
+bool SearchTreeBagPlus::expand(const size_t expanded_vertex,
+                               const SizeConstraints & size_constraints) {
+
+    // This bag is now a child, whose own children have not been started
+    children_one_at_a_time = false;
+    next_child = 0;
 
     // Get neighbors of expanded_vertex
     const OrderedVertexSet & neighbors = graph_ptr->get_neighbors(expanded_vertex);
@@ -80,6 +134,19 @@ bool SearchTreeBagPlus::expand(const size_t expanded_vertex) {
         return false;
     }
 
+    // If the sides can no longer meet the size constraints, STOP
+    if (size_constraints.is_active()) {
+        size_t left_lower = iterative_in.size() + 1;
+        size_t left_upper = left_lower + (iterative_wait.end() -
+                                          std::upper_bound(iterative_wait.begin(),
+                                                           iterative_wait.end(),
+                                                           expanded_vertex));
+        if (!size_constraints.can_satisfy(left_lower, left_upper,
+                                          1, completely_connected_in.size())) {
+            return false;
+        }
+    }
+
     // If any node in iter_past can be added left, this biclique found elsewhere
     if (can_be_added_left(iterative_past)) {
         return false;
@@ -97,7 +164,7 @@ bool SearchTreeBagPlus::expand(const size_t expanded_vertex) {
     // IF WE PASS THIS POINT --- SUCCESSFUL EXPAND: update iterative sets
 
     // Add expanded_vertex to iterative in, update iterative_past
-    std::vector<size_t> merge_with_iter_in;
+    std::pmr::vector<size_t> merge_with_iter_in(get_allocator());
     merge_with_iter_in.push_back(expanded_vertex);
     size_t index_of_v = 0;
     for (const size_t u : iterative_wait) {
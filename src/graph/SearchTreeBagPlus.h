@@ -14,35 +14,92 @@
 
 #include "BicliqueLite.h"
 #include "Graph.h"
+#include "SizeConstraints.h"
 #include <algorithm> // for std::sort
 #include <memory> // for std::shared_ptr
+#include <memory_resource>
 #include "stddef.h"  // apparently required for size_t
 
 class SearchTreeBagPlus {
 
 public:
+    // The sets of a bag are allocated with this; see
+    // SearchTreeStack::get_allocator
+    using allocator_type = std::pmr::polymorphic_allocator<size_t>;
+
     SearchTreeBagPlus();
+    explicit SearchTreeBagPlus(const allocator_type & alloc);
     SearchTreeBagPlus(size_t expanded_vertex);
     SearchTreeBagPlus(std::shared_ptr<Graph> graph_ptr,
                       std::vector<size_t> CC_in,
                       std::vector<size_t> I_wait,
                       std::vector<size_t> I_in,
                       std::vector<size_t> I_past,
-                      size_t expanded_vertex);
+                      size_t expanded_vertex,
+                      const allocator_type & alloc = allocator_type());
+    SearchTreeBagPlus(const SearchTreeBagPlus & other) = default;
+    SearchTreeBagPlus(SearchTreeBagPlus && other) = default;
+    SearchTreeBagPlus(const SearchTreeBagPlus & other, const allocator_type & alloc);
+    SearchTreeBagPlus(SearchTreeBagPlus && other, const allocator_type & alloc);
+    SearchTreeBagPlus & operator=(const SearchTreeBagPlus & other) = default;
+    SearchTreeBagPlus & operator=(SearchTreeBagPlus && other) = default;
+
+    inline allocator_type get_allocator() const { return iterative_wait.get_allocator(); }
 
-    bool expand(const size_t expanded_vertex);
+    bool expand(const size_t expanded_vertex,
+                const SizeConstraints & size_constraints = SizeConstraints());
+
+    /**
+     * Check whether this bag, or any bag expanded from it, could hold a
+     * biclique meeting the size constraints. The left side lies within
+     * iterative_in and iterative_wait; the right side within CC_in.
+     */
+    inline bool can_satisfy(const SizeConstraints & size_constraints) const {
+        if (!size_constraints.is_active()) return true;
+        return size_constraints.can_satisfy(iterative_in.size(),
+                                            iterative_in.size() + iterative_wait.size(),
+                                            1, completely_connected_in.size());
+    }
 
     // CC_in is always sorted; iterative_in might not be
     inline BicliqueLite get_biclique(){
-        return BicliqueLite(iterative_in, completely_connected_in);
+        return BicliqueLite(std::vector<size_t>(iterative_in.begin(), iterative_in.end()),
+                            std::vector<size_t>(completely_connected_in.begin(),
+                                                completely_connected_in.end()));
     }
 
-    inline const std::vector<size_t> & get_iterative_wait() const {
+    // Side sizes of get_biclique(), without building it
+    inline size_t get_left_size() const { return iterative_in.size(); }
+    inline size_t get_right_size() const { return completely_connected_in.size(); }
+
+    inline const std::pmr::vector<size_t> & get_iterative_wait() const {
         return iterative_wait;
     }
 
     inline size_t get_expanded_vertex() { return expanded_vertex; }
 
+    /**
+     * Expand this bag one child at a time: the vertices of iterative_wait
+     * are taken in order with next_child_vertex. Returns false if there are
+     * none. Expanding a copy of the bag clears this.
+     */
+    inline bool start_children_one_at_a_time() {
+        children_one_at_a_time = true;
+        next_child = 0;
+        return has_next_child();
+    }
+    inline bool has_next_child() const {
+        return children_one_at_a_time && next_child < iterative_wait.size();
+    }
+    inline size_t next_child_vertex() { return iterative_wait[next_child++]; }
+
+    // Approximate number of bytes held by this bag
+    inline size_t memory_usage() const {
+        return sizeof(SearchTreeBagPlus) +
+               sizeof(size_t)*(iterative_in.size() + iterative_wait.size() +
+                               iterative_past.size() + completely_connected_in.size());
+    }
+
 
 private:
 
@@ -56,7 +113,7 @@ private:
      * @param  s Set of vertices to check to be added to the left side of the Biclique.
      * @return   True if any vertex can be added, false if not.
      */
-    inline bool can_be_added_left(const std::vector<size_t> &s) const {
+    inline bool can_be_added_left(const std::pmr::vector<size_t> &s) const {
         // empty set can trivially be added, but is irrelevant, return false
         if (s.size() == 0) return false;
         for (const size_t v : s) {
@@ -67,13 +124,16 @@ private:
         return false;
     }
 
-    std::vector<size_t> iterative_in, iterative_wait, iterative_past;
-    std::vector<size_t> completely_connected_in;
+    std::pmr::vector<size_t> iterative_in, iterative_wait, iterative_past;
+    std::pmr::vector<size_t> completely_connected_in;
 
     std::shared_ptr<Graph> graph_ptr;
 
     size_t expanded_vertex;
 
+    bool children_one_at_a_time = false;
+    size_t next_child = 0;
+
 };
 
 
@@ -0,0 +1,130 @@
+/**
+ * SearchTreeStack holds the bags still to be expanded in a depth-first walk
+ * of a search tree, top last, in one contiguous vector.
+ *
+ * Bags are swapped on and off the stack rather than copied. A popped slot
+ * keeps the storage of the bag it held, and the next bag pushed swaps that
+ * storage out to the caller, who overwrites it in place for the bag after;
+ * so once the stack has reached its working depth, building and stacking a
+ * bag reuses vectors that are already large enough.
+ *
+ * The stack owns the SearchTreeArena its bags allocate from. Bags to be
+ * pushed must be made with get_allocator(), so that swapping them with the
+ * stack's slots exchanges storage instead of copying it; a bag from another
+ * arena is copied into this one when pushed, which is how bags are handed
+ * to another task.
+ *
+ * The stack also tracks the memory held by the bags on it (as reported by
+ * Bag::memory_usage() when each is pushed), so that the search trees can
+ * switch to building children one at a time when it grows too large, and
+ * the most held at once by the stack and the bag being expanded.
+ *
+ * @authors Eric Horton, Kyle Kloster, Drew van der Poel
+ *
+ * This file is part of MI-bicliques, https://github.com/TheoryInPractice/MI-bicliques,
+ * and is Copyright (C) North Carolina State University, 2018.
+ * It is licensed under the three-clause BSD license; see LICENSE.
+ */
+
+#ifndef BICLIQUES_SEARCHTREESTACK_H
+#define BICLIQUES_SEARCHTREESTACK_H
+
+#include <algorithm> // for std::reverse, std::max
+#include <memory_resource>
+#include <utility> // for std::swap
+#include <vector>
+#include "SearchTreeArena.h"
+#include "stddef.h"  // apparently required for size_t
+
+
+template <class Bag>
+class SearchTreeStack {
+
+public:
+
+    SearchTreeStack() : bags(&arena) {}
+
+    SearchTreeStack(const SearchTreeStack &) = delete;
+    SearchTreeStack & operator=(const SearchTreeStack &) = delete;
+
+    // For bags and blueprints that are to be pushed onto this stack
+    inline typename Bag::allocator_type get_allocator() {
+        return typename Bag::allocator_type(&arena);
+    }
+    inline const SearchTreeArena & get_arena() const { return arena; }
+
+    /**
+     * Put bag on top of the stack. bag is left holding the storage of an
+     * earlier popped bag (or is empty), to be overwritten by the caller.
+     */
+    void push(Bag & bag) {
+        if (depth == bags.size()) {
+            bags.emplace_back();
+            bag_bytes.push_back(0);
+        }
+        using std::swap;
+        swap(bags[depth], bag);
+        bag_bytes[depth] = bags[depth].memory_usage();
+        memory += bag_bytes[depth];
+        peak_memory = std::max(peak_memory, memory);
+        depth++;
+    }
+
+    /**
+     * Take the top bag off the stack into bag, whose old contents stay in
+     * the stack's storage for reuse.
+     */
+    void pop(Bag & bag) {
+        using std::swap;
+        swap(bags[depth - 1], bag);
+        pop();
+    }
+
+    // Drop the top bag, keeping its storage for reuse
+    void pop() {
+        depth--;
+        memory -= bag_bytes[depth];
+    }
+
+    /**
+     * Reverse the order of the bags from position `first` to the top, so
+     * that bags pushed in the order they are to be expanded in come off the
+     * stack in that order.
+     */
+    void reverse(size_t first) {
+        std::reverse(bags.begin() + first, bags.begin() + depth);
+        std::reverse(bag_bytes.begin() + first, bag_bytes.begin() + depth);
+    }
+
+    inline Bag & top() { return bags[depth - 1]; }
+    inline Bag & operator[](size_t position) { return bags[position]; }
+    inline const Bag & operator[](size_t position) const { return bags[position]; }
+
+    inline size_t size() const { return depth; }
+    inline bool empty() const { return depth == 0; }
+
+    /**
+     * Count a bag held outside the stack, such as the one whose children
+     * have just been pushed, towards the peak memory usage.
+     */
+    void note_held(size_t bytes) {
+        peak_memory = std::max(peak_memory, memory + bytes);
+    }
+
+    // Bytes held by the bags on the stack, now and at most so far
+    inline size_t memory_usage() const { return memory; }
+    inline size_t peak_memory_usage() const { return peak_memory; }
+
+private:
+    // Declared first, so that it outlives the bags allocated from it
+    SearchTreeArena arena;
+    std::pmr::vector<Bag> bags;
+    std::vector<size_t> bag_bytes;
+    size_t depth = 0;
+    size_t memory = 0;
+    size_t peak_memory = 0;
+
+};
+
+
+#endif //BICLIQUES_SEARCHTREESTACK_H
@@ -0,0 +1,92 @@
+/**
+ * SizeConstraints bundles lower and upper bounds on the two sides of the
+ * bicliques a caller is interested in. Bicliques are unordered pairs of sides,
+ * so a biclique satisfies the constraints if either orientation of its sides
+ * fits inside [min_left, max_left] x [min_right, max_right].
+ *
+ * @authors Eric Horton, Kyle Kloster, Drew van der Poel
+ *
+ * This file is part of MI-bicliques, https://github.com/TheoryInPractice/MI-bicliques,
+ * and is Copyright (C) North Carolina State University, 2018.
+ * It is licensed under the three-clause BSD license; see LICENSE.
+ */
+
+#ifndef BICLIQUES_SIZECONSTRAINTS_H
+#define BICLIQUES_SIZECONSTRAINTS_H
+
+#include <algorithm> // for std::min, std::max
+#include <limits>
+#include "stddef.h"  // apparently required for size_t
+#include "BicliqueLite.h"
+
+class SizeConstraints {
+
+public:
+    size_t min_left = 1;
+    size_t min_right = 1;
+    size_t max_left = std::numeric_limits<size_t>::max();
+    size_t max_right = std::numeric_limits<size_t>::max();
+
+    // Number of vertices that may still join the first side of a partial
+    // biclique after the search being pruned is over (see relax_first_side).
+    size_t first_side_slack = 0;
+
+    /**
+     * True if any bound is tighter than what every biclique trivially meets.
+     */
+    inline bool is_active() const {
+        return (min_left > 1 || min_right > 1 ||
+                max_left != std::numeric_limits<size_t>::max() ||
+                max_right != std::numeric_limits<size_t>::max());
+    }
+
+    /**
+     * Every vertex of a qualifying biclique is adjacent to a whole side, so it
+     * has degree at least the smaller of the two lower bounds. Returns 0 when
+     * the constraints are inactive, so that callers peel no vertices at all.
+     */
+    inline size_t min_degree() const {
+        if (!is_active()) return 0;
+        return std::min(min_left, min_right);
+    }
+
+    /**
+     * Check whether some biclique with one side of size in [lo_a, hi_a] and
+     * the other of size in [lo_b, hi_b] could satisfy the constraints.
+     * Used to prune partial bicliques whose sides are only known up to bounds.
+     */
+    inline bool can_satisfy(size_t lo_a, size_t hi_a,
+                            size_t lo_b, size_t hi_b) const {
+        hi_a += first_side_slack;
+        return ( (hi_a >= min_left && lo_a <= max_left &&
+                  hi_b >= min_right && lo_b <= max_right) ||
+                 (hi_a >= min_right && lo_a <= max_right &&
+                  hi_b >= min_left && lo_b <= max_left) );
+    }
+
+    /**
+     * Constraints for a sub-search whose bicliques are later extended by up to
+     * `slack` vertices on the first side (and may lose vertices there), as
+     * OCT-MIB does with the crossing bicliques found by MCB. Lower bounds on
+     * the first side are relaxed by `slack`; upper bounds no longer apply.
+     */
+    inline SizeConstraints relax_first_side(size_t slack) const {
+        SizeConstraints relaxed;
+        relaxed.min_left = min_left;
+        relaxed.min_right = min_right;
+        relaxed.first_side_slack = slack;
+        return relaxed;
+    }
+
+    inline bool is_satisfied_by(size_t size_a, size_t size_b) const {
+        return can_satisfy(size_a, size_a, size_b, size_b);
+    }
+
+    inline bool is_satisfied_by(const BicliqueLite & b) const {
+        return is_satisfied_by(b.get_left().size(), b.get_right().size());
+    }
+
+};
+
+
+#endif //BICLIQUES_SIZECONSTRAINTS_H
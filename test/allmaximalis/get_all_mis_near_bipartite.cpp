@@ -0,0 +1,82 @@
+/**
+* @authors Eric Horton, Kyle Kloster, Drew van der Poel
+*
+* This file is part of MI-bicliques, https://github.com/TheoryInPractice/MI-bicliques,
+* and is Copyright (C) North Carolina State University, 2018.
+* It is licensed under the three-clause BSD license; see LICENSE.
+*/
+
+#include<algorithm>
+#include<iostream>
+#include<string>
+#include<unordered_map>
+#include<vector>
+#include"../../src/graph/Graph.h"
+#include"../../src/graph/OrderedVertexSet.h"
+#include"../../src/algorithms/AllMaximalIndependentSets.h"
+#include"../../src/algorithms/MISCache.h"
+#include"../../src/algorithms/NearBipartiteMIS.h"
+#include"../../src/algorithms/OCTDecomposition.h"
+
+/**
+ * Test NearBipartiteMIS::get_all_mis_near_bipartite -- that it finds the same
+ * sets as get_all_mis in the neighborhood of every OCT vertex, with and
+ * without an MISCache, and in a whole 5-cycle.
+ */
+int test_allmaximalis_get_all_mis_near_bipartite(int argc, char ** argv) {
+
+    // Whether or not an error has occurred.
+    bool error = false;
+
+    std::vector<std::string> paths = {"./test/test_graph.txt",
+                                      "./test/test_multi_ccs.txt",
+                                      "./test/test_graph_delay_conditions.txt",
+                                      "./test/test_graph_large.txt",
+                                      "./test/test_graph_mcb_huge.txt"};
+
+    for (auto & path : paths) {
+        Graph g(path, Graph::FILE_FORMAT::adjlist);
+        OrderedVertexSet oct_set, left_partition, right_partition;
+        octdecomposition(g, oct_set, left_partition, right_partition, OCTSearchOptions());
+        MISCache mis_cache(g, 1 << 20);
+
+        for (size_t v : oct_set) {
+            std::vector<size_t> neighbors = g.get_neighbors_vector(v);
+            auto expected = get_all_mis(g, neighbors);
+            std::sort(expected.begin(), expected.end());
+
+            // Twice with the cache, so the second is answered from it
+            for (MISCache * cache : {(MISCache *) nullptr, &mis_cache, &mis_cache}) {
+                auto found = get_all_mis_near_bipartite(g, neighbors, oct_set, left_partition, cache);
+                std::sort(found.begin(), found.end());
+                if (found != expected) {
+                    std::cout << "get_all_mis_near_bipartite found " << found.size();
+                    std::cout << " sets in the neighborhood of " << v << " in " << path;
+                    std::cout << " instead of " << expected.size() << std::endl;
+                    error = true;
+                }
+            }
+        }
+    }
+
+    // The 5-cycle 0-1-2-3-4, with OCT set {0}, left side {1, 3}, right {2, 4}
+    std::vector<std::vector<size_t>> adj_list = { {1,4}, {0,2}, {1,3}, {2,4}, {0,3} };
+    std::unordered_map<size_t,std::string> node_labels = {
+        {0, "0"}, {1, "1"}, {2, "2"}, {3, "3"}, {4, "4"}
+    };
+    Graph cycle(std::vector<size_t>({0, 1, 2, 3, 4}), adj_list, node_labels);
+    std::vector<size_t> all_vertices = {0, 1, 2, 3, 4};
+    auto found = get_all_mis_near_bipartite(cycle, all_vertices,
+                                            OrderedVertexSet(std::vector<size_t>({0})),
+                                            OrderedVertexSet(std::vector<size_t>({1, 3})));
+    std::sort(found.begin(), found.end());
+    std::vector<std::vector<size_t>> expected = { {0,2}, {0,3}, {1,3}, {1,4}, {2,4} };
+    if (found != expected) {
+        std::cout << "get_all_mis_near_bipartite found " << found.size();
+        std::cout << " sets in a 5-cycle instead of 5" << std::endl;
+        error = true;
+    }
+
+    return error;
+
+}
@@ -0,0 +1,68 @@
+/**
+* @authors Eric Horton, Kyle Kloster, Drew van der Poel
+*
+* This file is part of MI-bicliques, https://github.com/TheoryInPractice/MI-bicliques,
+* and is Copyright (C) North Carolina State University, 2018.
+* It is licensed under the three-clause BSD license; see LICENSE.
+*/
+
+#include<algorithm>
+#include<iostream>
+#include<memory>
+#include<string>
+#include<unordered_map>
+#include<vector>
+#include"../../src/graph/Graph.h"
+#include"../../src/graph/OrderedVertexSet.h"
+#include"../../src/graph/EditableGraph.h"
+#include"../../src/algorithms/AllMaximalIndependentSets.h"
+#include"../../src/algorithms/OCTDecomposition.h"
+
+/**
+ * Test AllMaximalIndependentSets::get_all_mis against recursive_eppstein,
+ * which copies its EditableGraph at each branch: both must find the same
+ * sets, in the OCT subgraph and in the neighborhood of every OCT vertex of
+ * each test graph, as OCT-MIB enumerates them, and in each whole graph.
+ */
+int test_allmaximalis_get_all_mis_reference(int argc, char ** argv) {
+
+    // Whether or not an error has occurred.
+    bool error = false;
+
+    std::vector<std::string> paths = {"./test/test_graph.txt",
+                                      "./test/test_disconnected_graph.txt",
+                                      "./test/test_multi_ccs.txt",
+                                      "./test/test_graph_delay_conditions.txt",
+                                      "./test/test_graph_large.txt",
+                                      "./test/test_graph_mcb_huge.txt"};
+
+    for (auto & path : paths) {
+        Graph g(path, Graph::FILE_FORMAT::adjlist);
+        OrderedVertexSet oct_set, left_partition, right_partition;
+        octdecomposition(g, oct_set, left_partition, right_partition, OCTSearchOptions());
+
+        std::vector<Graph> subgraphs = {g, g.subgraph(oct_set.get_vertices())};
+        for (size_t v : oct_set) subgraphs.push_back(g.subgraph(g.get_neighbors_vector(v)));
+
+        for (auto & subgraph : subgraphs) {
+            std::vector<std::vector<size_t>> expected;
+            EditableGraph ed_graph(subgraph);
+            std::unordered_map<size_t,bool> independent_set;
+            recursive_eppstein(std::make_shared<Graph>(subgraph), expected, ed_graph,
+                               independent_set, subgraph.get_num_vertices());
+            std::sort(expected.begin(), expected.end());
+
+            auto found = get_all_mis(subgraph);
+            std::sort(found.begin(), found.end());
+            if (found != expected) {
+                std::cout << "get_all_mis found " << found.size() << " sets in a subgraph of ";
+                std::cout << path << " on " << subgraph.get_num_vertices();
+                std::cout << " vertices instead of " << expected.size() << std::endl;
+                error = true;
+            }
+        }
+    }
+
+    return error;
+
+}
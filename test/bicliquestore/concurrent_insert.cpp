@@ -0,0 +1,66 @@
+/**
+* @authors Eric Horton, Kyle Kloster, Drew van der Poel
+*
+* This file is part of MI-bicliques, https://github.com/TheoryInPractice/MI-bicliques,
+* and is Copyright (C) North Carolina State University, 2018.
+* It is licensed under the three-clause BSD license; see LICENSE.
+*/
+
+#include<atomic>
+#include<iostream>
+#include<thread>
+#include<vector>
+#include"../../src/graph/BicliqueLite.h"
+#include"../../src/graph/BicliqueStore.h"
+
+/**
+ * Test a sharded BicliqueStore used from several threads at once. Every
+ * thread inserts the same bicliques, half of them the other way round, so
+ * each biclique must be reported new by exactly one thread.
+ */
+int test_bicliquestore_concurrent_insert(int argc, char ** argv) {
+
+    // Whether or not an error has occurred.
+    bool error = false;
+
+    const size_t num_threads = 4;
+    // Multipliers coprime to num_bicliques, so each thread visits every biclique
+    const size_t multipliers[num_threads] = {1, 3, 7, 9};
+    const size_t num_bicliques = 20000;
+    BicliqueStore store(100, 16);
+
+    std::vector<std::atomic<size_t>> times_new(num_bicliques);
+    for (auto & count : times_new) count = 0;
+
+    std::vector<std::thread> threads;
+    for (size_t thread_idx = 0; thread_idx < num_threads; thread_idx++) {
+        threads.emplace_back([&, thread_idx] {
+            for (size_t step = 0; step < num_bicliques; step++) {
+                // Threads walk the bicliques in different orders
+                size_t idx = (step*multipliers[thread_idx]) % num_bicliques;
+                std::vector<size_t> left = {idx, idx + 1}, right = {idx + 2};
+                BicliqueLite b = (thread_idx % 2 == 0) ? BicliqueLite(left, right) :
+                                                         BicliqueLite(right, left);
+                if (store.insert(b)) times_new[idx]++;
+            }
+        });
+    }
+    for (auto & thread : threads) thread.join();
+
+    for (size_t idx = 0; idx < num_bicliques; idx++) {
+        if (times_new[idx] != 1) {
+            std::cout << "Biclique " << idx << " reported new " << times_new[idx];
+            std::cout << " times" << std::endl;
+            error = true;
+        }
+    }
+
+    if (store.size() != num_bicliques) {
+        std::cout << "Store has size " << store.size() << " instead of ";
+        std::cout << num_bicliques << std::endl;
+        error = true;
+    }
+
+    return error;
+
+}
@@ -0,0 +1,81 @@
+/**
+* @authors Eric Horton, Kyle Kloster, Drew van der Poel
+*
+* This file is part of MI-bicliques, https://github.com/TheoryInPractice/MI-bicliques,
+* and is Copyright (C) North Carolina State University, 2018.
+* It is licensed under the three-clause BSD license; see LICENSE.
+*/
+
+#include<iostream>
+#include<vector>
+#include"../../src/graph/BicliqueLite.h"
+#include"../../src/graph/BicliqueStore.h"
+
+/**
+ * Test BicliqueStore::insert and BicliqueStore::contains. The store starts
+ * out small, so it grows several times along the way; every biclique must be
+ * reported new exactly once, either way round, and found afterwards, and
+ * bicliques never inserted must not be found, even those with the same
+ * vertices split differently between the sides.
+ */
+int test_bicliquestore_insert(int argc, char ** argv) {
+
+    // Whether or not an error has occurred.
+    bool error = false;
+
+    const size_t num_bicliques = 20000;
+    BicliqueStore store;
+
+    // Biclique idx has left side {idx, ..., idx + idx % 5} and right side
+    // the next idx % 7 + 1 vertices
+    auto make_biclique = [](size_t idx) {
+        std::vector<size_t> left, right;
+        size_t v = idx;
+        for (size_t count = 0; count <= idx % 5; count++) left.push_back(v++);
+        for (size_t count = 0; count <= idx % 7; count++) right.push_back(v++);
+        return BicliqueLite(left, right);
+    };
+
+    for (size_t idx = 0; idx < num_bicliques; idx++) {
+        if (!store.insert(make_biclique(idx))) {
+            std::cout << "Biclique " << idx << " reported as a duplicate on first insert" << std::endl;
+            error = true;
+        }
+    }
+
+    for (size_t idx = 0; idx < num_bicliques; idx++) {
+        BicliqueLite b = make_biclique(idx);
+        BicliqueLite reversed(b.get_right(), b.get_left());
+        if (store.insert(b) || store.insert(reversed)) {
+            std::cout << "Biclique " << idx << " reported as new on second insert" << std::endl;
+            error = true;
+        }
+        if (!store.contains(b) || !store.contains(reversed)) {
+            std::cout << "Biclique " << idx << " not found" << std::endl;
+            error = true;
+        }
+    }
+
+    if (store.size() != num_bicliques) {
+        std::cout << "Store has size " << store.size() << " instead of ";
+        std::cout << num_bicliques << std::endl;
+        error = true;
+    }
+
+    // The same vertices with one more on the left are not found
+    for (size_t idx = 0; idx < num_bicliques; idx++) {
+        BicliqueLite b = make_biclique(idx);
+        if (b.get_right().size() < 2) continue;
+        std::vector<size_t> left = b.get_left(), right = b.get_right();
+        left.push_back(right.front());
+        right.erase(right.begin());
+        if (store.contains(BicliqueLite(left, right))) {
+            std::cout << "Biclique " << BicliqueLite(left, right).to_string();
+            std::cout << " found but never inserted" << std::endl;
+            error = true;
+        }
+    }
+
+    return error;
+
+}
@@ -44,12 +44,11 @@ int test_blueprintlite_constructor(int argc, char ** argv) {
     std::vector<size_t> independent_from_out( {5,6} );
     std::vector<size_t> oct_auxiliary_independent_set;
 
+    IterativeSets iterative(iterative_wait, iterative_in, iterative_past);
+
     BlueprintLite test_blueprint(
                                  biclique_blueprint_id,
                                  graph_ptr,
-                                 std::make_shared<std::vector<size_t>>(iterative_wait),
-                                 std::make_shared<OrderedVertexSet>(iterative_in),
-                                 std::make_shared<std::vector<size_t>>(iterative_past),
                                  completely_connected_in,
                                  completely_connected_out,
                                  independent_from_in,
@@ -57,9 +56,9 @@ int test_blueprintlite_constructor(int argc, char ** argv) {
                                  oct_auxiliary_independent_set
                                 );
 
-    // Test get_biclique_string()
-    if ( test_blueprint.get_biclique_string() != "1,2,3,") {
-        std::cout << "BlueprintLite constructed wrong: should return '1,2,3,' not " << test_blueprint.get_biclique_string() << std::endl;
+    // Test get_biclique_string(iterative)
+    if ( test_blueprint.get_biclique_string(iterative) != "1,2,3,") {
+        std::cout << "BlueprintLite constructed wrong: should return '1,2,3,' not " << test_blueprint.get_biclique_string(iterative) << std::endl;
         error = true;
     }
 
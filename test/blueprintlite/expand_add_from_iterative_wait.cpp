@@ -61,12 +61,11 @@ int test_blueprintlite_expand_add_from_iterative_wait(int argc, char ** argv) {
     std::vector<size_t> independent_from_out( {} );
     std::vector<size_t> oct_auxiliary_independent_set( {1} );
 
+    IterativeSets iterative(iterative_wait, iterative_in, iterative_past);
+
     BlueprintLite test_blueprint(
                                  biclique_blueprint_id,
                                  graph_ptr,
-                                 std::make_shared<std::vector<size_t>>(iterative_wait),
-                                 std::make_shared<OrderedVertexSet>(iterative_in),
-                                 std::make_shared<std::vector<size_t>>(iterative_past),
                                  completely_connected_in,
                                  completely_connected_out,
                                  independent_from_in,
@@ -83,11 +82,9 @@ int test_blueprintlite_expand_add_from_iterative_wait(int argc, char ** argv) {
     iterative_wait = (std::vector<size_t>) {9};
     iterative_past = (std::vector<size_t>) {};
 
-    test_blueprint.update_iterative_ptrs(std::make_shared<std::vector<size_t>>(iterative_wait),
-                                         std::make_shared<OrderedVertexSet>(iterative_in),
-                                         std::make_shared<std::vector<size_t>>(iterative_past));
+    iterative = IterativeSets(iterative_wait, iterative_in, iterative_past);
 
-    ExpansionResult expand_result = test_blueprint.expand(expanding_vertex, duplicates_list);
+    ExpansionResult expand_result = test_blueprint.expand(iterative, expanding_vertex, duplicates_list);
 
     // Should return DISCONTINUE
     // check return type
@@ -44,12 +44,11 @@ int test_blueprintlite_expand_failure_empty_cc_in(int argc, char ** argv) {
     std::vector<size_t> independent_from_out( {13} );
     std::vector<size_t> oct_auxiliary_independent_set( {} );
 
+    IterativeSets iterative(iterative_wait, iterative_in, iterative_past);
+
     BlueprintLite test_blueprint(
                                  biclique_blueprint_id,
                                  graph_ptr,
-                                 std::make_shared<std::vector<size_t>>(iterative_wait),
-                                 std::make_shared<OrderedVertexSet>(iterative_in),
-                                 std::make_shared<std::vector<size_t>>(iterative_past),
                                  completely_connected_in,
                                  completely_connected_out,
                                  independent_from_in,
@@ -65,12 +64,10 @@ int test_blueprintlite_expand_failure_empty_cc_in(int argc, char ** argv) {
     iterative_in.add_vertex_safe(expanding_vertex);
     iterative_wait = (std::vector<size_t>) {10};
 
-    test_blueprint.update_iterative_ptrs(std::make_shared<std::vector<size_t>>(iterative_wait),
-                                         std::make_shared<OrderedVertexSet>(iterative_in),
-                                         std::make_shared<std::vector<size_t>>(iterative_past));
+    iterative = IterativeSets(iterative_wait, iterative_in, iterative_past);
 
     // Expand on vertex that has no edges to completely_connected_in
-    ExpansionResult expand_result = test_blueprint.expand(expanding_vertex, duplicates_list);
+    ExpansionResult expand_result = test_blueprint.expand(iterative, expanding_vertex, duplicates_list);
 
     // Should return BAN, 1
     // check return type
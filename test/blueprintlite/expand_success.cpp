@@ -43,12 +43,11 @@ int test_blueprintlite_expand_success(int argc, char ** argv) {
     std::vector<size_t> independent_from_out( {} );
     std::vector<size_t> oct_auxiliary_independent_set( {1} );
 
+    IterativeSets iterative(iterative_wait, iterative_in, iterative_past);
+
     BlueprintLite test_blueprint(
                                  biclique_blueprint_id,
                                  graph_ptr,
-                                 std::make_shared<std::vector<size_t>>(iterative_wait),
-                                 std::make_shared<OrderedVertexSet>(iterative_in),
-                                 std::make_shared<std::vector<size_t>>(iterative_past),
                                  completely_connected_in,
                                  completely_connected_out,
                                  independent_from_in,
@@ -60,7 +59,7 @@ int test_blueprintlite_expand_success(int argc, char ** argv) {
     std::unordered_map<std::string, bool> duplicates_list = {};
 
     // Expand on vertex
-    ExpansionResult expand_result = test_blueprint.expand(10,duplicates_list);
+    ExpansionResult expand_result = test_blueprint.expand(iterative, 10,duplicates_list);
 
     // Should return SUCCESS
     // check return type
@@ -44,12 +44,11 @@ int test_blueprintlite_get_bicliques(int argc, char ** argv) {
     std::vector<size_t> oct_auxiliary_independent_set( {1} );
 
 
+    IterativeSets iterative(iterative_wait, iterative_in, iterative_past);
+
     BlueprintLite test_blueprint(
                                  biclique_blueprint_id,
                                  graph_ptr,
-                                 std::make_shared<std::vector<size_t>>(iterative_wait),
-                                 std::make_shared<OrderedVertexSet>(iterative_in),
-                                 std::make_shared<std::vector<size_t>>(iterative_past),
                                  completely_connected_in,
                                  completely_connected_out,
                                  independent_from_in,
@@ -58,8 +57,8 @@ int test_blueprintlite_get_bicliques(int argc, char ** argv) {
                                 );
 
     // Test biclique_string
-    if ( test_blueprint.get_biclique_string() != "3,4,7,11,12,") {
-        std::cout << "BlueprintLite string wrong: should return '3,4,7,11,12,' not " << test_blueprint.get_biclique_string() << std::endl;
+    if ( test_blueprint.get_biclique_string(iterative) != "3,4,7,11,12,") {
+        std::cout << "BlueprintLite string wrong: should return '3,4,7,11,12,' not " << test_blueprint.get_biclique_string(iterative) << std::endl;
         error = true;
     }
 
@@ -67,7 +66,7 @@ int test_blueprintlite_get_bicliques(int argc, char ** argv) {
     BicliqueLite true_biclique((std::vector<size_t>) {3,7,11,12} ,
                                (std::vector<size_t>) {4} );
 
-    if ( test_blueprint.get_biclique() != true_biclique ) {
+    if ( test_blueprint.get_biclique(iterative) != true_biclique ) {
         std::cout << "BlueprintLite biclique constructed wrong" << std::endl;
         error = true;
     }
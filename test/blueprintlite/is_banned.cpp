@@ -44,12 +44,11 @@ int test_blueprintlite_is_banned(int argc, char ** argv) {
     std::vector<size_t> independent_from_out( {12,13} );
     std::vector<size_t> oct_auxiliary_independent_set( {1} );
 
+    IterativeSets iterative(iterative_wait, iterative_in, iterative_past);
+
     BlueprintLite test_blueprint(
                                  biclique_blueprint_id,
                                  graph_ptr,
-                                 std::make_shared<std::vector<size_t>>(iterative_wait),
-                                 std::make_shared<OrderedVertexSet>(iterative_in),
-                                 std::make_shared<std::vector<size_t>>(iterative_past),
                                  completely_connected_in,
                                  completely_connected_out,
                                  independent_from_in,
@@ -57,10 +56,10 @@ int test_blueprintlite_is_banned(int argc, char ** argv) {
                                  oct_auxiliary_independent_set
                                 );
 
-    test_blueprint.ban_vertex(9);
+    test_blueprint.ban_vertex(iterative, 9);
 
     // Check if vertex 9 is_banned
-    if(!test_blueprint.is_banned(9)){
+    if(!test_blueprint.is_banned(iterative, 9)){
         std::cout << "Vertex 9 should be banned but is not" << std::endl;
         error = true;
     }
@@ -68,14 +67,14 @@ int test_blueprintlite_is_banned(int argc, char ** argv) {
     // Verify that all non-banned vertices are such
     for(size_t idx = 0; idx < og.get_num_vertices(); idx++){
         if(idx == 9) continue;
-        if(test_blueprint.is_banned(idx)){
+        if(test_blueprint.is_banned(iterative, idx)){
             std::cout << "Vertex " << idx <<  " should not be banned but is" << std::endl;
             error = true;
         }
     }
 
     // Test skip_expanding_vertex on banned vertex
-    if(!test_blueprint.skip_expanding_vertex(9)){
+    if(!test_blueprint.skip_expanding_vertex(iterative, 9)){
         std::cout << "Expanding on vertex 9 should skip, but didn't." << std::endl;
         error = true;
     }
@@ -86,7 +85,7 @@ int test_blueprintlite_is_banned(int argc, char ** argv) {
         if (idx == 9) continue;  // skip over banned vertex
         // Test vertices that should not be skipped
         if (idx <= dummy_next_future) {
-            if (test_blueprint.skip_expanding_vertex(idx)){
+            if (test_blueprint.skip_expanding_vertex(iterative, idx)){
                 std::cout << "Expanding on vertex " << idx;
                 std::cout << " should not skip, but did." << std::endl;
                 error = true;
@@ -94,7 +93,7 @@ int test_blueprintlite_is_banned(int argc, char ** argv) {
         }
         // Test vertices that should be skipped
         else {
-            if (!test_blueprint.skip_expanding_vertex(idx)){
+            if (!test_blueprint.skip_expanding_vertex(iterative, idx)){
                 std::cout << "Expanding on vertex " << idx;
                 std::cout << " should skip, but didn't." << std::endl;
                 error = true;
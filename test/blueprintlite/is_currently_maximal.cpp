@@ -49,12 +49,11 @@ int test_blueprintlite_is_currently_maximal(int argc, char ** argv) {
     std::vector<size_t> independent_from_out( {13} );
     std::vector<size_t> oct_auxiliary_independent_set( {1} );
 
+    IterativeSets iterative(iterative_wait, iterative_in, iterative_past);
+
     BlueprintLite test_blueprint(
                                  biclique_blueprint_id,
                                  graph_ptr,
-                                 std::make_shared<std::vector<size_t>>(iterative_wait),
-                                 std::make_shared<OrderedVertexSet>(iterative_in),
-                                 std::make_shared<std::vector<size_t>>(iterative_past),
                                  completely_connected_in,
                                  completely_connected_out,
                                  independent_from_in,
@@ -63,7 +62,7 @@ int test_blueprintlite_is_currently_maximal(int argc, char ** argv) {
                                 );
 
     // Should not be maximal now
-    if (test_blueprint.is_currently_maximal()) {
+    if (test_blueprint.is_currently_maximal(iterative)) {
         std::cout << "Non-maximal blueprintlite reported as maximal." << std::endl;
         error = true;
     }
@@ -73,18 +72,16 @@ int test_blueprintlite_is_currently_maximal(int argc, char ** argv) {
     iterative_in.add_vertex_safe(expanding_vertex);
     iterative_wait = (std::vector<size_t>) {10};
 
-    test_blueprint.update_iterative_ptrs(std::make_shared<std::vector<size_t>>(iterative_wait),
-                                         std::make_shared<OrderedVertexSet>(iterative_in),
-                                         std::make_shared<std::vector<size_t>>(iterative_past));
+    iterative = IterativeSets(iterative_wait, iterative_in, iterative_past);
 
 
     std::unordered_map<std::string, bool> duplicates_list = {};
-    ExpansionResult expand_result = test_blueprint.expand(expanding_vertex,duplicates_list);
+    ExpansionResult expand_result = test_blueprint.expand(iterative, expanding_vertex,duplicates_list);
 
     // Should be maximal now
-    if (!test_blueprint.is_currently_maximal()) {
+    if (!test_blueprint.is_currently_maximal(iterative)) {
         std::cout << "Maximal blueprintlite not reported as maximal:" << std::endl;
-        std::cout << test_blueprint.get_biclique_string() << std::endl;
+        std::cout << test_blueprint.get_biclique_string(iterative) << std::endl;
         error = true;
     }
 
@@ -44,12 +44,11 @@ int test_blueprintlite_next_future_maximal(int argc, char ** argv) {
     std::vector<size_t> independent_from_out( {5,6} );
     std::vector<size_t> oct_auxiliary_independent_set;
 
+    IterativeSets iterative(iterative_wait, iterative_in, iterative_past);
+
     BlueprintLite test_blueprint(
                                  biclique_blueprint_id,
                                  graph_ptr,
-                                 std::make_shared<std::vector<size_t>>(iterative_wait),
-                                 std::make_shared<OrderedVertexSet>(iterative_in),
-                                 std::make_shared<std::vector<size_t>>(iterative_past),
                                  completely_connected_in,
                                  completely_connected_out,
                                  independent_from_in,
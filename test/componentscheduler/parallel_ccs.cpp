@@ -0,0 +1,148 @@
+/**
+* @authors Eric Horton, Kyle Kloster, Drew van der Poel
+*
+* This file is part of MI-bicliques, https://github.com/TheoryInPractice/MI-bicliques,
+* and is Copyright (C) North Carolina State University, 2018.
+* It is licensed under the three-clause BSD license; see LICENSE.
+*/
+
+#include<algorithm>
+#include<functional>
+#include<iostream>
+#include<string>
+#include<unordered_map>
+#include<vector>
+#include"../../src/algorithms/EnumMIB.h"
+#include"../../src/algorithms/LexMIB.h"
+#include"../../src/algorithms/MICA.h"
+#include"../../src/algorithms/OCTMIB.h"
+#include"../../src/algorithms/OCTMIBII.h"
+#include"../../src/algorithms/OCTMICA.h"
+
+
+namespace {
+
+template <typename Results>
+std::vector<std::string> mib_strings(Results & results) {
+    std::vector<std::string> strings;
+    for (auto & mib : results.mibs_computed) strings.push_back(mib.to_string());
+    return strings;
+}
+
+/**
+ * Run `algorithm` with one thread and with several, and check that parallel
+ * runs find the same MIBs, in the same order when deterministic.
+ */
+template <typename Results>
+bool check_algorithm(const std::string & name,
+                     std::function<void(Results &)> algorithm) {
+
+    bool error = false;
+
+    Results serial_results;
+    algorithm(serial_results);
+    auto serial_mibs = mib_strings(serial_results);
+
+    for (bool deterministic : {true, false}) {
+
+        Results parallel_results;
+        parallel_results.num_threads = 4;
+        parallel_results.deterministic_mode = deterministic;
+        algorithm(parallel_results);
+        auto parallel_mibs = mib_strings(parallel_results);
+
+        if (parallel_results.total_num_mibs != serial_results.total_num_mibs) {
+            std::cout << "ERROR: " << name << " on 4 threads counted ";
+            std::cout << parallel_results.total_num_mibs << " mibs instead of ";
+            std::cout << serial_results.total_num_mibs << std::endl;
+            error = true;
+        }
+
+        if (!deterministic) {
+            std::sort(serial_mibs.begin(), serial_mibs.end());
+            std::sort(parallel_mibs.begin(), parallel_mibs.end());
+        }
+        if (parallel_mibs != serial_mibs) {
+            std::cout << "ERROR: " << name << " on 4 threads";
+            if (deterministic) std::cout << " in deterministic mode";
+            std::cout << " did not output the mibs of a serial run" << std::endl;
+            error = true;
+        }
+
+        Results count_results;
+        count_results.num_threads = 4;
+        count_results.count_only_mode = true;
+        algorithm(count_results);
+
+        if (count_results.total_num_mibs != serial_results.total_num_mibs) {
+            std::cout << "ERROR: " << name << " count_only_mode on 4 threads counted ";
+            std::cout << count_results.total_num_mibs << " mibs instead of ";
+            std::cout << serial_results.total_num_mibs << std::endl;
+            error = true;
+        }
+    }
+
+    return error;
+
+}
+
+}
+
+
+/**
+ * Test that every enumeration algorithm, run with its connected components
+ * on several threads, outputs what it outputs on one thread.
+ */
+int test_componentscheduler_parallel_ccs(int argc, char ** argv) {
+
+    // Whether or not an error has occurred.
+    bool error = false;
+
+    // Disjoint union of test graphs, with components of varied sizes
+    const std::vector<std::string> files = {
+        "./test/test_graph.txt",
+        "./test/test_multi_ccs.txt",
+        "./test/test_graph_ban.txt",
+        "./test/test_graph_large.txt",
+        "./test/test_graph_delay_conditions.txt"
+    };
+
+    std::vector<size_t> all_vertices;
+    std::vector<std::vector<size_t>> adjacency_list;
+    std::unordered_map<size_t, std::string> labels;
+    for (auto & file : files) {
+        Graph part(file, Graph::FILE_FORMAT::adjlist);
+        size_t offset = all_vertices.size();
+        for (size_t u = 0; u < part.get_num_vertices(); u++) {
+            all_vertices.push_back(offset + u);
+            labels[offset + u] = std::to_string(offset + u);
+            adjacency_list.push_back({});
+            for (size_t v : part.get_neighbors_vector(u)) {
+                adjacency_list.back().push_back(offset + v);
+            }
+        }
+    }
+    Graph input_g(all_vertices, adjacency_list, labels);
+
+    error |= check_algorithm<OutputOptions>("OCTMIB", [&](OutputOptions & results) {
+        octmib(results, input_g);
+    });
+    error |= check_algorithm<OutputOptions>("OCTMIBII", [&](OutputOptions & results) {
+        octmibii(results, input_g, OrderedVertexSet(), OrderedVertexSet(), OrderedVertexSet());
+    });
+    error |= check_algorithm<OutputOptions>("OCTMICA", [&](OutputOptions & results) {
+        octmica(results, input_g, OrderedVertexSet(), OrderedVertexSet(), OrderedVertexSet());
+    });
+    error |= check_algorithm<OutputOptions>("MICA", [&](OutputOptions & results) {
+        mica(results, input_g);
+    });
+    error |= check_algorithm<LexMIBResults>("LexMIB", [&](LexMIBResults & results) {
+        lexmib(results, input_g);
+    });
+    error |= check_algorithm<NonLexMIBResults>("EnumMIB", [&](NonLexMIBResults & results) {
+        enummib(results, input_g);
+    });
+
+    return error;
+
+}
@@ -0,0 +1,67 @@
+/**
+* @authors Eric Horton, Kyle Kloster, Drew van der Poel
+*
+* This file is part of MI-bicliques, https://github.com/TheoryInPractice/MI-bicliques,
+* and is Copyright (C) North Carolina State University, 2018.
+* It is licensed under the three-clause BSD license; see LICENSE.
+*/
+
+#include<bitset>
+#include<chrono>
+#include<iostream>
+#include<thread>
+#include<vector>
+#include"../../src/algorithms/ComponentScheduler.h"
+#include"../../src/algorithms/OutputOptions.h"
+
+/**
+ * Test that run_components starts no further component once after_merge
+ * returns true. Component i counts 2^i MIBs, so the merged total shows which
+ * components ran: serially, or in deterministic mode, exactly the first
+ * three; otherwise at least three and at most those already running when
+ * the third was merged. In deterministic mode the first components are slow,
+ * so that later ones finish first and must not be merged after the stop.
+ */
+int test_componentscheduler_stop_after_merge(int argc, char ** argv) {
+
+    // Whether or not an error has occurred.
+    bool error = false;
+
+    const size_t num_ccs = 20;
+    const size_t stop_at = 3;
+    std::vector<std::vector<size_t>> vector_of_ccs(num_ccs, std::vector<size_t>(1, 0));
+
+    for (size_t num_threads : {1, 4}) {
+        for (bool deterministic : {true, false}) {
+
+            OutputOptions results;
+            results.num_threads = num_threads;
+            results.deterministic_mode = deterministic;
+
+            run_components(results, vector_of_ccs,
+                           [&](OutputOptions & cc_results, size_t which_cc, std::ostream &) {
+                if (deterministic && which_cc < stop_at) {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+                }
+                cc_results.total_num_mibs += size_t(1) << which_cc;
+            }, [&](OutputOptions & merged) {
+                return std::bitset<num_ccs>(merged.total_num_mibs).count() >= stop_at;
+            });
+
+            size_t num_run = std::bitset<num_ccs>(results.total_num_mibs).count();
+            bool exact = num_threads == 1 || deterministic;
+            bool ok = exact ? results.total_num_mibs == (size_t(1) << stop_at) - 1
+                            : num_run >= stop_at && num_run < stop_at + num_threads;
+            if (!ok) {
+                std::cout << "With " << num_threads << " threads";
+                if (deterministic) std::cout << " in deterministic mode";
+                std::cout << ", components " << std::bitset<num_ccs>(results.total_num_mibs);
+                std::cout << " were merged after asking to stop at " << stop_at << std::endl;
+                error = true;
+            }
+        }
+    }
+
+    return error;
+
+}
@@ -0,0 +1,63 @@
+/**
+* @authors Eric Horton, Kyle Kloster, Drew van der Poel
+*
+* This file is part of MI-bicliques, https://github.com/TheoryInPractice/MI-bicliques,
+* and is Copyright (C) North Carolina State University, 2018.
+* It is licensed under the three-clause BSD license; see LICENSE.
+*/
+
+#include<atomic>
+#include<iostream>
+#include<string>
+#include<thread>
+#include<vector>
+#include"../../src/graph/DuplicatesTable.h"
+
+/**
+ * Test a sharded DuplicatesTable used from several threads at once. Every
+ * thread inserts the same strings, so each string must be reported new by
+ * exactly one thread.
+ */
+int test_duplicatestable_concurrent_insert(int argc, char ** argv) {
+
+    // Whether or not an error has occurred.
+    bool error = false;
+
+    const size_t num_threads = 4;
+    // Multipliers coprime to num_strings, so each thread visits every string
+    const size_t multipliers[num_threads] = {1, 3, 7, 9};
+    const size_t num_strings = 20000;
+    DuplicatesTable table(100, 16);
+
+    std::vector<std::atomic<size_t>> times_new(num_strings);
+    for (auto & count : times_new) count = 0;
+
+    std::vector<std::thread> threads;
+    for (size_t thread_idx = 0; thread_idx < num_threads; thread_idx++) {
+        threads.emplace_back([&, thread_idx] {
+            for (size_t step = 0; step < num_strings; step++) {
+                // Threads walk the strings in different orders
+                size_t idx = (step*multipliers[thread_idx]) % num_strings;
+                if (table.insert(std::to_string(idx) + ",")) times_new[idx]++;
+            }
+        });
+    }
+    for (auto & thread : threads) thread.join();
+
+    for (size_t idx = 0; idx < num_strings; idx++) {
+        if (times_new[idx] != 1) {
+            std::cout << "String " << idx << " reported new " << times_new[idx];
+            std::cout << " times" << std::endl;
+            error = true;
+        }
+    }
+
+    if (table.size() != num_strings) {
+        std::cout << "Table has size " << table.size() << " instead of ";
+        std::cout << num_strings << std::endl;
+        error = true;
+    }
+
+    return error;
+
+}
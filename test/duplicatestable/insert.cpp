@@ -0,0 +1,69 @@
+/**
+* @authors Eric Horton, Kyle Kloster, Drew van der Poel
+*
+* This file is part of MI-bicliques, https://github.com/TheoryInPractice/MI-bicliques,
+* and is Copyright (C) North Carolina State University, 2018.
+* It is licensed under the three-clause BSD license; see LICENSE.
+*/
+
+#include<iostream>
+#include<string>
+#include"../../src/graph/DuplicatesTable.h"
+
+/**
+ * Test DuplicatesTable::insert and DuplicatesTable::contains. The table starts
+ * out sized for far fewer strings than are inserted, so the filter is rebuilt
+ * several times along the way; every string must be reported new exactly once
+ * and found afterwards, and strings never inserted must not be found.
+ */
+int test_duplicatestable_insert(int argc, char ** argv) {
+
+    // Whether or not an error has occurred.
+    bool error = false;
+
+    const size_t num_strings = 20000;
+    DuplicatesTable table(10);
+
+    for (size_t idx = 0; idx < num_strings; idx++) {
+        if (!table.insert(std::to_string(idx) + ",")) {
+            std::cout << "String " << idx << " reported as a duplicate on first insert" << std::endl;
+            error = true;
+        }
+    }
+
+    for (size_t idx = 0; idx < num_strings; idx++) {
+        if (table.insert(std::to_string(idx) + ",")) {
+            std::cout << "String " << idx << " reported as new on second insert" << std::endl;
+            error = true;
+        }
+        if (!table.contains(std::to_string(idx) + ",")) {
+            std::cout << "String " << idx << " not found" << std::endl;
+            error = true;
+        }
+    }
+
+    if (table.size() != num_strings) {
+        std::cout << "Table has size " << table.size() << " instead of ";
+        std::cout << num_strings << std::endl;
+        error = true;
+    }
+
+    // Strings never inserted are not found, and almost all are rejected by
+    // the filter without a lookup in the exact set
+    size_t table_lookups_before = table.get_num_table_lookups();
+    for (size_t idx = num_strings; idx < 2*num_strings; idx++) {
+        if (table.contains(std::to_string(idx) + ",")) {
+            std::cout << "String " << idx << " found but never inserted" << std::endl;
+            error = true;
+        }
+    }
+    size_t false_positives = table.get_num_table_lookups() - table_lookups_before;
+    if (false_positives > num_strings/100) {
+        std::cout << "Filter passed " << false_positives << " of " << num_strings;
+        std::cout << " absent strings" << std::endl;
+        error = true;
+    }
+
+    return error;
+
+}
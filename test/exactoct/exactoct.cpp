@@ -0,0 +1,147 @@
+/**
+* @authors Eric Horton, Kyle Kloster, Drew van der Poel
+*
+* This file is part of MI-bicliques, https://github.com/TheoryInPractice/MI-bicliques,
+* and is Copyright (C) North Carolina State University, 2018.
+* It is licensed under the three-clause BSD license; see LICENSE.
+*/
+
+#include<iostream>
+#include<vector>
+#include"../../src/graph/Graph.h"
+#include"../../src/graph/OrderedVertexSet.h"
+#include"../../src/algorithms/ExactOCT.h"
+#include"../../src/algorithms/LocalSearchOCT.h"
+#include"../../src/algorithms/OCTDecomposition.h"
+#include"../../src/algorithms/OCTMIB.h"
+#include"../../src/algorithms/OCTMIBII.h"
+#include"../../src/algorithms/OCTMICA.h"
+#include"../../src/algorithms/MICA.h"
+
+
+namespace {
+
+/**
+ * Whether oct_set, left_partition and right_partition split the vertices of
+ * g, with no edges within either partition.
+ */
+bool is_oct_decomposition(const Graph & g,
+                          const OrderedVertexSet & oct_set,
+                          const OrderedVertexSet & left_partition,
+                          const OrderedVertexSet & right_partition) {
+
+    if (oct_set.size() + left_partition.size() + right_partition.size() != g.get_num_vertices()) {
+        return false;
+    }
+    for (size_t v = 0; v < g.get_num_vertices(); v++) {
+        size_t count = oct_set.has_vertex(v) + left_partition.has_vertex(v) +
+                       right_partition.has_vertex(v);
+        if (count != 1) return false;
+    }
+    for (auto v : left_partition) {
+        if (!g.is_completely_independent_from(v, left_partition.set_minus(std::vector<size_t>({v})))) {
+            return false;
+        }
+    }
+    for (auto v : right_partition) {
+        if (!g.is_completely_independent_from(v, right_partition.set_minus(std::vector<size_t>({v})))) {
+            return false;
+        }
+    }
+    return true;
+
+}
+
+}
+
+
+/**
+ * Test ExactOCT::exactoct -- that it finds OCT sets of the minimum size, found
+ * by brute force, no larger than those of local search, and gives up once
+ * out of time; and that OCT-MIB-II and OCT-MICA, given no OCT decomposition,
+ * compute one for each component.
+ */
+int test_exactoct_exactoct(int argc, char ** argv) {
+
+    // Whether or not an error has occurred.
+    bool error = false;
+
+    std::vector<std::string> paths = {"./test/test_graph.txt",
+                                      "./test/test_multi_ccs.txt",
+                                      "./test/test_graph_ban.txt",
+                                      "./test/test_graph_delay_conditions.txt",
+                                      "./test/test_disconnected_graph.txt"};
+    std::vector<size_t> minimum_sizes = {2, 1, 0, 1, 1};
+
+    for (size_t idx = 0; idx < paths.size(); idx++) {
+        Graph g(paths[idx], Graph::FILE_FORMAT::adjlist);
+
+        OrderedVertexSet oct_set, left_partition, right_partition;
+        if (!exactoct(g, oct_set, left_partition, right_partition, 60)) {
+            std::cout << "ExactOCT ran out of time on " << paths[idx] << std::endl;
+            error = true;
+            continue;
+        }
+        if (!is_oct_decomposition(g, oct_set, left_partition, right_partition)) {
+            std::cout << "ExactOCT output invalid decomposition of " << paths[idx] << std::endl;
+            error = true;
+        }
+        if (oct_set.size() != minimum_sizes[idx]) {
+            std::cout << "ExactOCT output oct set of size " << oct_set.size() << " on ";
+            std::cout << paths[idx] << ", not " << minimum_sizes[idx] << std::endl;
+            error = true;
+        }
+    }
+
+    // Starting from the OCT set local search finds
+    OCTSearchOptions options;
+    options.time_budget = 10;
+    options.exact_time_cap = 60;
+    for (auto path : {"./test/test_graph_large.txt", "./test/test_graph_mcb_huge.txt"}) {
+        Graph g(path, Graph::FILE_FORMAT::adjlist);
+
+        OrderedVertexSet local_oct, local_left, local_right;
+        localsearchoct(g, local_oct, local_left, local_right, options);
+
+        OrderedVertexSet oct_set, left_partition, right_partition;
+        octdecomposition(g, oct_set, left_partition, right_partition, options);
+        if (!is_oct_decomposition(g, oct_set, left_partition, right_partition)) {
+            std::cout << "ExactOCT output invalid decomposition of " << path << std::endl;
+            error = true;
+        }
+        if (oct_set.size() > local_oct.size()) {
+            std::cout << "ExactOCT output oct set of size " << oct_set.size() << " on ";
+            std::cout << path << ", larger than " << local_oct.size() << std::endl;
+            error = true;
+        }
+    }
+
+    // Out of time, the decomposition is left as it was
+    Graph g("./test/test_graph_large.txt", Graph::FILE_FORMAT::adjlist);
+    OrderedVertexSet oct_set, left_partition, right_partition;
+    if (exactoct(g, oct_set, left_partition, right_partition, 0) || oct_set.size() > 0) {
+        std::cout << "ExactOCT with no time finished anyway" << std::endl;
+        error = true;
+    }
+
+    // Without a decomposition, OCT-MIB-II finds as many MIBs as OCT-MIB, and
+    // OCT-MICA as many bicliques as MICA
+    OutputOptions octmib_results, octmibii_results, mica_results, octmica_results;
+    octmib(octmib_results, g);
+    octmibii(octmibii_results, g, OrderedVertexSet(), OrderedVertexSet(), OrderedVertexSet());
+    if (octmibii_results.total_num_mibs != octmib_results.total_num_mibs) {
+        std::cout << "OCT-MIB-II without oct set found " << octmibii_results.total_num_mibs;
+        std::cout << " mibs, not " << octmib_results.total_num_mibs << std::endl;
+        error = true;
+    }
+    mica(mica_results, g);
+    octmica(octmica_results, g, OrderedVertexSet(), OrderedVertexSet(), OrderedVertexSet());
+    if (octmica_results.total_num_mibs != mica_results.total_num_mibs) {
+        std::cout << "OCT-MICA without oct set found " << octmica_results.total_num_mibs;
+        std::cout << " bicliques, not " << mica_results.total_num_mibs << std::endl;
+        error = true;
+    }
+
+    return error;
+
+}
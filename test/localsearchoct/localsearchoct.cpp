@@ -0,0 +1,142 @@
+/**
+* @authors Eric Horton, Kyle Kloster, Drew van der Poel
+*
+* This file is part of MI-bicliques, https://github.com/TheoryInPractice/MI-bicliques,
+* and is Copyright (C) North Carolina State University, 2018.
+* It is licensed under the three-clause BSD license; see LICENSE.
+*/
+
+#include<iostream>
+#include<vector>
+#include"../../src/graph/Graph.h"
+#include"../../src/graph/OrderedVertexSet.h"
+#include"../../src/algorithms/LocalSearchOCT.h"
+#include"../../src/algorithms/SimpleOCT.h"
+
+
+/**
+ * Whether oct_set, left_partition and right_partition split the vertices of
+ * g, with no edges within either partition.
+ */
+bool is_oct_decomposition(const Graph & g,
+                          const OrderedVertexSet & oct_set,
+                          const OrderedVertexSet & left_partition,
+                          const OrderedVertexSet & right_partition) {
+
+    if (oct_set.size() + left_partition.size() + right_partition.size() != g.get_num_vertices()) {
+        return false;
+    }
+    for (size_t v = 0; v < g.get_num_vertices(); v++) {
+        size_t count = oct_set.has_vertex(v) + left_partition.has_vertex(v) +
+                       right_partition.has_vertex(v);
+        if (count != 1) return false;
+    }
+    for (auto v : left_partition) {
+        if (!g.is_completely_independent_from(v, left_partition.set_minus(std::vector<size_t>({v})))) {
+            return false;
+        }
+    }
+    for (auto v : right_partition) {
+        if (!g.is_completely_independent_from(v, right_partition.set_minus(std::vector<size_t>({v})))) {
+            return false;
+        }
+    }
+    return true;
+
+}
+
+
+/**
+ * Test LocalSearchOCT::localsearchoct -- that it returns an OCT decomposition
+ * no larger than simpleoct's, strictly smaller on graphs where the greedy
+ * coloring is poor, the same one for the same seed, and that of simpleoct
+ * when not active or given an OCT set.
+ */
+int test_localsearchoct_localsearchoct(int argc, char ** argv) {
+
+    // Whether or not an error has occurred.
+    bool error = false;
+
+    OCTSearchOptions options;
+    options.time_budget = 10;
+
+    std::vector<std::string> paths = {"./test/test_graph.txt",
+                                      "./test/test_graph_large.txt",
+                                      "./test/test_graph_mcb_huge.txt",
+                                      "./test/test_multi_ccs.txt",
+                                      "./test/bipartite_left50right500p0.09.txt"};
+    std::vector<size_t> oct_sizes;
+
+    for (auto & path : paths) {
+        Graph g(path, Graph::FILE_FORMAT::adjlist);
+
+        OrderedVertexSet simple_oct, simple_left, simple_right;
+        simpleoct(g, simple_oct, simple_left, simple_right);
+
+        OrderedVertexSet oct_set, left_partition, right_partition;
+        localsearchoct(g, oct_set, left_partition, right_partition, options);
+        oct_sizes.push_back(oct_set.size());
+
+        if (!is_oct_decomposition(g, oct_set, left_partition, right_partition)) {
+            std::cout << "LocalSearchOCT output invalid decomposition of " << path << std::endl;
+            error = true;
+        }
+        if (oct_set.size() > simple_oct.size()) {
+            std::cout << "LocalSearchOCT output oct set of size " << oct_set.size();
+            std::cout << " on " << path << ", larger than " << simple_oct.size() << std::endl;
+            error = true;
+        }
+
+        // The same seed gives the same decomposition
+        OrderedVertexSet oct_again, left_again, right_again;
+        localsearchoct(g, oct_again, left_again, right_again, options);
+        if (oct_again != oct_set || left_again != left_partition) {
+            std::cout << "LocalSearchOCT output differs between runs on " << path << std::endl;
+            error = true;
+        }
+    }
+
+    // The greedy coloring puts 16 vertices of test_graph_large.txt in its
+    // OCT set, many more than needed
+    if (oct_sizes[1] >= 16) {
+        std::cout << "LocalSearchOCT did not shrink the oct set of size 16 of ";
+        std::cout << paths[1] << ", found " << oct_sizes[1] << std::endl;
+        error = true;
+    }
+
+    // Bipartite graphs need no OCT set
+    if (oct_sizes[4] != 0) {
+        std::cout << "LocalSearchOCT output oct set of size " << oct_sizes[4];
+        std::cout << " on bipartite graph" << std::endl;
+        error = true;
+    }
+
+    // A prescribed OCT set is kept, and inactive options do what simpleoct does
+    Graph g("./test/test_graph_large.txt", Graph::FILE_FORMAT::adjlist);
+    OrderedVertexSet prescribed(std::vector<size_t>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14}));
+    OrderedVertexSet oct_set(prescribed), left_partition, right_partition;
+    localsearchoct(g, oct_set, left_partition, right_partition, options);
+    OrderedVertexSet simple_oct(prescribed), simple_left, simple_right;
+    simpleoct(g, simple_oct, simple_left, simple_right);
+    if (oct_set != simple_oct || left_partition != simple_left) {
+        std::cout << "LocalSearchOCT changed prescribed oct set " << prescribed.to_string();
+        std::cout << " to " << oct_set.to_string() << std::endl;
+        error = true;
+    }
+
+    oct_set = OrderedVertexSet();
+    left_partition = OrderedVertexSet();
+    right_partition = OrderedVertexSet();
+    localsearchoct(g, oct_set, left_partition, right_partition, OCTSearchOptions());
+    simple_oct = OrderedVertexSet();
+    simple_left = OrderedVertexSet();
+    simple_right = OrderedVertexSet();
+    simpleoct(g, simple_oct, simple_left, simple_right);
+    if (oct_set != simple_oct || left_partition != simple_left) {
+        std::cout << "LocalSearchOCT without a time budget differs from simpleoct" << std::endl;
+        error = true;
+    }
+
+    return error;
+
+}
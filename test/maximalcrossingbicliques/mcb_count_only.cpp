@@ -0,0 +1,96 @@
+/**
+* @authors Eric Horton, Kyle Kloster, Drew van der Poel
+*
+* This file is part of MI-bicliques, https://github.com/TheoryInPractice/MI-bicliques,
+* and is Copyright (C) North Carolina State University, 2018.
+* It is licensed under the three-clause BSD license; see LICENSE.
+*/
+
+#include<iostream>
+#include<vector>
+#include"../../src/graph/Graph.h"
+#include"../../src/graph/OrderedVertexSet.h"
+#include"../../src/algorithms/MaximalCrossingBicliques.h"
+#include"../../src/algorithms/MaximalCrossingBicliquesBipartite.h"
+#include"../../src/algorithms/SimpleOCT.h"
+#include"../../src/algorithms/OCTMIB.h"
+#include"../../src/algorithms/EnumMIB.h"
+
+/**
+ * Test that count-only mode of MCB, MCBB, OCTMIB and EnumMIB gives the same
+ * totals as enumerating the bicliques.
+ */
+int test_maximalcrossingbicliques_mcb_count_only(int argc, char ** argv) {
+
+    // Whether or not an error has occurred.
+    bool error = false;
+
+    // MCB
+    Graph g_mcb("./test/test_graph_delay_conditions.txt", Graph::FILE_FORMAT::adjlist);
+    const std::vector<OrderedVector> set_of_ISs = {
+        OrderedVector ((std::vector<size_t>) {8,11,12}),
+        OrderedVector ((std::vector<size_t>) {0,3,7,9,10})
+    };
+    for (auto & ind_set : set_of_ISs) {
+        size_t num_listed = maximal_crossing_bicliques(g_mcb, ind_set).size();
+        size_t num_counted = count_maximal_crossing_bicliques(g_mcb, ind_set);
+        if (num_listed != num_counted) {
+            std::cout << "ERROR: count_maximal_crossing_bicliques found " << num_counted;
+            std::cout << " instead of " << num_listed << std::endl;
+            error = true;
+        }
+    }
+
+    // MCBB
+    Graph g_mcbb("./test/test_mcbb_large.txt", Graph::FILE_FORMAT::adjlist);
+    OrderedVertexSet oct_set, left_partition, right_partition;
+    simpleoct(g_mcbb, oct_set, left_partition, right_partition);
+
+    size_t num_listed = maximal_crossing_bicliques_bipartite(g_mcbb,
+                                                            left_partition.get_vertices(),
+                                                            right_partition.get_vertices()).size();
+    OutputOptions mcbb_results;
+    mcbb_results.count_only_mode = true;
+    maximal_crossing_bicliques_bipartite(mcbb_results, g_mcbb,
+                                         left_partition.get_vertices(),
+                                         right_partition.get_vertices());
+    if (num_listed != mcbb_results.bipartite_num_mibs || mcbb_results.mibs_computed.size() != 0) {
+        std::cout << "ERROR: count-only MCBB found " << mcbb_results.bipartite_num_mibs;
+        std::cout << " instead of " << num_listed << std::endl;
+        error = true;
+    }
+
+    // OCTMIB and EnumMIB
+    const std::vector<std::string> paths_to_files = {
+        "./test/test_graph_large.txt",
+        "./test/test_multi_ccs.txt"
+    };
+    for (auto path_to_file : paths_to_files) {
+
+        Graph input_g(path_to_file, Graph::FILE_FORMAT::adjlist);
+
+        OutputOptions octmib_results;
+        octmib_results.count_only_mode = true;
+        octmib(octmib_results, input_g);
+
+        NonLexMIBResults enummib_results;
+        enummib_results.count_only_mode = true;
+        enummib(enummib_results, input_g);
+
+        size_t num_mibs = octmib(input_g).size();
+
+        if (octmib_results.total_num_mibs != num_mibs || octmib_results.mibs_computed.size() != 0) {
+            std::cout << "ERROR: count-only OCTMIB found " << octmib_results.total_num_mibs;
+            std::cout << " instead of " << num_mibs << " on " << path_to_file << std::endl;
+            error = true;
+        }
+        if (enummib_results.total_num_mibs != num_mibs || enummib_results.mibs_computed.size() != 0) {
+            std::cout << "ERROR: count-only EnumMIB found " << enummib_results.total_num_mibs;
+            std::cout << " instead of " << num_mibs << " on " << path_to_file << std::endl;
+            error = true;
+        }
+    }
+
+    return error;
+
+}
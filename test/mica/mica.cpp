@@ -0,0 +1,82 @@
+/**
+* @authors Eric Horton, Kyle Kloster, Drew van der Poel
+*
+* This file is part of MI-bicliques, https://github.com/TheoryInPractice/MI-bicliques,
+* and is Copyright (C) North Carolina State University, 2018.
+* It is licensed under the three-clause BSD license; see LICENSE.
+*/
+
+#include<algorithm>
+#include<iostream>
+#include<vector>
+#include"../../src/graph/BicliqueLite.h"
+#include"../../src/graph/Graph.h"
+#include"../../src/graph/OrderedVertexSet.h"
+#include"../../src/algorithms/MICA.h"
+#include"../../src/algorithms/OCTMICA.h"
+
+
+/**
+ * Test MICA::consensus and MICA::mica -- that consensus gives the nonempty
+ * of the four consensus bicliques, and that MICA and OCT-MICA find the known
+ * number of maximal bicliques, and the same ones on four threads (in another
+ * order, when connected components finish in another order).
+ */
+int test_mica_mica(int argc, char ** argv) {
+
+    // Whether or not an error has occurred.
+    bool error = false;
+
+    BicliqueLite b1(std::vector<size_t>({1, 2}), std::vector<size_t>({3}));
+    BicliqueLite b2(std::vector<size_t>({2, 4}), std::vector<size_t>({3, 5}));
+    std::vector<BicliqueLite> expected = {
+        BicliqueLite(std::vector<size_t>({2}), std::vector<size_t>({3, 5})),
+        BicliqueLite(std::vector<size_t>({1, 2, 4}), std::vector<size_t>({3}))
+    };
+    if (consensus(b1, b2) != expected) {
+        std::cout << "MICA consensus of " << b1.to_string() << " and " << b2.to_string();
+        std::cout << " is wrong" << std::endl;
+        error = true;
+    }
+
+    std::vector<std::string> paths = {"./test/test_graph.txt",
+                                      "./test/test_multi_ccs.txt",
+                                      "./test/test_graph_large.txt",
+                                      "./test/test_mcbb_large.txt"};
+    std::vector<size_t> num_bicliques = {8, 5, 456, 231};
+
+    for (size_t idx = 0; idx < paths.size(); idx++) {
+        Graph g(paths[idx], Graph::FILE_FORMAT::adjlist);
+
+        OutputOptions mica_results, octmica_results;
+        mica(mica_results, g);
+        octmica(octmica_results, g, OrderedVertexSet(), OrderedVertexSet(), OrderedVertexSet());
+
+        if (mica_results.total_num_mibs != num_bicliques[idx] ||
+            octmica_results.total_num_mibs != num_bicliques[idx]) {
+            std::cout << "MICA found " << mica_results.total_num_mibs << " and OCT-MICA ";
+            std::cout << octmica_results.total_num_mibs << " bicliques in " << paths[idx];
+            std::cout << ", not " << num_bicliques[idx] << std::endl;
+            error = true;
+        }
+
+        OutputOptions mica_parallel, octmica_parallel;
+        mica_parallel.num_threads = 4;
+        octmica_parallel.num_threads = 4;
+        mica(mica_parallel, g);
+        octmica(octmica_parallel, g, OrderedVertexSet(), OrderedVertexSet(), OrderedVertexSet());
+
+        for (auto results : {&mica_results, &octmica_results, &mica_parallel, &octmica_parallel}) {
+            std::sort(results->mibs_computed.begin(), results->mibs_computed.end());
+        }
+        if (mica_parallel.mibs_computed != mica_results.mibs_computed ||
+            octmica_parallel.mibs_computed != octmica_results.mibs_computed) {
+            std::cout << "MICA and OCT-MICA on 4 threads found other bicliques in ";
+            std::cout << paths[idx] << std::endl;
+            error = true;
+        }
+    }
+
+    return error;
+
+}
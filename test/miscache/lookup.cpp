@@ -0,0 +1,144 @@
+/**
+* @authors Eric Horton, Kyle Kloster, Drew van der Poel
+*
+* This file is part of MI-bicliques, https://github.com/TheoryInPractice/MI-bicliques,
+* and is Copyright (C) North Carolina State University, 2018.
+* It is licensed under the three-clause BSD license; see LICENSE.
+*/
+
+#include<algorithm>
+#include<iostream>
+#include<memory>
+#include<unordered_map>
+#include<vector>
+#include"../../src/graph/Graph.h"
+#include"../../src/algorithms/AllMaximalIndependentSets.h"
+#include"../../src/algorithms/MISCache.h"
+#include"../../src/algorithms/OCTMIB.h"
+#include"../ground_truth_mibs.h"
+
+
+namespace {
+
+// Compare two lists of MIS regardless of the order of the list
+bool same_mis(std::vector<std::vector<size_t>> list1,
+              std::vector<std::vector<size_t>> list2) {
+    std::sort(list1.begin(), list1.end());
+    std::sort(list2.begin(), list2.end());
+    return list1 == list2;
+}
+
+}
+
+
+/**
+ * Test MISCache through get_all_mis: the MIS of every neighborhood are the
+ * same with and without the cache, a repeated neighborhood is a hit, the same
+ * vertex set reached through a relabeled subgraph is a hit returned in the
+ * subgraph's labels, and a small budget evicts entries without changing
+ * results. Finally OCTMIB with a cache finds each true MIB exactly once.
+ */
+int test_miscache_lookup(int argc, char ** argv) {
+
+    // Whether or not an error has occurred.
+    bool error = false;
+
+    Graph g("./test/test_graph_large.txt", Graph::FILE_FORMAT::adjlist);
+    size_t num_vertices = g.get_num_vertices();
+
+    MISCache cache(g, 1 << 24);
+
+    for (size_t pass = 0; pass < 2; pass++) {
+        for (size_t v = 0; v < num_vertices; v++) {
+            const auto & neighbors = g.get_neighbors_vector(v);
+            if (!same_mis(get_all_mis(g, neighbors, &cache), get_all_mis(g, neighbors))) {
+                std::cout << "Cached MIS of neighborhood of " << v << " differ in pass ";
+                std::cout << pass << std::endl;
+                error = true;
+            }
+        }
+    }
+
+    // Each distinct neighborhood misses once
+    if (cache.get_num_lookups() != 2*num_vertices ||
+        cache.get_num_lookups() - cache.get_num_hits() != cache.size()) {
+        std::cout << "Cache has " << cache.get_num_hits() << " hits in ";
+        std::cout << cache.get_num_lookups() << " lookups with " << cache.size();
+        std::cout << " entries" << std::endl;
+        error = true;
+    }
+
+    // Subgraph on all vertices in reverse order: same sets, other labels
+    std::vector<size_t> reversed;
+    for (size_t v = num_vertices; v > 0; v--) reversed.push_back(v - 1);
+    Graph reversed_g = g.subgraph(reversed);
+
+    size_t hits_before = cache.get_num_hits();
+    for (size_t v = 0; v < num_vertices; v++) {
+        const auto & neighbors = reversed_g.get_neighbors_vector(v);
+        if (!same_mis(get_all_mis(reversed_g, neighbors, &cache),
+                      get_all_mis(reversed_g, neighbors))) {
+            std::cout << "Cached MIS of neighborhood of " << v;
+            std::cout << " differ in relabeled subgraph" << std::endl;
+            error = true;
+        }
+    }
+    if (cache.get_num_hits() - hits_before != num_vertices) {
+        std::cout << "Relabeled subgraph had " << cache.get_num_hits() - hits_before;
+        std::cout << " hits instead of " << num_vertices << std::endl;
+        error = true;
+    }
+
+    // A budget far too small for every neighborhood
+    MISCache small_cache(g, 2048);
+    for (size_t pass = 0; pass < 2; pass++) {
+        for (size_t v = 0; v < num_vertices; v++) {
+            const auto & neighbors = g.get_neighbors_vector(v);
+            if (!same_mis(get_all_mis(g, neighbors, &small_cache), get_all_mis(g, neighbors))) {
+                std::cout << "Cached MIS of neighborhood of " << v;
+                std::cout << " differ under small budget" << std::endl;
+                error = true;
+            }
+        }
+    }
+    if (small_cache.get_num_evictions() == 0 ||
+        small_cache.get_memory_usage() > small_cache.get_memory_budget()) {
+        std::cout << "Small cache uses " << small_cache.get_memory_usage() << " bytes after ";
+        std::cout << small_cache.get_num_evictions() << " evictions" << std::endl;
+        error = true;
+    }
+
+    // OCTMIB sharing a cache between threads
+    ground_truth_mibs GT;
+    auto mibs_true = GT.mibs_true_raw("./test/ground_truth_large.txt");
+
+    for (size_t num_threads : {1, 4}) {
+
+        std::unordered_map<std::string,size_t> mibs_map;
+        for (auto & mib : mibs_true) mibs_map[vector_to_string(mib)] = 0;
+
+        OutputOptions octmib_results;
+        octmib_results.num_threads = num_threads;
+        octmib_results.mis_cache = std::make_shared<MISCache>(g, 1 << 24);
+        octmib(octmib_results, g);
+
+        for (auto & mib : octmib_results.mibs_computed) mibs_map[mib.to_string()]++;
+
+        if (octmib_results.mibs_computed.size() != mibs_true.size()) {
+            std::cout << "ERROR: OCTMIB with MIS cache and " << num_threads << " threads found ";
+            std::cout << octmib_results.mibs_computed.size() << " mibs instead of correct number ";
+            std::cout << mibs_true.size() << std::endl;
+            error = true;
+        }
+        for (auto iter : mibs_map) {
+            if (iter.second != 1) {
+                std::cout << "ERROR: OCTMIB with MIS cache found mib " << iter.first << " ";
+                std::cout << iter.second << " times" << std::endl;
+                error = true;
+            }
+        }
+    }
+
+    return error;
+
+}
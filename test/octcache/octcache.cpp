@@ -0,0 +1,130 @@
+/**
+* @authors Eric Horton, Kyle Kloster, Drew van der Poel
+*
+* This file is part of MI-bicliques, https://github.com/TheoryInPractice/MI-bicliques,
+* and is Copyright (C) North Carolina State University, 2018.
+* It is licensed under the three-clause BSD license; see LICENSE.
+*/
+
+#include<cstdio>
+#include<fstream>
+#include<iostream>
+#include<vector>
+#include"../../src/graph/Graph.h"
+#include"../../src/graph/OrderedVertexSet.h"
+#include"../../src/algorithms/OCTCache.h"
+#include"../../src/algorithms/OCTDecomposition.h"
+#include"../../src/algorithms/SimpleCCs.h"
+
+
+/**
+ * Test OCTCache -- that a cached decomposition is read back as written, for
+ * the same graph in any vertex order, and not for another graph, other
+ * options, or if it is not a valid decomposition, and that a file which is
+ * not a cache is not overwritten.
+ */
+int test_octcache_octcache(int argc, char ** argv) {
+
+    // Whether or not an error has occurred.
+    bool error = false;
+
+    const std::string path = "./test/octcache_test.octcache";
+
+    Graph g("./test/test_multi_ccs.txt", Graph::FILE_FORMAT::adjlist);
+    auto vector_of_ccs = simpleccs(g);
+    OCTSearchOptions options;
+    std::string options_key = oct_options_key(options);
+
+    OrderedVertexSet oct_set, left_partition, right_partition;
+    octdecomposition_by_component(g, vector_of_ccs, oct_set, left_partition,
+                                  right_partition, options);
+
+    // A file that is not a cache is left alone
+    std::remove(path.c_str());
+    {
+        std::ofstream outfile(path);
+        outfile << "not an oct decomposition cache" << std::endl;
+    }
+    if (may_overwrite_oct_cache(path) ||
+        write_oct_cache(path, g, options_key, vector_of_ccs, oct_set, left_partition)) {
+        std::cout << "OCTCache would overwrite " << path << ", which is not a cache" << std::endl;
+        error = true;
+    }
+    {
+        std::ifstream infile(path);
+        std::string line;
+        if (!std::getline(infile, line) || line != "not an oct decomposition cache") {
+            std::cout << "OCTCache overwrote " << path << ", which is not a cache" << std::endl;
+            error = true;
+        }
+    }
+    std::remove(path.c_str());
+
+    if (!write_oct_cache(path, g, options_key, vector_of_ccs, oct_set, left_partition)) {
+        std::cout << "OCTCache could not write " << path << std::endl;
+        return true;
+    }
+
+    OrderedVertexSet cached_oct, cached_left, cached_right;
+    if (!read_oct_cache(path, g, options_key, cached_oct, cached_left, cached_right) ||
+        cached_oct != oct_set || cached_left != left_partition || cached_right != right_partition) {
+        std::cout << "OCTCache read back oct set " << cached_oct.to_string();
+        std::cout << " instead of " << oct_set.to_string() << std::endl;
+        error = true;
+    }
+
+    // The same graph with its vertices in reverse order
+    std::vector<size_t> reversed;
+    for (size_t v = g.get_num_vertices(); v > 0; v--) reversed.push_back(v - 1);
+    Graph g_reversed = g.subgraph(reversed);
+    if (graph_fingerprint(g_reversed) != graph_fingerprint(g)) {
+        std::cout << "OCTCache fingerprint depends on vertex order" << std::endl;
+        error = true;
+    }
+    OrderedVertexSet reversed_oct;
+    cached_left = OrderedVertexSet();
+    cached_right = OrderedVertexSet();
+    if (!read_oct_cache(path, g_reversed, options_key, reversed_oct, cached_left, cached_right) ||
+        reversed_oct.size() != oct_set.size()) {
+        std::cout << "OCTCache did not read back for reordered graph" << std::endl;
+        error = true;
+    }
+    for (size_t v : reversed_oct) {
+        if (!oct_set.has_vertex(reversed[v])) {
+            std::cout << "OCTCache read back oct vertex " << v << " of reordered graph" << std::endl;
+            error = true;
+        }
+    }
+
+    // Another graph, or other options
+    Graph other("./test/test_graph.txt", Graph::FILE_FORMAT::adjlist);
+    options.time_budget = 1;
+    OrderedVertexSet untouched;
+    if (read_oct_cache(path, other, options_key, untouched, cached_left, cached_right) ||
+        read_oct_cache(path, g, oct_options_key(options), untouched, cached_left, cached_right) ||
+        untouched.size() > 0) {
+        std::cout << "OCTCache read back for another graph or other options" << std::endl;
+        error = true;
+    }
+
+    // Not an OCT decomposition: every vertex on the left
+    {
+        std::ofstream outfile(path);
+        outfile << "fingerprint " << graph_fingerprint(g) << std::endl;
+        outfile << "options " << options_key << std::endl;
+        outfile << "oct" << std::endl << "left";
+        for (size_t v = 0; v < g.get_num_vertices(); v++) {
+            outfile << " " << g.get_external_vertex_label(v);
+        }
+        outfile << std::endl << "right" << std::endl;
+    }
+    if (read_oct_cache(path, g, options_key, untouched, cached_left, cached_right)) {
+        std::cout << "OCTCache read back invalid decomposition" << std::endl;
+        error = true;
+    }
+
+    std::remove(path.c_str());
+
+    return error;
+
+}
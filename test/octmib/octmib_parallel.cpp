@@ -0,0 +1,79 @@
+/**
+* @authors Eric Horton, Kyle Kloster, Drew van der Poel
+*
+* This file is part of MI-bicliques, https://github.com/TheoryInPractice/MI-bicliques,
+* and is Copyright (C) North Carolina State University, 2018.
+* It is licensed under the three-clause BSD license; see LICENSE.
+*/
+
+#include<iostream>
+#include<vector>
+#include<unordered_map>
+#include"../../src/algorithms/OCTMIB.h"
+#include"../ground_truth_mibs.h"
+
+/**
+ * Test that OCTMIB run on several threads finds each true MIB exactly once,
+ * both when recording bicliques and in count-only mode.
+ */
+int test_octmib_octmib_parallel(int argc, char ** argv) {
+
+    // Whether or not an error has occurred.
+    bool error = false;
+
+    const std::vector<std::vector<std::string>> files = {
+        {"./test/test_graph_large.txt", "./test/ground_truth_large.txt"},
+        {"./test/test_graph_mcb_huge.txt", "./test/ground_truth_huge.txt"},
+        {"./test/test_multi_ccs.txt", "./test/ground_truth_multi_ccs.txt"}
+    };
+
+    ground_truth_mibs GT;
+
+    for (auto & file_pair : files) {
+
+        Graph input_g(file_pair[0], Graph::FILE_FORMAT::adjlist);
+        auto mibs_true = GT.mibs_true_raw(file_pair[1]);
+
+        for (size_t num_threads : {2, 4, 8}) {
+
+            std::unordered_map<std::string,size_t> mibs_map;
+            for (auto & mib : mibs_true) mibs_map[vector_to_string(mib)] = 0;
+
+            OutputOptions octmib_results;
+            octmib_results.num_threads = num_threads;
+            octmib(octmib_results, input_g);
+
+            for (auto & mib : octmib_results.mibs_computed) mibs_map[mib.to_string()]++;
+
+            if (octmib_results.mibs_computed.size() != mibs_true.size() ||
+                octmib_results.total_num_mibs != mibs_true.size()) {
+                std::cout << "ERROR: OCTMIB with " << num_threads << " threads found ";
+                std::cout << octmib_results.mibs_computed.size() << " mibs on " << file_pair[0];
+                std::cout << " instead of correct number " << mibs_true.size() << std::endl;
+                error = true;
+            }
+            for (auto iter : mibs_map) {
+                if (iter.second != 1) {
+                    std::cout << "ERROR: OCTMIB with " << num_threads << " threads found mib ";
+                    std::cout << iter.first << " " << iter.second << " times" << std::endl;
+                    error = true;
+                }
+            }
+
+            OutputOptions count_results;
+            count_results.num_threads = num_threads;
+            count_results.count_only_mode = true;
+            octmib(count_results, input_g);
+
+            if (count_results.total_num_mibs != mibs_true.size()) {
+                std::cout << "ERROR: OCTMIB count_only_mode with " << num_threads;
+                std::cout << " threads found " << count_results.total_num_mibs;
+                std::cout << " mibs instead of " << mibs_true.size() << std::endl;
+                error = true;
+            }
+        }
+    }
+
+    return error;
+
+}
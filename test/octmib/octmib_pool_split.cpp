@@ -0,0 +1,87 @@
+/**
+* @authors Eric Horton, Kyle Kloster, Drew van der Poel
+*
+* This file is part of MI-bicliques, https://github.com/TheoryInPractice/MI-bicliques,
+* and is Copyright (C) North Carolina State University, 2018.
+* It is licensed under the three-clause BSD license; see LICENSE.
+*/
+
+#include<iostream>
+#include<memory>
+#include<string>
+#include<vector>
+#include"../../src/algorithms/OCTMIB.h"
+#include"../../src/algorithms/OCTDecomposition.h"
+#include"../../src/algorithms/WorkStealingPool.h"
+
+/**
+ * Test that an OCT-MIB search tree run from a task on a pool, with every bag
+ * built and expanded by subtasks (min_pool_work of 1), builds the same bags
+ * and records the same MIBs in the same order as the tree run on one thread,
+ * for every root of each test graph.
+ */
+int test_octmib_octmib_pool_split(int argc, char ** argv) {
+
+    // Whether or not an error has occurred.
+    bool error = false;
+
+    std::vector<std::string> paths = {"./test/test_graph.txt",
+                                      "./test/test_graph_large.txt",
+                                      "./test/test_graph_mcb_huge.txt"};
+
+    for (auto & path : paths) {
+        Graph g(path, Graph::FILE_FORMAT::adjlist);
+        OrderedVertexSet oct_set, left_partition, right_partition;
+        octdecomposition(g, oct_set, left_partition, right_partition, OCTSearchOptions());
+        OctGraph og(g, oct_set, left_partition, right_partition);
+        auto graph_ptr = std::make_shared<Graph>(og);
+
+        Graph oct_subgraph = og.subgraph(oct_set);
+        auto all_mis_in_oct = get_all_mis(oct_subgraph);
+        convert_node_labels_vector_inplace(all_mis_in_oct, oct_set);
+
+        for (size_t num_threads : {1, 2, 4}) {
+            WorkStealingPool pool(num_threads);
+
+            for (auto & mis : all_mis_in_oct) {
+                OrderedVector mis_in_oct(mis);
+                for (size_t v : mis_in_oct) {
+
+                    OutputOptions serial_results;
+                    OctVertexSeeds seeds = octmib_vertex_seeds(serial_results, og, v, {0});
+                    DuplicatesTable serial_table;
+                    octmib_search_tree(serial_results, graph_ptr, mis_in_oct, seeds, serial_table);
+
+                    OutputOptions pool_results;
+                    pool_results.min_pool_work = 1;
+                    DuplicatesTable pool_table(0, 4);
+                    pool.submit([&] {
+                        octmib_search_tree(pool_results, graph_ptr, mis_in_oct, seeds,
+                                           pool_table, &pool);
+                    });
+                    pool.wait();
+
+                    // Same children, so the same peak memory, as well as the same MIBs
+                    bool same = pool_results.peak_frontier_bytes == serial_results.peak_frontier_bytes &&
+                                pool_results.total_num_mibs == serial_results.total_num_mibs &&
+                                pool_results.mibs_computed.size() == serial_results.mibs_computed.size();
+                    for (size_t idx = 0; same && idx < serial_results.mibs_computed.size(); idx++) {
+                        same = pool_results.mibs_computed[idx].to_string() ==
+                               serial_results.mibs_computed[idx].to_string();
+                    }
+                    if (!same) {
+                        std::cout << "The search tree rooted at " << v << " in " << path;
+                        std::cout << " on a pool of " << num_threads << " found ";
+                        std::cout << pool_results.total_num_mibs << " MIBs instead of the ";
+                        std::cout << serial_results.total_num_mibs << " found serially, ";
+                        std::cout << "or in another order, or built other bags" << std::endl;
+                        error = true;
+                    }
+                }
+            }
+        }
+    }
+
+    return error;
+
+}
@@ -0,0 +1,75 @@
+/**
+* @authors Eric Horton, Kyle Kloster, Drew van der Poel
+*
+* This file is part of MI-bicliques, https://github.com/TheoryInPractice/MI-bicliques,
+* and is Copyright (C) North Carolina State University, 2018.
+* It is licensed under the three-clause BSD license; see LICENSE.
+*/
+
+#include<iostream>
+#include<cmath>
+#include<vector>
+#include<unordered_map>
+#include"../../src/algorithms/OCTMIB.h"
+#include"../../src/algorithms/MIBSampling.h"
+
+/**
+ * Test sample_mibs: every sample must be a MIB, and with enough samples every
+ * MIB is drawn and the weights sum to roughly the number of MIBs.
+ */
+int test_octmib_octmib_sampling(int argc, char ** argv) {
+
+    // Whether or not an error has occurred.
+    bool error = false;
+
+    const std::vector<std::string> paths_to_files = {
+        "./test/test_graph.txt",
+        "./test/test_graph_large.txt",
+        "./test/test_mcbb_large.txt",
+        "./test/test_multi_ccs.txt"
+    };
+
+    for (auto path_to_file : paths_to_files) {
+
+        Graph input_g(path_to_file, Graph::FILE_FORMAT::adjlist);
+
+        std::unordered_map<std::string,size_t> mibs_map;
+        for (auto & mib: octmib(input_g)) {
+            mibs_map[mib.to_string()] = 0;
+        }
+
+        MIBSampleResults sample_results;
+        sample_results.num_samples = 20000;
+        sample_results.seed = 1;
+        sample_mibs(sample_results, input_g);
+
+        for (auto & mib: sample_results.mibs_sampled) {
+            auto iter = mibs_map.find(mib.to_string());
+            if (iter == mibs_map.end()) {
+                std::cout << "ERROR: sample_mibs drew non-MIB " << mib.to_string();
+                std::cout << " on " << path_to_file << std::endl;
+                error = true;
+            }
+            else iter->second++;
+        }
+
+        for (auto & iter: mibs_map) {
+            if (iter.second == 0) {
+                std::cout << "ERROR: sample_mibs never drew MIB " << iter.first;
+                std::cout << " on " << path_to_file << std::endl;
+                error = true;
+            }
+        }
+
+        double relative_error = std::abs(sample_results.estimated_num_mibs - mibs_map.size()) / mibs_map.size();
+        std::cout << path_to_file << ": estimated " << sample_results.estimated_num_mibs;
+        std::cout << " MIBs, true number " << mibs_map.size() << std::endl;
+        if (relative_error > 0.1) {
+            std::cout << "ERROR: sample_mibs estimate is off by " << relative_error << std::endl;
+            error = true;
+        }
+    }
+
+    return error;
+
+}
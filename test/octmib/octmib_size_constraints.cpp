@@ -0,0 +1,111 @@
+/**
+* @authors Eric Horton, Kyle Kloster, Drew van der Poel
+*
+* This file is part of MI-bicliques, https://github.com/TheoryInPractice/MI-bicliques,
+* and is Copyright (C) North Carolina State University, 2018.
+* It is licensed under the three-clause BSD license; see LICENSE.
+*/
+
+#include<iostream>
+#include<vector>
+#include<unordered_map>
+#include"../../src/algorithms/OCTMIB.h"
+#include"../../src/algorithms/LexMIB.h"
+
+/**
+ * Test that size constraints pushed into OCTMIB (and LexMIB) give exactly the
+ * MIBs obtained by enumerating everything and filtering afterwards.
+ */
+int test_octmib_octmib_size_constraints(int argc, char ** argv) {
+
+    // Whether or not an error has occurred.
+    bool error = false;
+
+    const std::vector<std::string> paths_to_files = {
+        "./test/test_graph_large.txt",
+        "./test/test_mcbb_large.txt",
+        "./test/test_multi_ccs.txt"
+    };
+
+    // Each entry is {min_left, min_right, max_left, max_right}
+    const size_t no_max = std::numeric_limits<size_t>::max();
+    const std::vector<std::vector<size_t>> bounds = {
+        {2, 2, no_max, no_max},
+        {2, 3, no_max, no_max},
+        {4, 1, no_max, no_max},
+        {1, 1, 3, no_max},
+        {2, 2, 4, 5}
+    };
+
+    for (auto path_to_file : paths_to_files) {
+
+        Graph input_g(path_to_file, Graph::FILE_FORMAT::adjlist);
+        auto all_mibs = octmib(input_g);
+
+        for (auto bound : bounds) {
+
+            SizeConstraints size_constraints;
+            size_constraints.min_left = bound[0];
+            size_constraints.min_right = bound[1];
+            size_constraints.max_left = bound[2];
+            size_constraints.max_right = bound[3];
+
+            // Post-filtered ground truth
+            std::unordered_map<std::string,size_t> mibs_map_true;
+            for (auto & mib: all_mibs) {
+                if (size_constraints.is_satisfied_by(mib)) mibs_map_true[mib.to_string()] = 0;
+            }
+
+            OutputOptions octmib_results;
+            octmib_results.size_constraints = size_constraints;
+            octmib(octmib_results, input_g);
+
+            LexMIBResults lexmib_results;
+            lexmib_results.size_constraints = size_constraints;
+            lexmib(lexmib_results, input_g);
+
+            const std::vector<std::vector<BicliqueLite>> computed = {
+                octmib_results.mibs_computed,
+                lexmib_results.mibs_computed
+            };
+
+            for (auto & mibs_computed : computed) {
+
+                auto mibs_map = mibs_map_true;
+                for (auto mib: mibs_computed) {
+                    mibs_map[mib.to_string()] ++;
+                }
+
+                if (mibs_map_true.size() != mibs_computed.size()) {
+                    std::cout << "ERROR: size constraints gave wrong number of mibs on ";
+                    std::cout << path_to_file << ": " << mibs_computed.size();
+                    std::cout << " instead of correct number " << mibs_map_true.size() << std::endl;
+                    error=true;
+                }
+                for (auto iter: mibs_map) {
+                    if (iter.second != 1) {
+                        std::cout << "ERROR: size constraints wrong about mib " << iter.first;
+                        std::cout << "; number of times found: " << iter.second << std::endl;
+                        error=true;
+                    }
+                }
+            }
+
+            // Count-only mode must agree as well
+            OutputOptions count_results;
+            count_results.size_constraints = size_constraints;
+            count_results.count_only_mode = true;
+            octmib(count_results, input_g);
+
+            if (count_results.total_num_mibs != mibs_map_true.size()) {
+                std::cout << "ERROR: size constraints count_only_mode found wrong number of mibs: ";
+                std::cout << count_results.total_num_mibs << " instead of correct number ";
+                std::cout << mibs_map_true.size() << std::endl;
+                error=true;
+            }
+        }
+    }
+
+    return error;
+
+}
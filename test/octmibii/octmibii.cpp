@@ -0,0 +1,98 @@
+/**
+* @authors Eric Horton, Kyle Kloster, Drew van der Poel
+*
+* This file is part of MI-bicliques, https://github.com/TheoryInPractice/MI-bicliques,
+* and is Copyright (C) North Carolina State University, 2018.
+* It is licensed under the three-clause BSD license; see LICENSE.
+*/
+
+#include<algorithm>
+#include<iostream>
+#include<string>
+#include<unordered_map>
+#include<vector>
+#include"../../src/graph/Graph.h"
+#include"../../src/graph/OrderedVertexSet.h"
+#include"../../src/algorithms/OCTMIB.h"
+#include"../../src/algorithms/OCTMIBII.h"
+
+
+/**
+ * Test OCTMIBII::octmibii and OCTMIBII::make_maximal -- that OCT-MIB-II finds
+ * the same bicliques as OCT-MIB, on one thread and on four, and that make_maximal grows a biclique by
+ * candidates from both expansion sets.
+ */
+int test_octmibii_octmibii(int argc, char ** argv) {
+
+    // Whether or not an error has occurred.
+    bool error = false;
+
+    std::vector<std::string> paths = {"./test/test_graph.txt",
+                                      "./test/test_multi_ccs.txt",
+                                      "./test/test_graph_ban.txt",
+                                      "./test/test_graph_delay_conditions.txt",
+                                      "./test/test_graph_large.txt",
+                                      "./test/test_graph_mcb_huge.txt"};
+
+    for (auto & path : paths) {
+        Graph g(path, Graph::FILE_FORMAT::adjlist);
+
+        OutputOptions octmib_results;
+        octmib(octmib_results, g, OrderedVertexSet(), OrderedVertexSet(), OrderedVertexSet());
+        std::vector<std::string> expected;
+        for (auto & b : octmib_results.mibs_computed) expected.push_back(b.to_string());
+        std::sort(expected.begin(), expected.end());
+
+        for (size_t num_threads : {1, 4}) {
+            OutputOptions octmibii_results;
+            octmibii_results.num_threads = num_threads;
+            octmibii(octmibii_results, g, OrderedVertexSet(), OrderedVertexSet(), OrderedVertexSet());
+
+            std::vector<std::string> found;
+            for (auto & b : octmibii_results.mibs_computed) found.push_back(b.to_string());
+            std::sort(found.begin(), found.end());
+            if (found != expected || octmibii_results.total_num_mibs != expected.size()) {
+                std::cout << "OCT-MIB-II on " << num_threads << " threads found " << found.size();
+                std::cout << " bicliques in " << path << " instead of OCT-MIB's ";
+                std::cout << expected.size() << std::endl;
+                error = true;
+            }
+        }
+    }
+
+    // In the 5-cycle 0-1-2-3-4, with OCT set {0}
+    std::vector<std::vector<size_t>> adj_list = { {1,4}, {0,2}, {1,3}, {2,4}, {0,3} };
+    std::unordered_map<size_t,std::string> node_labels = {
+        {0, "0"}, {1, "1"}, {2, "2"}, {3, "3"}, {4, "4"}
+    };
+    Graph cycle(std::vector<size_t>({0, 1, 2, 3, 4}), adj_list, node_labels);
+    OrderedVertexSet oct_set(std::vector<size_t>({0}));
+    OrderedVertexSet left_right(std::vector<size_t>({1, 2, 3, 4}));
+
+    // 0 joins the right side of (1, 2)
+    BicliqueLite edge(std::vector<size_t>({1}), std::vector<size_t>({2}));
+    if (!make_maximal(cycle, edge, oct_set, left_right) ||
+        edge != BicliqueLite(std::vector<size_t>({1}), std::vector<size_t>({0, 2}))) {
+        std::cout << "OCT-MIB-II make_maximal grew (1, 2) into " << edge.to_string() << std::endl;
+        error = true;
+    }
+
+    // 2 or 4 could join ({1}, {0}), so it is not maximal
+    BicliqueLite star(std::vector<size_t>({1}), std::vector<size_t>({0}));
+    if (make_maximal(cycle, star, oct_set, left_right) ||
+        star != BicliqueLite(std::vector<size_t>({1}), std::vector<size_t>({0}))) {
+        std::cout << "OCT-MIB-II make_maximal kept ({1}, {0}), which 4 extends" << std::endl;
+        error = true;
+    }
+
+    // Growing (2, 3) by the non-OCT vertices adds 1, after which 4 cannot join
+    BicliqueLite other_edge(std::vector<size_t>({2}), std::vector<size_t>({3}));
+    if (!make_maximal(cycle, other_edge, left_right, OrderedVertexSet()) ||
+        other_edge != BicliqueLite(std::vector<size_t>({2}), std::vector<size_t>({1, 3}))) {
+        std::cout << "OCT-MIB-II make_maximal grew (2, 3) into " << other_edge.to_string() << std::endl;
+        error = true;
+    }
+
+    return error;
+
+}
@@ -0,0 +1,118 @@
+/**
+* @authors Eric Horton, Kyle Kloster, Drew van der Poel
+*
+* This file is part of MI-bicliques, https://github.com/TheoryInPractice/MI-bicliques,
+* and is Copyright (C) North Carolina State University, 2018.
+* It is licensed under the three-clause BSD license; see LICENSE.
+*/
+
+#include<iostream>
+#include<vector>
+#include"../../src/graph/Graph.h"
+#include"../../src/graph/OrderedVertexSet.h"
+#include"../../src/algorithms/OCTPortfolio.h"
+#include"../../src/algorithms/SimpleOCT.h"
+
+
+namespace {
+
+/**
+ * Whether oct_set, left_partition and right_partition split the vertices of
+ * g, with no edges within either partition.
+ */
+bool is_oct_decomposition(const Graph & g,
+                          const OrderedVertexSet & oct_set,
+                          const OrderedVertexSet & left_partition,
+                          const OrderedVertexSet & right_partition) {
+
+    if (oct_set.size() + left_partition.size() + right_partition.size() != g.get_num_vertices()) {
+        return false;
+    }
+    for (size_t v = 0; v < g.get_num_vertices(); v++) {
+        size_t count = oct_set.has_vertex(v) + left_partition.has_vertex(v) +
+                       right_partition.has_vertex(v);
+        if (count != 1) return false;
+    }
+    for (auto v : left_partition) {
+        if (!g.is_completely_independent_from(v, left_partition.set_minus(std::vector<size_t>({v})))) {
+            return false;
+        }
+    }
+    for (auto v : right_partition) {
+        if (!g.is_completely_independent_from(v, right_partition.set_minus(std::vector<size_t>({v})))) {
+            return false;
+        }
+    }
+    return true;
+
+}
+
+}
+
+
+/**
+ * Test OCTPortfolio::octportfolio -- that it returns a valid OCT decomposition
+ * no larger than simpleoct's, the smallest of those its starts found, the
+ * same on one thread and on several, and reports every start.
+ */
+int test_octportfolio_octportfolio(int argc, char ** argv) {
+
+    // Whether or not an error has occurred.
+    bool error = false;
+
+    std::vector<std::string> paths = {"./test/test_graph.txt",
+                                      "./test/test_graph_large.txt",
+                                      "./test/test_graph_mcb_huge.txt",
+                                      "./test/test_multi_ccs.txt"};
+
+    for (auto & path : paths) {
+        Graph g(path, Graph::FILE_FORMAT::adjlist);
+
+        OrderedVertexSet simple_oct, simple_left, simple_right;
+        simpleoct(g, simple_oct, simple_left, simple_right);
+
+        // Randomized colorings alone, then with local search
+        for (double time_budget : {0.0, 10.0}) {
+            OCTSearchOptions options;
+            options.portfolio_starts = 12;
+            options.time_budget = time_budget;
+
+            OrderedVertexSet oct_set, left_partition, right_partition;
+            OCTPortfolioReport report = octportfolio(g, oct_set, left_partition,
+                                                     right_partition, options);
+
+            if (!is_oct_decomposition(g, oct_set, left_partition, right_partition)) {
+                std::cout << "OCTPortfolio output invalid decomposition of " << path << std::endl;
+                error = true;
+            }
+            if (oct_set.size() > simple_oct.size()) {
+                std::cout << "OCTPortfolio output oct set of size " << oct_set.size();
+                std::cout << " on " << path << ", larger than " << simple_oct.size() << std::endl;
+                error = true;
+            }
+
+            size_t num_starts = 0;
+            for (auto & size_count : report.starts_by_oct_size) num_starts += size_count.second;
+            if (num_starts != 12 || report.starts_by_oct_size.begin()->first != oct_set.size()) {
+                std::cout << "OCTPortfolio reported " << num_starts << " starts, the smallest";
+                std::cout << " of size " << report.starts_by_oct_size.begin()->first;
+                std::cout << ", on " << path << std::endl;
+                error = true;
+            }
+
+            options.num_threads = 4;
+            OrderedVertexSet oct_parallel, left_parallel, right_parallel;
+            OCTPortfolioReport parallel_report = octportfolio(g, oct_parallel, left_parallel,
+                                                              right_parallel, options);
+            if (oct_parallel != oct_set || left_parallel != left_partition ||
+                parallel_report.best_start != report.best_start) {
+                std::cout << "OCTPortfolio on 4 threads kept start " << parallel_report.best_start;
+                std::cout << " instead of " << report.best_start << " on " << path << std::endl;
+                error = true;
+            }
+        }
+    }
+
+    return error;
+
+}
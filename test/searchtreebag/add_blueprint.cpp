@@ -67,9 +67,6 @@ int test_searchtreebag_add_blueprint(int argc, char **argv) {
     BlueprintLite test_blueprint(
                                  biclique_blueprint_id,
                                  graph_ptr,
-                                 std::make_shared<std::vector<size_t>>(iterative_wait),
-                                 std::make_shared<OrderedVertexSet>(iterative_in),
-                                 std::make_shared<std::vector<size_t>>(iterative_past),
                                  completely_connected_in,
                                  completely_connected_out,
                                  independent_from_in,
@@ -84,6 +81,7 @@ int test_searchtreebag_add_blueprint(int argc, char **argv) {
                            iterative_in,
                            iterative_past,
                            expand_node);
+    const IterativeSets & iterative = test_bag.get_iterative();
 
     test_bag.add_blueprint(test_blueprint);
     // Check size
@@ -93,11 +91,11 @@ int test_searchtreebag_add_blueprint(int argc, char **argv) {
     }
 
     BlueprintLite computed_blueprint = test_bag.front();
-    if ( computed_blueprint.get_biclique() != test_blueprint.get_biclique()) {
+    if ( computed_blueprint.get_biclique(iterative) != test_blueprint.get_biclique(iterative)) {
         std::cout << "SearchTreeBag front(), 1st, returns incorrect biclique ";
-        std::cout << computed_blueprint.get_biclique_string() << std::endl;
+        std::cout << computed_blueprint.get_biclique_string(iterative) << std::endl;
         std::cout << "Instead of true biclique ";
-        std::cout << test_blueprint.get_biclique_string() << std::endl;
+        std::cout << test_blueprint.get_biclique_string(iterative) << std::endl;
         error = true;
     }
 
@@ -113,9 +111,6 @@ int test_searchtreebag_add_blueprint(int argc, char **argv) {
     BlueprintLite test_blueprint2(
                                  biclique_blueprint_id,
                                  graph_ptr,
-                                 std::make_shared<std::vector<size_t>>(iterative_wait),
-                                 std::make_shared<OrderedVertexSet>(iterative_in),
-                                 std::make_shared<std::vector<size_t>>(iterative_past),
                                  completely_connected_in,
                                  completely_connected_out,
                                  independent_from_in,
@@ -136,11 +131,11 @@ int test_searchtreebag_add_blueprint(int argc, char **argv) {
         // a hacky way of setting computed_blueprint equal to back()
         computed_blueprint = temp_blueprint;
     }
-    if ( computed_blueprint.get_biclique() != test_blueprint2.get_biclique()) {
+    if ( computed_blueprint.get_biclique(iterative) != test_blueprint2.get_biclique(iterative)) {
         std::cout << "SearchTreeBag front(), 2nd, returns incorrect biclique ";
-        std::cout << computed_blueprint.get_biclique_string() << std::endl;
+        std::cout << computed_blueprint.get_biclique_string(iterative) << std::endl;
         std::cout << "Instead of true biclique ";
-        std::cout << test_blueprint2.get_biclique_string() << std::endl;
+        std::cout << test_blueprint2.get_biclique_string(iterative) << std::endl;
         error = true;
     }
 
@@ -67,9 +67,6 @@ int test_searchtreebag_ban_vertex_in_blueprints(int argc, char **argv) {
     BlueprintLite test_blueprint(
                                  biclique_blueprint_id,
                                  graph_ptr,
-                                 std::make_shared<std::vector<size_t>>(iterative_wait),
-                                 std::make_shared<OrderedVertexSet>(iterative_in),
-                                 std::make_shared<std::vector<size_t>>(iterative_past),
                                  completely_connected_in,
                                  completely_connected_out,
                                  independent_from_in,
@@ -91,9 +88,6 @@ int test_searchtreebag_ban_vertex_in_blueprints(int argc, char **argv) {
     BlueprintLite test_blueprint2(
                                  biclique_blueprint_id,
                                  graph_ptr,
-                                 std::make_shared<std::vector<size_t>>(iterative_wait),
-                                 std::make_shared<OrderedVertexSet>(iterative_in),
-                                 std::make_shared<std::vector<size_t>>(iterative_past),
                                  completely_connected_in,
                                  completely_connected_out,
                                  independent_from_in,
@@ -104,6 +98,7 @@ int test_searchtreebag_ban_vertex_in_blueprints(int argc, char **argv) {
 
     // Create search tree bag
     SearchTreeBag test_bag;
+    const IterativeSets & iterative = test_bag.get_iterative();
     test_bag.add_blueprint(test_blueprint);
     test_bag.add_blueprint(test_blueprint2);
 
@@ -126,13 +121,13 @@ int test_searchtreebag_ban_vertex_in_blueprints(int argc, char **argv) {
 
         // only check the altered blueprint
         if (blueprint_from_bag.get_id() == 0) {
-            if (!blueprint_from_bag.is_banned(vertex)) {
+            if (!blueprint_from_bag.is_banned(iterative, vertex)) {
                 std::cout << "Blueprint with ID = 0 should ban vertex, but doesn't."<< std::endl;
                 error = true;
             }
         }
         else {
-            if (blueprint_from_bag.is_banned(vertex)) {
+            if (blueprint_from_bag.is_banned(iterative, vertex)) {
                 std::cout << "Blueprint with ID = "<< blueprint_from_bag.get_id()
                 << " should not ban vertex, but does."<< std::endl;
                 error = true;
@@ -7,6 +7,7 @@
 */
 
 
+#include <algorithm>
 #include <iostream>
 #include <vector>
 #include "../../src/graph/SearchTreeBag.h"
@@ -51,24 +52,30 @@ int test_searchtreebag_constructor(int argc, char **argv) {
                             expanded_vertex);
 
     // Check iterative sets inside searchtreebag
-    if (test_bag2.get_iterative_wait() != iterative_wait) {
-        std::cout << "SearchTreeBag get_iterative_wait should return ";
+    const IterativeSets & iterative = test_bag2.get_iterative();
+    std::vector<size_t> bag_wait(iterative.get_wait().begin(), iterative.get_wait().end());
+    if (bag_wait != iterative_wait) {
+        std::cout << "SearchTreeBag iterative_wait should be ";
         std::cout << vector_to_string(iterative_wait) << std::endl;
-        std::cout << "not " << vector_to_string(test_bag2.get_iterative_wait());
+        std::cout << "not " << vector_to_string(bag_wait);
         std::cout << std::endl;
         error = true;
     }
-    if (test_bag2.get_iterative_in() != iterative_in) {
-        std::cout << "SearchTreeBag get_iterative_in should return ";
+    if (iterative.get_in() != iterative_in.get_vertices() ||
+        iterative.get_in_size() != iterative_in.size()) {
+        std::cout << "SearchTreeBag iterative_in should be ";
         std::cout << iterative_in.to_string() << std::endl;
-        std::cout << "not " << test_bag2.get_iterative_in().to_string();
+        std::cout << "not " << vector_to_string(iterative.get_in());
         std::cout << std::endl;
         error = true;
     }
-    if (test_bag2.get_iterative_past() != iterative_past) {
-        std::cout << "SearchTreeBag get_iterative_past should return ";
+    // iterative_past comes most recently passed over first
+    std::vector<size_t> bag_past(iterative.get_past().begin(), iterative.get_past().end());
+    std::reverse(bag_past.begin(), bag_past.end());
+    if (bag_past != iterative_past || iterative.get_past().size() != iterative_past.size()) {
+        std::cout << "SearchTreeBag iterative_past should be ";
         std::cout << vector_to_string(iterative_past) << std::endl;
-        std::cout << "not " << vector_to_string(test_bag2.get_iterative_past());
+        std::cout << "not " << vector_to_string(bag_past);
         std::cout << std::endl;
         error = true;
     }
@@ -80,26 +87,20 @@ int test_searchtreebag_constructor(int argc, char **argv) {
         error = true;
     }
 
-    // Check pointers to iterative sets inside searchtreebag
-    if (*test_bag2.get_iterative_wait_ptr() != iterative_wait) {
-        std::cout << "SearchTreeBag get_iterative_wait_ptr should return ";
-        std::cout << vector_to_string(iterative_wait) << std::endl;
-        std::cout << "not " << vector_to_string(*test_bag2.get_iterative_wait_ptr());
-        std::cout << std::endl;
-        error = true;
-    }
-    if (*test_bag2.get_iterative_in_ptr() != iterative_in) {
-        std::cout << "SearchTreeBag get_iterative_in_ptr should return ";
-        std::cout << iterative_in.to_string() << std::endl;
-        std::cout << "not " << test_bag2.get_iterative_in_ptr()->to_string();
-        std::cout << std::endl;
-        error = true;
-    }
-    if (*test_bag2.get_iterative_past_ptr() != iterative_past) {
-        std::cout << "SearchTreeBag get_iterative_past_ptr should return ";
-        std::cout << vector_to_string(iterative_past) << std::endl;
-        std::cout << "not " << vector_to_string(*test_bag2.get_iterative_past_ptr());
-        std::cout << std::endl;
+    // The child of a bag shares its sets: expanding on 7 moves 6 to
+    // iterative_past and leaves 8 waiting
+    SearchTreeBag child_bag(iterative.child(7), 7);
+    const IterativeSets & child_iterative = child_bag.get_iterative();
+    std::vector<size_t> child_past(child_iterative.get_past().begin(),
+                                   child_iterative.get_past().end());
+    if (child_iterative.get_wait().size() != 1 || child_iterative.get_wait()[0] != 8 ||
+        child_iterative.get_in() != std::vector<size_t>({3,4,5,7}) ||
+        child_past != std::vector<size_t>({6,2,1,0}) ||
+        child_bag.get_last_iter_in_node() != 7) {
+        std::cout << "Child of SearchTreeBag has iterative_wait of size ";
+        std::cout << child_iterative.get_wait().size() << ", iterative_in ";
+        std::cout << vector_to_string(child_iterative.get_in()) << " and iterative_past ";
+        std::cout << vector_to_string(child_past) << std::endl;
         error = true;
     }
 
@@ -58,7 +58,8 @@ int test_searchtreebagplus_all_functions(int argc, char **argv) {
                                 expanded_vertex);
 
     // Check iterative sets inside searchtreebag
-    if (test_bag2.get_iterative_wait() != iterative_wait) {
+    if (std::vector<size_t>(test_bag2.get_iterative_wait().begin(),
+                            test_bag2.get_iterative_wait().end()) != iterative_wait) {
         std::cout << "SearchTreeBagPlus get_iterative_wait should return ";
         std::cout << vector_to_string(iterative_wait) << std::endl;
         std::cout << "not " << vector_to_string(test_bag2.get_iterative_wait());
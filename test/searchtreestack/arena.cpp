@@ -0,0 +1,96 @@
+/**
+* @authors Eric Horton, Kyle Kloster, Drew van der Poel
+*
+* This file is part of MI-bicliques, https://github.com/TheoryInPractice/MI-bicliques,
+* and is Copyright (C) North Carolina State University, 2018.
+* It is licensed under the three-clause BSD license; see LICENSE.
+*/
+
+#include<iostream>
+#include<vector>
+#include"../../src/graph/SearchTreeBag.h"
+#include"../../src/graph/SearchTreeStack.h"
+
+
+/**
+ * Test the SearchTreeArena of a SearchTreeStack: bags made with the stack's
+ * allocator allocate from its arena and keep their storage when swapped on
+ * and off the stack, a bag from the heap is copied into the arena when
+ * pushed, and every byte is given back once the bags are gone.
+ */
+int test_searchtreestack_arena(int argc, char ** argv) {
+
+    // Whether or not an error has occurred.
+    bool error = false;
+
+    SearchTreeStack<SearchTreeBag> stack;
+    const SearchTreeArena & arena = stack.get_arena();
+
+    // A bag of the stack's arena, with one blueprint
+    SearchTreeBag bag(std::vector<size_t>({4, 5}), OrderedVertexSet(std::vector<size_t>({1})),
+                      std::vector<size_t>({0}), 1, stack.get_allocator());
+    BlueprintLite blueprint(stack.get_allocator());
+    bag.add_blueprint(blueprint);
+
+    if (arena.get_bytes_in_use() == 0 || arena.get_bytes_reserved() < arena.get_bytes_in_use()) {
+        std::cout << "Arena has " << arena.get_bytes_in_use() << " bytes in use of ";
+        std::cout << arena.get_bytes_reserved() << " reserved" << std::endl;
+        error = true;
+    }
+
+    // Swapped onto the stack without copying
+    size_t in_use = arena.get_bytes_in_use();
+    stack.push(bag);
+    stack.pop(bag);
+    if (arena.get_bytes_in_use() < in_use || bag.size() != 1 ||
+        bag.get_allocator().resource() != &arena) {
+        std::cout << "Bag of the arena lost its storage on the stack" << std::endl;
+        error = true;
+    }
+
+    // A heap bag is copied into the arena, and popped back out intact
+    SearchTreeBag heap_bag(std::vector<size_t>({7}), OrderedVertexSet(std::vector<size_t>({2})),
+                           std::vector<size_t>({}), 2);
+    heap_bag.add_blueprint(BlueprintLite());
+    heap_bag.add_blueprint(BlueprintLite());
+    stack.push(heap_bag);
+    if (stack.top().get_allocator().resource() != &arena || stack.top().size() != 2) {
+        std::cout << "Heap bag was not copied into the arena when pushed" << std::endl;
+        error = true;
+    }
+    stack.pop(heap_bag);
+    if (heap_bag.get_allocator().resource() == &arena || heap_bag.size() != 2 ||
+        heap_bag.get_expanded_vertex() != 2) {
+        std::cout << "Heap bag popped with " << heap_bag.size() << " blueprints and ";
+        std::cout << "expanded vertex " << heap_bag.get_expanded_vertex() << std::endl;
+        error = true;
+    }
+
+    if (arena.get_peak_bytes_in_use() < in_use ||
+        arena.get_peak_bytes_reserved() < arena.get_peak_bytes_in_use()) {
+        std::cout << "Arena peaked at " << arena.get_peak_bytes_in_use() << " bytes in use of ";
+        std::cout << arena.get_peak_bytes_reserved() << " reserved" << std::endl;
+        error = true;
+    }
+
+    // Once the bags of an arena are gone, only the stack's own slots are in use
+    SearchTreeStack<SearchTreeBag> other_stack;
+    SearchTreeBag empty_bag(other_stack.get_allocator());
+    other_stack.push(empty_bag);
+    other_stack.pop(empty_bag);
+    size_t slots_in_use = other_stack.get_arena().get_bytes_in_use();
+    {
+        SearchTreeBag other_bag(other_stack.get_allocator());
+        other_bag.add_blueprint(BlueprintLite(other_stack.get_allocator()));
+        other_stack.push(other_bag);
+        other_stack.pop(other_bag);
+    }
+    if (other_stack.get_arena().get_bytes_in_use() != slots_in_use) {
+        std::cout << "Arena has " << other_stack.get_arena().get_bytes_in_use();
+        std::cout << " bytes in use after its bags are gone, not " << slots_in_use << std::endl;
+        error = true;
+    }
+
+    return error;
+
+}
@@ -0,0 +1,164 @@
+/**
+* @authors Eric Horton, Kyle Kloster, Drew van der Poel
+*
+* This file is part of MI-bicliques, https://github.com/TheoryInPractice/MI-bicliques,
+* and is Copyright (C) North Carolina State University, 2018.
+* It is licensed under the three-clause BSD license; see LICENSE.
+*/
+
+#include<algorithm>
+#include<iostream>
+#include<string>
+#include<unordered_map>
+#include<vector>
+#include"../../src/graph/Graph.h"
+#include"../../src/graph/OrderedVector.h"
+#include"../../src/graph/OrderedVertexSet.h"
+#include"../../src/graph/SearchTreeBag.h"
+#include"../../src/graph/SearchTreeStack.h"
+#include"../../src/algorithms/MaximalCrossingBicliques.h"
+#include"../../src/algorithms/MaximalCrossingBicliquesBipartite.h"
+#include"../../src/algorithms/OCTMIB.h"
+#include"../../src/algorithms/SimpleOCT.h"
+#include"../ground_truth_mibs.h"
+
+
+namespace {
+
+// Sorted string forms of a list of bicliques
+std::vector<std::string> biclique_strings(const std::vector<BicliqueLite> & bicliques) {
+    std::vector<std::string> strings;
+    for (auto & biclique : bicliques) strings.push_back(biclique.to_string());
+    std::sort(strings.begin(), strings.end());
+    return strings;
+}
+
+}
+
+
+/**
+ * Test SearchTreeStack, and that bounding the search tree frontier (so that
+ * children are built one at a time once the bound is passed) changes neither
+ * the bicliques found by MCB and MCBB nor the MIBs found by OCTMIB.
+ */
+int test_searchtreestack_frontier_bound(int argc, char ** argv) {
+
+    // Whether or not an error has occurred.
+    bool error = false;
+
+    // Bags come off the stack last in first out, or in push order once reversed
+    SearchTreeStack<SearchTreeBag> stack;
+    SearchTreeBag bag;
+    for (size_t size = 1; size <= 3; size++) {
+        bag.clear();
+        for (size_t idx = 0; idx < size; idx++) bag.add_blueprint(BlueprintLite());
+        stack.push(bag);
+    }
+    if (stack.size() != 3 || stack.memory_usage() == 0 ||
+        stack.peak_memory_usage() != stack.memory_usage()) {
+        std::cout << "Stack holds " << stack.size() << " bags in ";
+        std::cout << stack.memory_usage() << " bytes" << std::endl;
+        error = true;
+    }
+    stack.reverse(1);
+    for (size_t size : {2, 3, 1}) {
+        stack.pop(bag);
+        if (bag.size() != size) {
+            std::cout << "Popped bag with " << bag.size();
+            std::cout << " blueprints instead of " << size << std::endl;
+            error = true;
+        }
+    }
+    if (!stack.empty() || stack.memory_usage() != 0) {
+        std::cout << "Empty stack still holds " << stack.memory_usage() << " bytes" << std::endl;
+        error = true;
+    }
+
+    // MCB, as in test maximalcrossingbicliques_mcb_huge
+    Graph g_huge("./test/test_graph_mcb_huge.txt", Graph::FILE_FORMAT::adjlist);
+    OrderedVector ind_set(std::vector<size_t>({1, 32, 33, 36, 38}));
+
+    OutputOptions mcb_unbounded;
+    maximal_crossing_bicliques(mcb_unbounded, g_huge, ind_set);
+
+    OutputOptions mcb_bounded;
+    mcb_bounded.max_frontier_bytes = 1;
+    maximal_crossing_bicliques(mcb_bounded, g_huge, ind_set);
+
+    if (biclique_strings(mcb_bounded.mibs_computed) != biclique_strings(mcb_unbounded.mibs_computed)) {
+        std::cout << "MCB with bounded frontier found " << mcb_bounded.mibs_computed.size();
+        std::cout << " bicliques, unbounded found " << mcb_unbounded.mibs_computed.size() << std::endl;
+        error = true;
+    }
+    if (mcb_bounded.peak_frontier_bytes == 0 ||
+        mcb_bounded.peak_frontier_bytes > mcb_unbounded.peak_frontier_bytes) {
+        std::cout << "MCB frontier peaked at " << mcb_bounded.peak_frontier_bytes;
+        std::cout << " bytes bounded and " << mcb_unbounded.peak_frontier_bytes;
+        std::cout << " bytes unbounded" << std::endl;
+        error = true;
+    }
+
+    // MCBB, as in test maximalcrossingbicliques_mcb_bipartite_large
+    Graph g_bipartite("./test/test_mcbb_large.txt", Graph::FILE_FORMAT::adjlist);
+    OrderedVertexSet oct_set, left_partition, right_partition;
+    simpleoct(g_bipartite, oct_set, left_partition, right_partition);
+
+    OutputOptions mcbb_unbounded;
+    maximal_crossing_bicliques_bipartite(mcbb_unbounded, g_bipartite,
+                                         left_partition.get_vertices(),
+                                         right_partition.get_vertices());
+
+    OutputOptions mcbb_bounded;
+    mcbb_bounded.max_frontier_bytes = 1;
+    maximal_crossing_bicliques_bipartite(mcbb_bounded, g_bipartite,
+                                         left_partition.get_vertices(),
+                                         right_partition.get_vertices());
+
+    if (biclique_strings(mcbb_bounded.mibs_computed) != biclique_strings(mcbb_unbounded.mibs_computed)) {
+        std::cout << "MCBB with bounded frontier found " << mcbb_bounded.mibs_computed.size();
+        std::cout << " bicliques, unbounded found " << mcbb_unbounded.mibs_computed.size() << std::endl;
+        error = true;
+    }
+    if (mcbb_bounded.peak_frontier_bytes == 0 ||
+        mcbb_bounded.peak_frontier_bytes > mcbb_unbounded.peak_frontier_bytes) {
+        std::cout << "MCBB frontier peaked at " << mcbb_bounded.peak_frontier_bytes;
+        std::cout << " bytes bounded and " << mcbb_unbounded.peak_frontier_bytes;
+        std::cout << " bytes unbounded" << std::endl;
+        error = true;
+    }
+
+    // OCTMIB with a bounded frontier, sequential and parallel
+    Graph g("./test/test_graph_large.txt", Graph::FILE_FORMAT::adjlist);
+    ground_truth_mibs GT;
+    auto mibs_true = GT.mibs_true_raw("./test/ground_truth_large.txt");
+
+    for (size_t num_threads : {1, 4}) {
+
+        std::unordered_map<std::string,size_t> mibs_map;
+        for (auto & mib : mibs_true) mibs_map[vector_to_string(mib)] = 0;
+
+        OutputOptions octmib_results;
+        octmib_results.num_threads = num_threads;
+        octmib_results.max_frontier_bytes = 1;
+        octmib(octmib_results, g);
+
+        for (auto & mib : octmib_results.mibs_computed) mibs_map[mib.to_string()]++;
+
+        if (octmib_results.mibs_computed.size() != mibs_true.size()) {
+            std::cout << "ERROR: OCTMIB with bounded frontier and " << num_threads << " threads found ";
+            std::cout << octmib_results.mibs_computed.size() << " mibs instead of correct number ";
+            std::cout << mibs_true.size() << std::endl;
+            error = true;
+        }
+        for (auto iter : mibs_map) {
+            if (iter.second != 1) {
+                std::cout << "ERROR: OCTMIB with bounded frontier found mib " << iter.first << " ";
+                std::cout << iter.second << " times" << std::endl;
+                error = true;
+            }
+        }
+    }
+
+    return error;
+
+}
@@ -0,0 +1,64 @@
+/**
+* @authors Eric Horton, Kyle Kloster, Drew van der Poel
+*
+* This file is part of MI-bicliques, https://github.com/TheoryInPractice/MI-bicliques,
+* and is Copyright (C) North Carolina State University, 2018.
+* It is licensed under the three-clause BSD license; see LICENSE.
+*/
+
+#include<atomic>
+#include<iostream>
+#include<vector>
+#include"../../src/algorithms/WorkStealingPool.h"
+
+/**
+ * Test WorkStealingPool on a tree of tasks: every task below a given depth
+ * submits two children. wait() must return only once the whole tree has run,
+ * and every task must see a valid worker index.
+ */
+int test_workstealingpool_nested_tasks(int argc, char ** argv) {
+
+    // Whether or not an error has occurred.
+    bool error = false;
+
+    const size_t depth = 12;
+    std::atomic<size_t> num_tasks_run(0);
+    std::atomic<size_t> num_bad_indices(0);
+
+    for (size_t num_threads : {1, 2, 4}) {
+
+        num_tasks_run = 0;
+        WorkStealingPool pool(num_threads);
+
+        std::function<void(size_t)> spawn = [&](size_t level) {
+            num_tasks_run++;
+            if (pool.worker_index() >= pool.size()) num_bad_indices++;
+            if (level == depth) return;
+            pool.submit([&, level] { spawn(level + 1); });
+            pool.submit([&, level] { spawn(level + 1); });
+        };
+
+        pool.submit([&] { spawn(0); });
+        pool.wait();
+
+        size_t expected = (size_t(1) << (depth + 1)) - 1;
+        if (num_tasks_run != expected) {
+            std::cout << "With " << num_threads << " threads, " << num_tasks_run;
+            std::cout << " tasks ran instead of " << expected << std::endl;
+            error = true;
+        }
+
+        if (pool.worker_index() != pool.size()) {
+            std::cout << "worker_index should be size() outside the pool" << std::endl;
+            error = true;
+        }
+    }
+
+    if (num_bad_indices > 0) {
+        std::cout << num_bad_indices << " tasks saw an invalid worker index" << std::endl;
+        error = true;
+    }
+
+    return error;
+
+}
@@ -0,0 +1,66 @@
+/**
+* @authors Eric Horton, Kyle Kloster, Drew van der Poel
+*
+* This file is part of MI-bicliques, https://github.com/TheoryInPractice/MI-bicliques,
+* and is Copyright (C) North Carolina State University, 2018.
+* It is licensed under the three-clause BSD license; see LICENSE.
+*/
+
+#include<atomic>
+#include<functional>
+#include<iostream>
+#include<vector>
+#include"../../src/algorithms/WorkStealingPool.h"
+
+/**
+ * Test WorkStealingPool::wait(num_unfinished) on a tree of tasks in which
+ * every task below a given depth submits two children and waits for them.
+ * A task must only go on once both its children have finished, and this
+ * must not deadlock even on a single worker.
+ */
+int test_workstealingpool_waiting_tasks(int argc, char ** argv) {
+
+    // Whether or not an error has occurred.
+    bool error = false;
+
+    const size_t depth = 10;
+
+    for (size_t num_threads : {1, 2, 4}) {
+
+        std::atomic<size_t> num_early(0);
+        WorkStealingPool pool(num_threads);
+
+        // Run the subtree of one task, returning the number of tasks in it
+        std::function<size_t(size_t)> spawn = [&](size_t level) -> size_t {
+            if (level == depth) return 1;
+
+            std::vector<size_t> subtree_sizes(2, 0);
+            std::atomic<size_t> num_unfinished(2);
+            for (size_t child = 0; child < 2; child++) {
+                pool.submit([&, child, level] {
+                    subtree_sizes[child] = spawn(level + 1);
+                    num_unfinished--;
+                });
+            }
+            pool.wait(num_unfinished);
+
+            if (subtree_sizes[0] == 0 || subtree_sizes[1] == 0) num_early++;
+            return 1 + subtree_sizes[0] + subtree_sizes[1];
+        };
+
+        size_t num_tasks_run = 0;
+        pool.submit([&] { num_tasks_run = spawn(0); });
+        pool.wait();
+
+        size_t expected = (size_t(1) << (depth + 1)) - 1;
+        if (num_tasks_run != expected || num_early > 0) {
+            std::cout << "With " << num_threads << " threads, " << num_tasks_run;
+            std::cout << " tasks ran instead of " << expected << ", and ";
+            std::cout << num_early << " went on before their children finished" << std::endl;
+            error = true;
+        }
+    }
+
+    return error;
+
+}